@@ -0,0 +1,21 @@
+const int table[2000] = {-216, 436, 990, -86, 728, -203, -345, 251, 169, 911, -310, 297, -796, 606, -747, 333, -379, 717, 427, 89, 471, 80, -384, -636, -524, 876, 899, -639, 305, -966, -569, -257, -857, 276, -742, 443, 739, 602, -921, -591, -684, 989, -18, 844, -85, 88, -301, 29, -866, -845, 101, 960, -56, 20, -938, 624, -750, 172, -516, 517, 260, 304, 474, 725, -782, 189, -850, -859, -713, -206, -17, 323, -584, 234, 294, -627, 90, -567, 830, -405, 786, -448, 674, 297, 468, -757, 178, 525, -886, -234, -28, -686, 863, -398, -821, 33, 826, 895, 791, -169, 178, 391, -357, -435, -347, -420, 664, -724, -674, 700, 485, -101, -842, 477, -269, 145, 665, -535, -704, 44, -290, 141, 324, -760, -958, -440, -634, 975, 694, 960, -998, -424, -708, 423, -590, -654, 315, 659, -486, -111, 44, 434, -808, -132, 570, 480, 2, 421, -123, -820, 636, 493, 334, 749, 736, -357, 577, -321, -761, 977, -862, -5, 824, -23, 2, -845, 980, 155, 185, -206, 806, -496, -943, -121, 766, 222, 202, 360, -589, -281, 761, -929, -604, -800, 733, 919, -857, 346, -452, 899, -634, -433, -575, 448, 229, 397, -913, -399, -902, -221, 855, -243, -178, -944, 439, 209, 1000, -318, 433, -487, 348, 392, -752, 414, 752, -296, 199, 549, 48, -750, -431, -423, -918, -549, 60, -570, -263, 989, -415, -687, -678, 838, 104, -824, -836, 618, -524, 741, -719, 222, -543, 978, 346, 764, 779, -747, 121, -386, 210, -530, -903, 233, 220, -715, 408, -357, 781, -30, -128, 480, 678, -441, 435, -21, -778, 940, 181, -573, -919, 104, -190, -656, 367, -836, 758, -906, 684, 603, 889, -20, -726, -123, 167, -337, 485, 501, 397, -242, 403, -496, 266, -609, 344, -759, -930, 579, 33, -220, -827, -183, 876, 797, -80, 262, -637, -512, 793, -555, -806, -66, -916, 276, 532, 937, -946, -342, -268, 320, 11, -128, 80, -884, 257, 128, 912, -568, -183, -185, 971, 180, 9, -208, 554, 183, -395, -463, -706, -752, 164, 909, -364, -719, 344, 715, 565, 474, 55, 643, 948, -520, -100, -458, 999, 351, -92, 662, -333, 552, 195, -871, 79, 343, 418, 636, -122, -476, 661, -977, -759, -410, 785, 381, 701, -988, 150, -825, 993, 507, 88, -529, 262, -853, -527, 856, -760, -480, 201, 612, 307, -334, 109, 756, 200, -180, -648, 126, -280, -875, 184, -302, 403, 525, -395, -809, 922, 402, -200, -962, 59, 831, -995, -86, -737, -219, 147, -449, -80, 538, 680, 296, 451, -814, 472, -765, 849, -844, 4, -767, -875, -643, 760, 742, 362, 133, 200, -568, -471, -221, 479, 229, 807, -82, -399, 785, 614, -426, -63, -577, 464, -290, -426, -262, 532, -698, 139, 430, 493, -525, -564, 15, 375, -444, 600, -458, 177, -426, -113, 116, 40, 249, 412, 732, -601, 771, 412, 820, -258, -692, 65, -272, 949, 886, -52, -797, -859, -660, -849, 286, -929, -466, 981, -230, -470, -727, -476, -784, -666, -239, -309, -700, 10, -508, 342, -579, -904, -40, -407, 911, 567, 7, -300, 48, 965, -989, -94, 139, -980, 824, -299, 108, 870, 873, 562, -340, 936, 281, -703, 917, -498, 269, 211, 631, -729, -764, -470, -126, -965, 248, -735, 24, -685, -121, -14, -662, -287, 27, 257, 320, 986, -154, -14, 921, 881, 364, 125, -90, -642, -44, 556, 282, 344, -133, -831, -515, -552, 858, -555, -880, 626, -572, -936, 667, 445, -793, -303, 217, 946, -409, 768, 228, -443, -746, 509, 897, -319, 530, -431, 473, -785, 533, 208, -830, -303, -594, 779, 843, 631, 192, 701, -113, 765, -696, -876, -806, 362, 624, 20, -77, -657, 380, -830, 229, -204, -103, -542, -932, 278, -77, -488, 130, -918, 890, 203, 119, -267, -261, -901, -401, -630, 853, 984, -13, 375, 200, 3, 705, -637, 45, 701, -499, -907, 90, 700, -916, -727, -322, -220, -380, 163, 260, -186, -692, -306, 374, 236, 266, 790, 987, 701, -662, -382, 820, 897, -365, -213, 756, -708, -85, 279, 396, -772, -966, 724, -561, 70, 159, -791, 8, 993, 112, 805, 497, 748, -326, 432, -58, -385, -279, 659, -142, -353, -334, -222, 600, 969, 357, 335, 709, -549, -494, 116, -495, -810, -326, 319, 729, 905, 95, -750, 336, 103, 501, 998, 927, -61, -915, -228, 487, 533, -600, 279, 880, -578, 371, -42, -767, -707, -252, -993, 424, 738, 30, -43, 676, -586, 755, 818, -882, 414, 852, 845, -558, 901, 337, 106, -699, -83, 446, 392, -742, -184, 767, 995, 420, -205, -175, -307, -623, 851, 264, 227, -753, -354, 704, -701, -621, 100, -995, 402, -980, 894, -463, -684, -291, 495, 730, 599, -55, 208, 298, 270, -891, 902, 201, -908, -299, -795, -691, -964, 801, -721, -606, 610, -776, 914, -764, -41, -403, 407, -531, -121, -116, -383, -737, -770, 622, -297, -813, 63, 492, -551, 237, 118, 386, 146, 24, -451, 804, 981, -13, -131, -298, 215, 870, 886, -973, 224, 233, 545, 723, -713, -928, -582, 136, 261, 766, 612, 378, 21, 867, -220, 400, 696, 64, 96, -393, -916, -35, -490, -127, -854, -224, -80, 224, -224, 791, -188, 911, 463, 119, 890, -364, -839, 587, 396, 456, 309, 883, 561, -197, -444, -390, -244, -597, 252, -521, -7, -448, 531, 840, 660, 663, -793, 611, -500, -777, -897, 47, -724, 262, -374, -43, -174, 40, 436, -149, 436, 203, -74, -939, -271, -538, 469, -666, -350, 60, 148, -592, -296, 626, -583, -562, 289, 624, 208, 124, 555, -824, 438, -551, -254, -457, -813, -361, 583, 583, -106, 140, 928, -321, -979, 70, -651, 573, 489, 604, 595, 179, -789, 565, -200, 330, -318, 22, 1, 955, 966, 595, -654, 599, -482, -878, 686, 76, 842, -840, 616, 559, 519, 826, 520, -307, 921, -177, -34, -259, 959, -628, 696, 83, 384, 278, -282, 500, -928, -267, 847, 282, -36, -796, -316, 205, -78, -290, -983, -598, -162, -51, 725, -732, 965, -709, 986, 269, 354, 850, 317, -303, 782, 882, -325, 952, -334, 277, 893, 309, 773, 429, -381, 528, 357, -718, 944, 190, 653, -944, -266, -268, 253, 358, -170, -113, -28, 277, 640, 148, -826, -796, -372, 747, -378, -242, -526, 476, 900, -753, -526, -168, 488, -93, 373, -332, -949, -557, -752, 648, -886, -68, -844, 175, 666, 948, 831, -43, 478, 75, 602, -550, -22, -149, 285, -961, 856, 672, -779, -272, -4, -745, -642, -284, 179, -463, -850, 871, -557, -908, -180, 272, -733, 949, 680, 966, -400, 52, 305, -542, -14, -399, -819, -173, 117, -438, -133, -113, 484, -743, 230, -698, 793, 559, -744, -824, -422, 253, 620, 185, 96, -96, 894, -100, -340, -75, -752, -557, -682, -663, 906, 988, 611, 464, -149, -326, 649, -441, -8, -80, -683, 743, -378, -954, -121, -71, 789, 486, -535, 179, -262, -387, -438, -805, -635, 429, -234, -860, -247, -816, 262, 636, -466, -455, 980, -839, 558, -257, 546, 883, -653, -498, 13, -449, -831, 832, 851, 841, -743, 576, 719, 182, 41, -954, 164, -879, 541, 13, 985, 217, 501, -353, 460, -977, -106, -685, -258, -756, -16, 668, 338, 685, 51, 590, 498, -718, 503, -25, 442, -502, 783, -34, 738, 575, -213, 536, -481, -989, -145, 920, 517, -423, -211, 652, -427, -590, -295, -505, -799, 570, 259, 123, -361, 680, 279, 152, 840, 377, 792, -273, -149, -678, -892, 718, 650, 216, 659, -773, 228, 448, -900, -576, 532, 96, -394, 86, -808, -768, -834, 858, 361, -605, -980, 234, -844, 168, -555, -570, 328, 948, -539, -708, 563, 2, -408, -257, -214, -134, 665, 690, 87, 651, -113, 543, 915, -55, -23, 580, -355, 500, 342, -829, -235, 383, -207, 448, -986, -230, 660, -889, 671, 154, 1, -980, -498, -958, 340, -63, -251, 578, 75, -592, 626, -534, 157, 935, -819, -754, 272, 388, -4, 206, -498, 939, -836, -766, 266, 731, 681, 168, 992, -399, -654, -709, -223, -793, -244, 106, 207, 216, -209, -121, 790, 610, 40, 396, 25, -881, 55, -203, -452, -397, -174, 390, -415, -122, 773, 493, -600, 712, 176, 320, -81, -963, -542, -31, -705, -151, 945, 762, 130, -547, 453, 573, 848, -876, 431, 713, 802, -682, -473, -681, -956, 230, 810, 444, -574, 538, 397, 577, 709, -266, -258, -957, -458, -129, -437, 604, 980, -162, 220, 759, 605, 307, 957, -415, 395, -581, -484, 746, 847, -791, 934, 758, -140, 155, -520, 392, 616, 7, -305, -132, -484, 355, 977, -247, -342, 615, 307, 423, 956, 794, 664, 776, 269, -721, 851, 523, 668, -145, 528, -346, 652, -807, 226, -156, -67, 929, 96, -375, -283, 53, 115, 958, -375, 383, 5, 867, -394, 480, 753, 595, -714, -660, 30, 143, -135, 266, 317, -417, -646, 212, -53, -776, -408, 104, -992, -794, 96, 296, -996, -53, -351, -58, -821, -805, -7, -298, -873, 565, 743, 892, -372, 350, -790, -249, -707, -228, -865, 129, 729, -612, 471, -178, 811, 123, -979, -657, -718, 570, -896, -442, 112, 28, -223, 365, 212, 75, 84, -668, 987, -909, 168, -736, -675, 967, -908, 740, -808, -438, -446, -922, 214, 84, 84, 820, 120, 456, 713, 976, -170, -856, 79, 478, 923, -252, 654, 178, -207, -617, 257, -424, -279, -537, 113, -570, -791, 593, -77, -853, -469, -703, 21, 258, -409, -896, 985, -339, 288, -894, -246, 626, 385, -395, 519, -123, -299, -422, -763, -443, 222, -155, -810, 723, -548, 532, -510, 307, 583, -599, -687, 767, 458, 139, 657, -794, 241, -268, 345, -480, -446, -266, 582, -111, -517, -896, 197, -813, 657, -718, -127, -968, -989, 802, -416, -675, -528, 716, -555, -274, -489, -185, -660, 450, -936, 201, 817, 73, 754, 72, 346, -636, -790, -757, -695, 655, 993, 246, -484, 130, 978, 988, 249, 167, -440, -401, -894, -490, 245, -677, -150, 333, -846, 937, 860, 413, -736, -352, -2, -369, 303, -160, -325, 592, 672, -840, 549, -790, -88, 124, 662, 101, 18, 786, 116, 590, -579, 747, -757, -434, 293, 850, -626, -938, 287, 130, 396, -877, -477, 268, 734, 13, 659, -675, -611, -164, -342, 640, 65, 137, -541, 534, -991, -910, 641, -402, -547, 708, 444, -599, -820, 700, -866, -749, -426, 328, 422, 323, 25, 453, -39, -586, 68, 867, -485, 269, 115, 813, 728, 315, -647, 26, -839, -19, 68, 997, -271, 611, 653, 366, -842, 783, 669, -992, -222, -222, -394, -567, -612, -764, 136, 984, 244, -129, 106, -319, -764, 885, 803, -82, 661, 523, 662, 34, 779, 473, 391, 177, -447, -17, 813, 688, 994, -660, 638, 558, 120, -319, 696, -172, -100, 529, -837, -370, 682, -654, -475, 982, 644, -695, -553, 647, 305, -696, 830, -676, 646, 693, 904, 190, 53, -551, -834, 223, 323, -39, 599, -43, 526, 376, 638, 94, 947, -398, 795, 303, -384, -237, -900, -41, 562, -275, -916, 231, -413, 722, -455, -482, 957, -263, 12, 531, -456, 542, 463, -265, -320, 531, -934, 719, 637, 381, 26, 70, 991, 688, -537, 633, -558, 610, -958, -797, -875, 786, 275, -986, 516, -680, -419, 238, -666, -444, -786, -357, 267, -811, 88, 788, -154, -460, -862, -244, -509, -128, -108, 578, 849, -867, 141, 246, 349, 880, -180, 312, 121, -574, -777, -185, 108, 130, -519, 657, -250, -311, -27, -713, 499, 679, 600, -752, -860, 869, -934, 85, -193, -503, -406, 65, -661, 502, 910, -119, 625, -1000, -403, 96, -179, -708, 367, -488, -540, -739, -928, 849, -36, 308, 548, -986, 387, -867, -968, 457, 987, 227, 696, -182, -433, 199, -738, -546, 404, 217, -755, 295, 947, 444, -72, -26, -254, 462, 209, -985, 853, 37, -640, -416, 613, -386, -11, -167, -509, 662, -474, 706, 718, 924, -844, 664, 768, 820, -949, -746, 544, -1, -761, -509, -925, 987, 64, 564, 331, 138, -713, 492, -173, -252, -231, 685, -856, 737, -922, -963, -424, 213, 441, 701, 852, 88, -63, -647, -485, -530, -505, 403, -296, -146, 724, -169, -320, -116, -144, -966, -384, -645};
+int grid[30][30] = {{1, 0, 7, 8, 3, 5, 4, 4, 7, 6, 2, 2, 3, 9, 3, 1, 6, 8, 6, 5, 1, 4, 6, 6, 9, 6, 2, 2, 0, 6}, {9, 8, 4, 9, 9, 2, 7, 3, 9, 3, 8, 8, 7, 4, 8, 3, 4, 9, 8, 7, 0, 0, 5, 4, 7, 7, 3, 9, 0, 9}, {0, 8, 9, 2, 4, 7, 6, 6, 5, 0, 5, 6, 8, 9, 9, 8, 6, 6, 2, 1, 2, 2, 4, 5, 0, 7, 5, 0, 1, 0}, {4, 0, 1, 1, 3, 7, 1, 3, 0, 6, 4, 6, 9, 0, 2, 8, 0, 8, 3, 0, 0, 6, 4, 9, 7, 3, 5, 0, 9, 9}, {7, 5, 0, 0, 3, 5, 2, 4, 9, 4, 7, 7, 5, 9, 0, 6, 9, 6, 1, 7, 7, 4, 6, 9, 9, 7, 8, 5, 9, 2}, {6, 6, 5, 4, 0, 6, 6, 6, 9, 6, 0, 3, 1, 9, 5, 9, 8, 6, 6, 6, 1, 1, 7, 9, 0, 7, 3, 4, 9, 5}, {6, 8, 5, 2, 0, 6, 9, 1, 5, 9, 9, 7, 2, 9, 0, 4, 8, 3, 0, 2, 3, 2, 9, 9, 9, 9, 9, 0, 4, 0}, {1, 0, 1, 5, 6, 3, 6, 1, 3, 5, 1, 1, 4, 6, 0, 1, 3, 4, 3, 7, 1, 7, 7, 3, 7, 6, 1, 5, 6, 9}, {0, 5, 4, 9, 9, 8, 4, 3, 0, 3, 4, 9, 3, 2, 1, 2, 1, 2, 1, 1, 2, 9, 5, 8, 1, 0, 4, 5, 6, 7}, {8, 7, 3, 8, 4, 9, 3, 6, 6, 4, 1, 2, 9, 9, 3, 0, 6, 6, 0, 0, 2, 8, 6, 2, 4, 9, 1, 4, 4, 5}, {8, 0, 3, 9, 9, 0, 7, 8, 4, 1, 2, 4, 7, 5, 3, 7, 5, 8, 0, 5, 1, 0, 5, 7, 5, 2, 0, 8, 1, 2}, {5, 4, 1, 9, 6, 9, 7, 9, 4, 4, 2, 2, 0, 0, 7, 0, 9, 4, 0, 2, 0, 2, 4, 0, 2, 5, 9, 6, 8, 3}, {2, 6, 7, 0, 2, 4, 8, 5, 6, 1, 1, 4, 9, 9, 8, 9, 0, 1, 0, 2, 7, 5, 5, 7, 8, 5, 5, 7, 7, 2}, {7, 1, 9, 7, 6, 8, 5, 7, 8, 7, 1, 4, 1, 1, 8, 9, 1, 3, 0, 5, 6, 8, 1, 8, 0, 0, 6, 8, 3, 8}, {2, 6, 8, 2, 5, 7, 6, 4, 4, 9, 6, 1, 0, 0, 9, 0, 1, 2, 0, 0, 6, 1, 0, 7, 6, 2, 0, 7, 1, 1}, {3, 9, 2, 8, 1, 1, 4, 5, 2, 0, 3, 4, 6, 6, 9, 0, 6, 3, 0, 9, 6, 0, 4, 2, 1, 6, 3, 7, 6, 1}, {0, 1, 9, 9, 3, 8, 6, 8, 2, 1, 3, 1, 0, 8, 9, 0, 5, 0, 8, 8, 8, 0, 1, 6, 3, 0, 7, 4, 3, 5}, {3, 0, 0, 4, 9, 6, 7, 5, 5, 0, 0, 4, 7, 1, 1, 8, 1, 4, 3, 5, 1, 5, 6, 5, 5, 5, 7, 0, 9, 7}, {2, 7, 2, 9, 0, 7, 2, 6, 9, 8, 3, 4, 4, 3, 0, 8, 9, 6, 0, 1, 3, 6, 6, 5, 3, 1, 5, 0, 6, 3}, {2, 9, 6, 3, 1, 2, 0, 1, 3, 8, 8, 8, 0, 9, 8, 6, 2, 8, 1, 3, 8, 7, 3, 7, 1, 3, 9, 4, 4, 0}, {3, 2, 5, 7, 3, 3, 1, 4, 4, 3, 0, 3, 5, 1, 0, 4, 8, 5, 8, 4, 0, 1, 6, 9, 3, 5, 0, 4, 9, 1}, {0, 9, 3, 0, 5, 6, 0, 2, 3, 9, 4, 6, 6, 1, 5, 8, 0, 4, 5, 8, 8, 7, 3, 8, 7, 9, 0, 5, 7, 8}, {9, 9, 9, 9, 9, 6, 7, 0, 3, 6, 2, 2, 7, 7, 8, 8, 4, 4, 9, 3, 4, 9, 4, 5, 6, 8, 2, 4, 1, 7}, {1, 7, 3, 0, 6, 8, 8, 4, 9, 4, 4, 3, 7, 5, 0, 2, 7, 9, 2, 7, 8, 4, 4, 5, 2, 3, 1, 4, 2, 5}, {2, 1, 8, 7, 8, 6, 0, 3, 5, 8, 4, 2, 7, 6, 6, 6, 8, 9, 4, 6, 0, 1, 7, 9, 0, 6, 1, 0, 9, 0}, {8, 9, 8, 4, 3, 5, 6, 3, 3, 5, 2, 2, 5, 4, 6, 4, 3, 9, 8, 1, 0, 6, 9, 8, 5, 9, 2, 4, 9, 4}, {3, 8, 5, 4, 5, 7, 6, 6, 3, 5, 2, 1, 3, 9, 7, 7, 3, 6, 2, 3, 8, 0, 9, 4, 3, 4, 8, 7, 0, 4}, {1, 9, 8, 3, 1, 4, 8, 4, 8, 4, 7, 4, 9, 0, 2, 5, 5, 5, 8, 9, 5, 3, 3, 1, 3, 7, 5, 7, 6, 7}, {9, 1, 6, 2, 4, 4, 6, 4, 6, 0, 5, 4, 4, 4, 1, 9, 1, 5, 6, 0, 6, 5, 5, 7, 2, 4, 4, 6, 1, 3}, {1, 4, 0, 4, 9, 5, 4, 4, 3, 5, 7, 1, 6, 9, 4, 1, 5, 0, 0, 2, 4, 4, 3, 3, 5, 8, 7, 5, 2, 3}};
+int zeros[4096];
+
+int main() {
+	int n;
+	n = getint();
+	int i, s = 0;
+	for (i = 0; i < 2000; i = i + 1) {
+		s = s + table[i] * (i % n + 1);
+		zeros[i * 2] = table[i];
+	}
+	int j, g = 0;
+	for (i = 0; i < 30; i = i + 1) {
+		for (j = 0; j < 30; j = j + 1) {
+			g = g + grid[i][j] * (i + j);
+		}
+	}
+	printf("%d %d %d\n", s, g, zeros[3998] + zeros[3999]);
+	return 0;
+}
@@ -0,0 +1,27 @@
+@.fmtd = private constant [3 x i8] c"%d\00"
+@.fmtc = private constant [3 x i8] c"%c\00"
+@.fmts = private constant [3 x i8] c"%s\00"
+declare i32 @scanf(i8*, ...)
+declare i32 @printf(i8*, ...)
+define i32 @getint() {
+  %p = alloca i32
+  %f = getelementptr [3 x i8], [3 x i8]* @.fmtd, i32 0, i32 0
+  call i32 (i8*, ...) @scanf(i8* %f, i32* %p)
+  %v = load i32, i32* %p
+  ret i32 %v
+}
+define void @putint(i32 %x) {
+  %f = getelementptr [3 x i8], [3 x i8]* @.fmtd, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %x)
+  ret void
+}
+define void @putch(i32 %x) {
+  %f = getelementptr [3 x i8], [3 x i8]* @.fmtc, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %x)
+  ret void
+}
+define void @putstr(i8* %x) {
+  %f = getelementptr [3 x i8], [3 x i8]* @.fmts, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i8* %x)
+  ret void
+}
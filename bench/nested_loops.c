@@ -0,0 +1,46 @@
+const int N = 40;
+int a[40][40], b[40][40], c[40][40];
+int prefix[40][40];
+
+int main() {
+	int seed;
+	seed = getint();
+	int i, j, k;
+	for (i = 0; i < N; i = i + 1) {
+		for (j = 0; j < N; j = j + 1) {
+			seed = (seed * 1103 + 12345) % 65536;
+			a[i][j] = seed % 100;
+			seed = (seed * 1103 + 12345) % 65536;
+			b[i][j] = seed % 100;
+		}
+	}
+	for (i = 0; i < N; i = i + 1) {
+		for (j = 0; j < N; j = j + 1) {
+			int sum = 0;
+			for (k = 0; k < N; k = k + 1) {
+				sum = sum + a[i][k] * b[k][j];
+			}
+			c[i][j] = sum;
+		}
+	}
+	for (i = 0; i < N; i = i + 1) {
+		for (j = 0; j < N; j = j + 1) {
+			prefix[i][j] = c[i][j] % 1000;
+			if (i > 0) {
+				prefix[i][j] = prefix[i][j] + prefix[i - 1][j];
+			}
+			if (j > 0) {
+				prefix[i][j] = prefix[i][j] + prefix[i][j - 1];
+			}
+			if (i > 0 && j > 0) {
+				prefix[i][j] = prefix[i][j] - prefix[i - 1][j - 1];
+			}
+		}
+	}
+	int trace = 0;
+	for (i = 0; i < N; i = i + 1) {
+		trace = trace + c[i][i];
+	}
+	printf("%d %d\n", trace, prefix[N - 1][N - 1]);
+	return 0;
+}
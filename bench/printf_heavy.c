@@ -0,0 +1,13 @@
+int main() {
+	int n;
+	n = getint();
+	int i = 0;
+	for (; i < n; i = i + 1) {
+		printf("line %d: square %d, cube %d\n", i, i * i, i * i * i);
+		if (i % 10 == 0) {
+			printf("-- checkpoint %d --\n", i / 10);
+		}
+	}
+	printf("done\n");
+	return 0;
+}
@@ -0,0 +1,44 @@
+int depth(int n) {
+	if (n == 0) {
+		return 0;
+	}
+	return depth(n - 1) + 1;
+}
+
+int fib(int n) {
+	if (n < 2) {
+		return n;
+	}
+	return fib(n - 1) + fib(n - 2);
+}
+
+int ack(int m, int n) {
+	if (m == 0) {
+		return n + 1;
+	}
+	if (n == 0) {
+		return ack(m - 1, 1);
+	}
+	return ack(m - 1, ack(m, n - 1));
+}
+
+int hanoi(int n, int from, int to, int via) {
+	if (n == 0) {
+		return 0;
+	}
+	int moves = hanoi(n - 1, from, via, to);
+	moves = moves + 1;
+	return moves + hanoi(n - 1, via, to, from);
+}
+
+int main() {
+	int n, f, m;
+	n = getint();
+	f = getint();
+	m = getint();
+	printf("%d\n", depth(n));
+	printf("%d\n", fib(f));
+	printf("%d\n", ack(2, m));
+	printf("%d\n", hanoi(12, 1, 3, 2));
+	return 0;
+}
@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+# benchmark driver
+#
+# builds the compiler for each make target, compiles every benchmark in this
+# directory, and records the compile time and peak memory of the compiler,
+# the number of emitted instructions, and for mips the executed instructions
+# estimated cycles and pipeline stalls reported by the built-in simulator
+#
+# usage: python3 bench/run.py [--no-build] [--targets mips ir] [--output results.json]
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import time
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.dirname(BENCH_DIR)
+BUILD_DIR = os.path.join(BENCH_DIR, 'build')
+
+
+def build(target):
+	subprocess.run(['make', '-C', ROOT_DIR, target], check=True, stdout=subprocess.DEVNULL)
+	if target == 'sim':
+		return shutil.copy(os.path.join(ROOT_DIR, 'sim'), os.path.join(BUILD_DIR, 'sim'))
+	return shutil.copy(os.path.join(ROOT_DIR, 'main'), os.path.join(BUILD_DIR, 'main-' + target))
+
+
+def run_measured(args, stdin, stdout):
+	# wait4 gives the resource usage of this child alone
+	start = time.perf_counter()
+	proc = subprocess.Popen(args, stdin=stdin, stdout=stdout, stderr=subprocess.DEVNULL)
+	_, status, usage = os.wait4(proc.pid, 0)
+	proc.returncode = os.waitstatus_to_exitcode(status)
+	elapsed = time.perf_counter() - start
+	# ru_maxrss is in kilobytes on linux
+	return proc.returncode, elapsed, usage.ru_maxrss
+
+
+def count_mips(path):
+	count = 0
+	in_text = False
+	with open(path) as f:
+		for line in f:
+			line = line.strip()
+			if line in ('.data', '.text'):
+				in_text = line == '.text'
+			elif in_text and line and not line.endswith(':'):
+				count += 1
+	return count
+
+
+def count_ir(path):
+	with open(path) as f:
+		return sum(1 for line in f if line.startswith('    '))
+
+
+def simulate(sim, asm, data):
+	proc = subprocess.run([sim, asm, data], capture_output=True, text=True)
+	report = {}
+	for line in proc.stderr.splitlines():
+		m = re.match(r'^(\w+) (\d+)$', line)
+		if m:
+			report[m.group(1)] = int(m.group(2))
+	return proc.returncode, proc.stdout, report
+
+
+def run_ir(ll, data):
+	llvm_link, lli = shutil.which('llvm-link'), shutil.which('lli')
+	if llvm_link is None or lli is None:
+		return None
+	linked = ll + '.linked.ll'
+	subprocess.run([llvm_link, ll, os.path.join(BENCH_DIR, 'libsysy.ll'), '-S', '-o', linked], check=True)
+	with open(data) as f:
+		proc = subprocess.run([lli, linked], stdin=f, capture_output=True, text=True)
+	return proc.stdout
+
+
+def main():
+	parser = argparse.ArgumentParser()
+	parser.add_argument('--no-build', action='store_true', help='reuse the binaries in bench/build')
+	parser.add_argument('--targets', nargs='+', default=['mips', 'ir'])
+	parser.add_argument('--output', default=os.path.join(BENCH_DIR, 'results.json'))
+	args = parser.parse_args()
+
+	os.makedirs(BUILD_DIR, exist_ok=True)
+	if not args.no_build:
+		for target in args.targets + ['sim']:
+			build(target)
+	sim = os.path.join(BUILD_DIR, 'sim')
+
+	names = sorted(name[:-2] for name in os.listdir(BENCH_DIR) if name.endswith('.c'))
+	results = []
+	for target in args.targets:
+		compiler = os.path.join(BUILD_DIR, 'main-' + target)
+		suffix = '.s' if target != 'ir' else '.ll'
+		for name in names:
+			source = os.path.join(BENCH_DIR, name + '.c')
+			data = os.path.join(BENCH_DIR, name + '.in')
+			with open(os.path.join(BENCH_DIR, name + '.out')) as f:
+				expected = f.read()
+			output = os.path.join(BUILD_DIR, name + '.' + target + suffix)
+			with open(source) as fin, open(output, 'w') as fout:
+				code, elapsed, rss = run_measured([compiler], fin, fout)
+			result = {
+				'name': name,
+				'target': target,
+				'compile_ok': code == 0,
+				'compile_time': round(elapsed, 4),
+				'peak_rss_kb': rss,
+				'instructions': None,
+				'executed': None,
+				'cycles': None,
+				'stalls': None,
+				'correct': None,
+			}
+			if code == 0 and target == 'ir':
+				result['instructions'] = count_ir(output)
+				stdout = run_ir(output, data)
+				if stdout is not None:
+					result['correct'] = stdout == expected
+			elif code == 0:
+				result['instructions'] = count_mips(output)
+				code, stdout, report = simulate(sim, output, data)
+				result['executed'] = report.get('instructions')
+				result['cycles'] = report.get('cycles')
+				result['stalls'] = report.get('stalls')
+				result['classes'] = {k: v for k, v in report.items() if k not in ('instructions', 'cycles', 'stalls')}
+				result['correct'] = code == 0 and stdout == expected
+			results.append(result)
+			print('%-6s %-16s %8.3fs %8d KB %8s insts %12s cycles %s' % (
+				target, name, elapsed, rss, result['instructions'], result['cycles'],
+				{True: 'ok', False: 'WRONG', None: '-'}[result['correct']]), file=sys.stderr)
+
+	with open(args.output, 'w') as f:
+		json.dump({'benchmarks': results}, f, indent=2)
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,1260 @@
+int f0(int x) {
+	return x + 1;
+}
+
+int f1(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 4;
+	}
+	return f0(x);
+}
+
+int f2(int x) {
+	return f1(x * 3 % 1000);
+}
+
+int f3(int x) {
+	int y = x - 4;
+	if (y < 0) {
+		y = -y;
+	}
+	return f2(y);
+}
+
+int f4(int x) {
+	return f3(x) + 6;
+}
+
+int f5(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 4;
+	}
+	return f4(x);
+}
+
+int f6(int x) {
+	return f5(x * 9 % 1000);
+}
+
+int f7(int x) {
+	int y = x - 7;
+	if (y < 0) {
+		y = -y;
+	}
+	return f6(y);
+}
+
+int f8(int x) {
+	return f7(x) + 2;
+}
+
+int f9(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 5;
+	}
+	return f8(x);
+}
+
+int f10(int x) {
+	return f9(x * 5 % 1000);
+}
+
+int f11(int x) {
+	int y = x - 9;
+	if (y < 0) {
+		y = -y;
+	}
+	return f10(y);
+}
+
+int f12(int x) {
+	return f11(x) + 9;
+}
+
+int f13(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 8;
+	}
+	return f12(x);
+}
+
+int f14(int x) {
+	return f13(x * 8 % 1000);
+}
+
+int f15(int x) {
+	int y = x - 9;
+	if (y < 0) {
+		y = -y;
+	}
+	return f14(y);
+}
+
+int f16(int x) {
+	return f15(x) + 6;
+}
+
+int f17(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 6;
+	}
+	return f16(x);
+}
+
+int f18(int x) {
+	return f17(x * 2 % 1000);
+}
+
+int f19(int x) {
+	int y = x - 4;
+	if (y < 0) {
+		y = -y;
+	}
+	return f18(y);
+}
+
+int f20(int x) {
+	return f19(x) + 4;
+}
+
+int f21(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 4;
+	}
+	return f20(x);
+}
+
+int f22(int x) {
+	return f21(x * 6 % 1000);
+}
+
+int f23(int x) {
+	int y = x - 5;
+	if (y < 0) {
+		y = -y;
+	}
+	return f22(y);
+}
+
+int f24(int x) {
+	return f23(x) + 8;
+}
+
+int f25(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 2;
+	}
+	return f24(x);
+}
+
+int f26(int x) {
+	return f25(x * 7 % 1000);
+}
+
+int f27(int x) {
+	int y = x - 4;
+	if (y < 0) {
+		y = -y;
+	}
+	return f26(y);
+}
+
+int f28(int x) {
+	return f27(x) + 6;
+}
+
+int f29(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 6;
+	}
+	return f28(x);
+}
+
+int f30(int x) {
+	return f29(x * 2 % 1000);
+}
+
+int f31(int x) {
+	int y = x - 6;
+	if (y < 0) {
+		y = -y;
+	}
+	return f30(y);
+}
+
+int f32(int x) {
+	return f31(x) + 8;
+}
+
+int f33(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 9;
+	}
+	return f32(x);
+}
+
+int f34(int x) {
+	return f33(x * 9 % 1000);
+}
+
+int f35(int x) {
+	int y = x - 7;
+	if (y < 0) {
+		y = -y;
+	}
+	return f34(y);
+}
+
+int f36(int x) {
+	return f35(x) + 4;
+}
+
+int f37(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 7;
+	}
+	return f36(x);
+}
+
+int f38(int x) {
+	return f37(x * 6 % 1000);
+}
+
+int f39(int x) {
+	int y = x - 6;
+	if (y < 0) {
+		y = -y;
+	}
+	return f38(y);
+}
+
+int f40(int x) {
+	return f39(x) + 8;
+}
+
+int f41(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 1;
+	}
+	return f40(x);
+}
+
+int f42(int x) {
+	return f41(x * 9 % 1000);
+}
+
+int f43(int x) {
+	int y = x - 1;
+	if (y < 0) {
+		y = -y;
+	}
+	return f42(y);
+}
+
+int f44(int x) {
+	return f43(x) + 1;
+}
+
+int f45(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 1;
+	}
+	return f44(x);
+}
+
+int f46(int x) {
+	return f45(x * 4 % 1000);
+}
+
+int f47(int x) {
+	int y = x - 4;
+	if (y < 0) {
+		y = -y;
+	}
+	return f46(y);
+}
+
+int f48(int x) {
+	return f47(x) + 9;
+}
+
+int f49(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 5;
+	}
+	return f48(x);
+}
+
+int f50(int x) {
+	return f49(x * 3 % 1000);
+}
+
+int f51(int x) {
+	int y = x - 7;
+	if (y < 0) {
+		y = -y;
+	}
+	return f50(y);
+}
+
+int f52(int x) {
+	return f51(x) + 5;
+}
+
+int f53(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 6;
+	}
+	return f52(x);
+}
+
+int f54(int x) {
+	return f53(x * 5 % 1000);
+}
+
+int f55(int x) {
+	int y = x - 2;
+	if (y < 0) {
+		y = -y;
+	}
+	return f54(y);
+}
+
+int f56(int x) {
+	return f55(x) + 9;
+}
+
+int f57(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 1;
+	}
+	return f56(x);
+}
+
+int f58(int x) {
+	return f57(x * 5 % 1000);
+}
+
+int f59(int x) {
+	int y = x - 6;
+	if (y < 0) {
+		y = -y;
+	}
+	return f58(y);
+}
+
+int f60(int x) {
+	return f59(x) + 4;
+}
+
+int f61(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 6;
+	}
+	return f60(x);
+}
+
+int f62(int x) {
+	return f61(x * 1 % 1000);
+}
+
+int f63(int x) {
+	int y = x - 7;
+	if (y < 0) {
+		y = -y;
+	}
+	return f62(y);
+}
+
+int f64(int x) {
+	return f63(x) + 9;
+}
+
+int f65(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 8;
+	}
+	return f64(x);
+}
+
+int f66(int x) {
+	return f65(x * 2 % 1000);
+}
+
+int f67(int x) {
+	int y = x - 5;
+	if (y < 0) {
+		y = -y;
+	}
+	return f66(y);
+}
+
+int f68(int x) {
+	return f67(x) + 3;
+}
+
+int f69(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 4;
+	}
+	return f68(x);
+}
+
+int f70(int x) {
+	return f69(x * 2 % 1000);
+}
+
+int f71(int x) {
+	int y = x - 7;
+	if (y < 0) {
+		y = -y;
+	}
+	return f70(y);
+}
+
+int f72(int x) {
+	return f71(x) + 9;
+}
+
+int f73(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 7;
+	}
+	return f72(x);
+}
+
+int f74(int x) {
+	return f73(x * 2 % 1000);
+}
+
+int f75(int x) {
+	int y = x - 8;
+	if (y < 0) {
+		y = -y;
+	}
+	return f74(y);
+}
+
+int f76(int x) {
+	return f75(x) + 3;
+}
+
+int f77(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 3;
+	}
+	return f76(x);
+}
+
+int f78(int x) {
+	return f77(x * 8 % 1000);
+}
+
+int f79(int x) {
+	int y = x - 7;
+	if (y < 0) {
+		y = -y;
+	}
+	return f78(y);
+}
+
+int f80(int x) {
+	return f79(x) + 4;
+}
+
+int f81(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 3;
+	}
+	return f80(x);
+}
+
+int f82(int x) {
+	return f81(x * 1 % 1000);
+}
+
+int f83(int x) {
+	int y = x - 5;
+	if (y < 0) {
+		y = -y;
+	}
+	return f82(y);
+}
+
+int f84(int x) {
+	return f83(x) + 1;
+}
+
+int f85(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 8;
+	}
+	return f84(x);
+}
+
+int f86(int x) {
+	return f85(x * 4 % 1000);
+}
+
+int f87(int x) {
+	int y = x - 3;
+	if (y < 0) {
+		y = -y;
+	}
+	return f86(y);
+}
+
+int f88(int x) {
+	return f87(x) + 9;
+}
+
+int f89(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 2;
+	}
+	return f88(x);
+}
+
+int f90(int x) {
+	return f89(x * 5 % 1000);
+}
+
+int f91(int x) {
+	int y = x - 7;
+	if (y < 0) {
+		y = -y;
+	}
+	return f90(y);
+}
+
+int f92(int x) {
+	return f91(x) + 5;
+}
+
+int f93(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 1;
+	}
+	return f92(x);
+}
+
+int f94(int x) {
+	return f93(x * 6 % 1000);
+}
+
+int f95(int x) {
+	int y = x - 9;
+	if (y < 0) {
+		y = -y;
+	}
+	return f94(y);
+}
+
+int f96(int x) {
+	return f95(x) + 7;
+}
+
+int f97(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 3;
+	}
+	return f96(x);
+}
+
+int f98(int x) {
+	return f97(x * 1 % 1000);
+}
+
+int f99(int x) {
+	int y = x - 4;
+	if (y < 0) {
+		y = -y;
+	}
+	return f98(y);
+}
+
+int f100(int x) {
+	return f99(x) + 9;
+}
+
+int f101(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 6;
+	}
+	return f100(x);
+}
+
+int f102(int x) {
+	return f101(x * 3 % 1000);
+}
+
+int f103(int x) {
+	int y = x - 7;
+	if (y < 0) {
+		y = -y;
+	}
+	return f102(y);
+}
+
+int f104(int x) {
+	return f103(x) + 6;
+}
+
+int f105(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 8;
+	}
+	return f104(x);
+}
+
+int f106(int x) {
+	return f105(x * 7 % 1000);
+}
+
+int f107(int x) {
+	int y = x - 5;
+	if (y < 0) {
+		y = -y;
+	}
+	return f106(y);
+}
+
+int f108(int x) {
+	return f107(x) + 8;
+}
+
+int f109(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 2;
+	}
+	return f108(x);
+}
+
+int f110(int x) {
+	return f109(x * 9 % 1000);
+}
+
+int f111(int x) {
+	int y = x - 1;
+	if (y < 0) {
+		y = -y;
+	}
+	return f110(y);
+}
+
+int f112(int x) {
+	return f111(x) + 5;
+}
+
+int f113(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 1;
+	}
+	return f112(x);
+}
+
+int f114(int x) {
+	return f113(x * 3 % 1000);
+}
+
+int f115(int x) {
+	int y = x - 9;
+	if (y < 0) {
+		y = -y;
+	}
+	return f114(y);
+}
+
+int f116(int x) {
+	return f115(x) + 5;
+}
+
+int f117(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 6;
+	}
+	return f116(x);
+}
+
+int f118(int x) {
+	return f117(x * 6 % 1000);
+}
+
+int f119(int x) {
+	int y = x - 4;
+	if (y < 0) {
+		y = -y;
+	}
+	return f118(y);
+}
+
+int f120(int x) {
+	return f119(x) + 7;
+}
+
+int f121(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 8;
+	}
+	return f120(x);
+}
+
+int f122(int x) {
+	return f121(x * 7 % 1000);
+}
+
+int f123(int x) {
+	int y = x - 4;
+	if (y < 0) {
+		y = -y;
+	}
+	return f122(y);
+}
+
+int f124(int x) {
+	return f123(x) + 9;
+}
+
+int f125(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 7;
+	}
+	return f124(x);
+}
+
+int f126(int x) {
+	return f125(x * 2 % 1000);
+}
+
+int f127(int x) {
+	int y = x - 1;
+	if (y < 0) {
+		y = -y;
+	}
+	return f126(y);
+}
+
+int f128(int x) {
+	return f127(x) + 2;
+}
+
+int f129(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 8;
+	}
+	return f128(x);
+}
+
+int f130(int x) {
+	return f129(x * 8 % 1000);
+}
+
+int f131(int x) {
+	int y = x - 6;
+	if (y < 0) {
+		y = -y;
+	}
+	return f130(y);
+}
+
+int f132(int x) {
+	return f131(x) + 5;
+}
+
+int f133(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 3;
+	}
+	return f132(x);
+}
+
+int f134(int x) {
+	return f133(x * 6 % 1000);
+}
+
+int f135(int x) {
+	int y = x - 1;
+	if (y < 0) {
+		y = -y;
+	}
+	return f134(y);
+}
+
+int f136(int x) {
+	return f135(x) + 2;
+}
+
+int f137(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 9;
+	}
+	return f136(x);
+}
+
+int f138(int x) {
+	return f137(x * 3 % 1000);
+}
+
+int f139(int x) {
+	int y = x - 4;
+	if (y < 0) {
+		y = -y;
+	}
+	return f138(y);
+}
+
+int f140(int x) {
+	return f139(x) + 6;
+}
+
+int f141(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 6;
+	}
+	return f140(x);
+}
+
+int f142(int x) {
+	return f141(x * 2 % 1000);
+}
+
+int f143(int x) {
+	int y = x - 5;
+	if (y < 0) {
+		y = -y;
+	}
+	return f142(y);
+}
+
+int f144(int x) {
+	return f143(x) + 6;
+}
+
+int f145(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 6;
+	}
+	return f144(x);
+}
+
+int f146(int x) {
+	return f145(x * 2 % 1000);
+}
+
+int f147(int x) {
+	int y = x - 3;
+	if (y < 0) {
+		y = -y;
+	}
+	return f146(y);
+}
+
+int f148(int x) {
+	return f147(x) + 9;
+}
+
+int f149(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 5;
+	}
+	return f148(x);
+}
+
+int f150(int x) {
+	return f149(x * 8 % 1000);
+}
+
+int f151(int x) {
+	int y = x - 4;
+	if (y < 0) {
+		y = -y;
+	}
+	return f150(y);
+}
+
+int f152(int x) {
+	return f151(x) + 6;
+}
+
+int f153(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 7;
+	}
+	return f152(x);
+}
+
+int f154(int x) {
+	return f153(x * 9 % 1000);
+}
+
+int f155(int x) {
+	int y = x - 6;
+	if (y < 0) {
+		y = -y;
+	}
+	return f154(y);
+}
+
+int f156(int x) {
+	return f155(x) + 2;
+}
+
+int f157(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 7;
+	}
+	return f156(x);
+}
+
+int f158(int x) {
+	return f157(x * 1 % 1000);
+}
+
+int f159(int x) {
+	int y = x - 7;
+	if (y < 0) {
+		y = -y;
+	}
+	return f158(y);
+}
+
+int f160(int x) {
+	return f159(x) + 5;
+}
+
+int f161(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 8;
+	}
+	return f160(x);
+}
+
+int f162(int x) {
+	return f161(x * 2 % 1000);
+}
+
+int f163(int x) {
+	int y = x - 4;
+	if (y < 0) {
+		y = -y;
+	}
+	return f162(y);
+}
+
+int f164(int x) {
+	return f163(x) + 2;
+}
+
+int f165(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 5;
+	}
+	return f164(x);
+}
+
+int f166(int x) {
+	return f165(x * 8 % 1000);
+}
+
+int f167(int x) {
+	int y = x - 8;
+	if (y < 0) {
+		y = -y;
+	}
+	return f166(y);
+}
+
+int f168(int x) {
+	return f167(x) + 3;
+}
+
+int f169(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 3;
+	}
+	return f168(x);
+}
+
+int f170(int x) {
+	return f169(x * 1 % 1000);
+}
+
+int f171(int x) {
+	int y = x - 7;
+	if (y < 0) {
+		y = -y;
+	}
+	return f170(y);
+}
+
+int f172(int x) {
+	return f171(x) + 2;
+}
+
+int f173(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 4;
+	}
+	return f172(x);
+}
+
+int f174(int x) {
+	return f173(x * 5 % 1000);
+}
+
+int f175(int x) {
+	int y = x - 6;
+	if (y < 0) {
+		y = -y;
+	}
+	return f174(y);
+}
+
+int f176(int x) {
+	return f175(x) + 5;
+}
+
+int f177(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 2;
+	}
+	return f176(x);
+}
+
+int f178(int x) {
+	return f177(x * 5 % 1000);
+}
+
+int f179(int x) {
+	int y = x - 8;
+	if (y < 0) {
+		y = -y;
+	}
+	return f178(y);
+}
+
+int f180(int x) {
+	return f179(x) + 2;
+}
+
+int f181(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 9;
+	}
+	return f180(x);
+}
+
+int f182(int x) {
+	return f181(x * 8 % 1000);
+}
+
+int f183(int x) {
+	int y = x - 8;
+	if (y < 0) {
+		y = -y;
+	}
+	return f182(y);
+}
+
+int f184(int x) {
+	return f183(x) + 7;
+}
+
+int f185(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 4;
+	}
+	return f184(x);
+}
+
+int f186(int x) {
+	return f185(x * 7 % 1000);
+}
+
+int f187(int x) {
+	int y = x - 9;
+	if (y < 0) {
+		y = -y;
+	}
+	return f186(y);
+}
+
+int f188(int x) {
+	return f187(x) + 9;
+}
+
+int f189(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 4;
+	}
+	return f188(x);
+}
+
+int f190(int x) {
+	return f189(x * 3 % 1000);
+}
+
+int f191(int x) {
+	int y = x - 9;
+	if (y < 0) {
+		y = -y;
+	}
+	return f190(y);
+}
+
+int f192(int x) {
+	return f191(x) + 8;
+}
+
+int f193(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 6;
+	}
+	return f192(x);
+}
+
+int f194(int x) {
+	return f193(x * 2 % 1000);
+}
+
+int f195(int x) {
+	int y = x - 3;
+	if (y < 0) {
+		y = -y;
+	}
+	return f194(y);
+}
+
+int f196(int x) {
+	return f195(x) + 3;
+}
+
+int f197(int x) {
+	if (x % 2 == 0) {
+		x = x / 2;
+	} else {
+		x = x + 1;
+	}
+	return f196(x);
+}
+
+int f198(int x) {
+	return f197(x * 8 % 1000);
+}
+
+int f199(int x) {
+	int y = x - 5;
+	if (y < 0) {
+		y = -y;
+	}
+	return f198(y);
+}
+
+int main() {
+	int n;
+	n = getint();
+	int i, s = 0;
+	for (i = 0; i < n; i = i + 1) {
+		s = (s + f199(i)) % 100000;
+	}
+	printf("%d\n", s);
+	return 0;
+}
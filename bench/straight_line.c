@@ -0,0 +1,3013 @@
+int main() {
+	int x0, x1, x2, x3, x4, x5, x6, x7;
+	x0 = getint();
+	x1 = x0 + 1;
+	x2 = x1 * 3;
+	x3 = x2 - x0;
+	x4 = x3 + 7;
+	x5 = x4 * x1 % 1000;
+	x6 = x5 + x2;
+	x7 = x6 - 5;
+	x6 = (x7 * 7 + x6 + 82) % 10007;
+	x1 = (x1 * 4 + x4 + 30) % 10007;
+	x2 = (x0 * 3 + x3 + 80) % 10007;
+	x2 = (x0 + x3 + 62) % 10007;
+	x7 = (x5 + x1 + 69) % 10007;
+	x7 = (x7 + x0 + 74) % 10007;
+	x3 = (x1 + x1 + 18) % 10007;
+	x6 = (x7 + x3 + 69) % 10007;
+	x3 = (x4 + x4 + 74) % 10007;
+	x0 = (x5 + x7 + 38) % 10007;
+	x1 = (x6 * 7 + x5 + 37) % 10007;
+	x2 = (x2 + x7 + 93) % 10007;
+	x5 = (x3 * 3 + x2 + 3) % 10007;
+	x4 = (x2 * 4 + x0 + 89) % 10007;
+	x3 = (x2 * 3 + x4 + 55) % 10007;
+	x7 = (x6 * 7 + x1 + 15) % 10007;
+	x1 = (x7 * 3 + x7 + 73) % 10007;
+	x6 = (x3 * 5 + x0 + 45) % 10007;
+	x0 = (x3 + x1 + 85) % 10007;
+	x4 = (x2 + x4 + 91) % 10007;
+	x0 = (x4 * 7 + x0 + 52) % 10007;
+	x0 = (x5 + x4 + 89) % 10007;
+	x5 = (x1 * 2 + x4 + 29) % 10007;
+	x3 = (x5 + x4 + 21) % 10007;
+	x1 = (x1 + x3 + 77) % 10007;
+	x3 = (x1 + x4 + 7) % 10007;
+	x2 = (x5 * 6 + x7 + 90) % 10007;
+	x7 = (x1 + x3 + 70) % 10007;
+	x6 = (x2 + x1 + 62) % 10007;
+	x2 = (x6 * 5 + x5 + 80) % 10007;
+	x3 = (x1 * 3 + x0 + 52) % 10007;
+	x7 = (x2 + x3 + 13) % 10007;
+	x7 = (x0 * 7 + x0 + 83) % 10007;
+	x7 = (x6 + x0 + 52) % 10007;
+	x6 = (x7 * 6 + x6 + 19) % 10007;
+	x1 = (x4 + x2 + 57) % 10007;
+	x4 = (x7 + x5 + 68) % 10007;
+	x6 = (x4 + x0 + 37) % 10007;
+	x0 = (x1 + x3 + 30) % 10007;
+	x1 = (x4 * 4 + x5 + 71) % 10007;
+	x5 = (x0 * 3 + x5 + 88) % 10007;
+	x6 = (x0 * 4 + x0 + 49) % 10007;
+	x4 = (x7 + x1 + 10) % 10007;
+	x7 = (x1 + x0 + 86) % 10007;
+	x3 = (x4 * 6 + x6 + 36) % 10007;
+	x7 = (x3 * 7 + x5 + 96) % 10007;
+	x2 = (x3 * 6 + x3 + 34) % 10007;
+	x4 = (x6 * 4 + x3 + 67) % 10007;
+	x5 = (x7 + x1 + 22) % 10007;
+	x1 = (x0 * 6 + x4 + 18) % 10007;
+	x4 = (x1 * 7 + x2 + 19) % 10007;
+	x7 = (x3 + x3 + 61) % 10007;
+	x4 = (x7 + x5 + 57) % 10007;
+	x0 = (x5 + x5 + 32) % 10007;
+	x2 = (x1 * 2 + x4 + 79) % 10007;
+	x2 = (x2 * 4 + x6 + 45) % 10007;
+	x6 = (x7 + x7 + 60) % 10007;
+	x6 = (x1 + x3 + 28) % 10007;
+	x0 = (x3 + x0 + 44) % 10007;
+	x4 = (x4 * 6 + x1 + 93) % 10007;
+	x1 = (x1 + x5 + 75) % 10007;
+	x6 = (x2 + x0 + 86) % 10007;
+	x7 = (x7 + x2 + 77) % 10007;
+	x6 = (x7 + x3 + 80) % 10007;
+	x7 = (x4 * 7 + x0 + 7) % 10007;
+	x4 = (x2 * 4 + x7 + 66) % 10007;
+	x3 = (x0 + x0 + 43) % 10007;
+	x6 = (x4 + x6 + 44) % 10007;
+	x2 = (x4 * 4 + x4 + 58) % 10007;
+	x1 = (x0 + x3 + 64) % 10007;
+	x5 = (x7 * 8 + x4 + 41) % 10007;
+	x5 = (x6 + x3 + 70) % 10007;
+	x3 = (x1 + x5 + 84) % 10007;
+	x7 = (x0 + x6 + 80) % 10007;
+	x3 = (x7 + x1 + 47) % 10007;
+	x0 = (x7 + x3 + 89) % 10007;
+	x3 = (x2 + x7 + 52) % 10007;
+	x6 = (x6 + x5 + 80) % 10007;
+	x1 = (x5 + x2 + 69) % 10007;
+	x0 = (x0 + x4 + 45) % 10007;
+	x7 = (x0 * 3 + x0 + 20) % 10007;
+	x0 = (x2 + x3 + 15) % 10007;
+	x7 = (x4 * 8 + x3 + 39) % 10007;
+	x2 = (x1 + x5 + 67) % 10007;
+	x3 = (x4 * 7 + x7 + 76) % 10007;
+	x0 = (x2 + x0 + 72) % 10007;
+	x7 = (x6 + x4 + 61) % 10007;
+	x3 = (x6 * 9 + x1 + 77) % 10007;
+	x6 = (x6 + x4 + 88) % 10007;
+	x6 = (x4 * 5 + x4 + 79) % 10007;
+	x3 = (x7 + x4 + 32) % 10007;
+	x1 = (x0 * 9 + x2 + 52) % 10007;
+	x6 = (x7 * 5 + x0 + 92) % 10007;
+	x2 = (x5 * 5 + x3 + 28) % 10007;
+	x1 = (x3 * 3 + x5 + 40) % 10007;
+	x6 = (x5 + x0 + 99) % 10007;
+	x1 = (x6 * 9 + x5 + 22) % 10007;
+	x4 = (x0 * 8 + x1 + 61) % 10007;
+	x5 = (x2 + x5 + 46) % 10007;
+	x7 = (x1 * 7 + x5 + 2) % 10007;
+	x3 = (x6 + x7 + 19) % 10007;
+	x5 = (x5 * 4 + x5 + 75) % 10007;
+	x0 = (x5 * 8 + x5 + 61) % 10007;
+	x1 = (x1 * 7 + x4 + 30) % 10007;
+	x1 = (x3 * 7 + x6 + 4) % 10007;
+	x3 = (x1 * 3 + x0 + 74) % 10007;
+	x7 = (x3 * 2 + x7 + 14) % 10007;
+	x5 = (x7 + x1 + 45) % 10007;
+	x4 = (x1 + x3 + 52) % 10007;
+	x2 = (x4 * 6 + x3 + 12) % 10007;
+	x6 = (x4 * 4 + x6 + 77) % 10007;
+	x2 = (x2 * 9 + x1 + 57) % 10007;
+	x5 = (x7 + x1 + 20) % 10007;
+	x2 = (x6 * 9 + x5 + 58) % 10007;
+	x2 = (x4 * 9 + x0 + 93) % 10007;
+	x3 = (x5 * 3 + x4 + 23) % 10007;
+	x5 = (x1 + x5 + 79) % 10007;
+	x4 = (x4 * 4 + x1 + 32) % 10007;
+	x7 = (x4 + x1 + 99) % 10007;
+	x0 = (x0 * 2 + x7 + 56) % 10007;
+	x2 = (x5 * 4 + x1 + 94) % 10007;
+	x7 = (x3 * 6 + x7 + 1) % 10007;
+	x6 = (x4 * 5 + x6 + 45) % 10007;
+	x3 = (x1 * 8 + x4 + 21) % 10007;
+	x0 = (x1 + x0 + 96) % 10007;
+	x4 = (x1 + x1 + 86) % 10007;
+	x3 = (x0 + x1 + 27) % 10007;
+	x3 = (x2 * 7 + x7 + 50) % 10007;
+	x6 = (x6 * 7 + x7 + 94) % 10007;
+	x1 = (x5 + x6 + 49) % 10007;
+	x0 = (x7 + x0 + 3) % 10007;
+	x7 = (x5 + x3 + 73) % 10007;
+	x1 = (x1 + x7 + 11) % 10007;
+	x1 = (x4 + x2 + 49) % 10007;
+	x1 = (x5 * 2 + x6 + 66) % 10007;
+	x6 = (x4 * 6 + x4 + 55) % 10007;
+	x3 = (x7 + x0 + 61) % 10007;
+	x2 = (x6 + x3 + 90) % 10007;
+	x2 = (x4 + x2 + 77) % 10007;
+	x3 = (x5 + x5 + 34) % 10007;
+	x6 = (x4 * 5 + x6 + 33) % 10007;
+	x1 = (x6 * 7 + x3 + 55) % 10007;
+	x4 = (x5 + x5 + 96) % 10007;
+	x6 = (x5 * 9 + x1 + 69) % 10007;
+	x4 = (x5 * 6 + x4 + 93) % 10007;
+	x2 = (x2 * 4 + x6 + 76) % 10007;
+	x7 = (x1 + x4 + 13) % 10007;
+	x0 = (x7 * 3 + x5 + 13) % 10007;
+	x7 = (x5 * 3 + x0 + 47) % 10007;
+	x2 = (x6 + x1 + 92) % 10007;
+	x6 = (x0 + x2 + 99) % 10007;
+	x0 = (x4 + x6 + 6) % 10007;
+	x2 = (x2 + x0 + 36) % 10007;
+	x4 = (x0 + x6 + 68) % 10007;
+	x5 = (x6 * 7 + x2 + 29) % 10007;
+	x3 = (x1 + x7 + 34) % 10007;
+	x2 = (x7 + x4 + 42) % 10007;
+	x0 = (x5 * 7 + x4 + 37) % 10007;
+	x1 = (x4 + x6 + 29) % 10007;
+	x3 = (x3 + x2 + 78) % 10007;
+	x5 = (x4 * 8 + x4 + 31) % 10007;
+	x0 = (x1 * 2 + x2 + 1) % 10007;
+	x4 = (x2 + x3 + 46) % 10007;
+	x3 = (x6 + x2 + 76) % 10007;
+	x2 = (x1 + x1 + 78) % 10007;
+	x4 = (x4 + x4 + 32) % 10007;
+	x2 = (x6 + x1 + 41) % 10007;
+	x7 = (x4 * 3 + x6 + 97) % 10007;
+	x1 = (x7 + x7 + 16) % 10007;
+	x4 = (x2 + x0 + 33) % 10007;
+	x7 = (x2 * 7 + x3 + 67) % 10007;
+	x3 = (x0 * 5 + x0 + 91) % 10007;
+	x3 = (x1 + x1 + 36) % 10007;
+	x7 = (x3 + x4 + 65) % 10007;
+	x1 = (x7 + x5 + 1) % 10007;
+	x6 = (x6 + x4 + 25) % 10007;
+	x1 = (x6 + x5 + 58) % 10007;
+	x4 = (x7 * 8 + x2 + 57) % 10007;
+	x1 = (x4 * 4 + x2 + 28) % 10007;
+	x2 = (x2 + x3 + 77) % 10007;
+	x7 = (x7 * 7 + x4 + 7) % 10007;
+	x7 = (x5 * 6 + x0 + 33) % 10007;
+	x5 = (x7 * 7 + x4 + 96) % 10007;
+	x0 = (x3 + x3 + 13) % 10007;
+	x0 = (x0 * 4 + x2 + 35) % 10007;
+	x1 = (x5 * 6 + x1 + 9) % 10007;
+	x5 = (x3 * 3 + x6 + 72) % 10007;
+	x6 = (x3 * 5 + x1 + 47) % 10007;
+	x5 = (x7 + x2 + 9) % 10007;
+	x0 = (x6 * 4 + x3 + 94) % 10007;
+	x6 = (x0 * 4 + x4 + 86) % 10007;
+	x4 = (x3 + x2 + 61) % 10007;
+	x0 = (x1 * 6 + x0 + 75) % 10007;
+	x2 = (x3 * 9 + x1 + 47) % 10007;
+	x0 = (x2 * 9 + x4 + 53) % 10007;
+	x3 = (x4 + x1 + 16) % 10007;
+	x7 = (x1 + x3 + 67) % 10007;
+	x2 = (x6 * 3 + x5 + 5) % 10007;
+	x0 = (x4 + x7 + 33) % 10007;
+	x3 = (x3 * 8 + x5 + 43) % 10007;
+	x6 = (x6 * 4 + x0 + 90) % 10007;
+	x1 = (x0 + x7 + 98) % 10007;
+	x5 = (x4 * 8 + x4 + 21) % 10007;
+	x2 = (x3 + x3 + 85) % 10007;
+	x6 = (x6 + x5 + 40) % 10007;
+	x6 = (x6 + x6 + 19) % 10007;
+	x0 = (x6 + x4 + 57) % 10007;
+	x3 = (x3 * 5 + x7 + 40) % 10007;
+	x7 = (x0 * 6 + x0 + 57) % 10007;
+	x7 = (x3 + x0 + 65) % 10007;
+	x2 = (x4 * 8 + x7 + 43) % 10007;
+	x0 = (x5 * 8 + x6 + 18) % 10007;
+	x1 = (x2 * 7 + x2 + 89) % 10007;
+	x0 = (x7 + x5 + 11) % 10007;
+	x0 = (x4 + x0 + 15) % 10007;
+	x3 = (x7 + x1 + 8) % 10007;
+	x6 = (x4 + x6 + 93) % 10007;
+	x2 = (x0 + x3 + 1) % 10007;
+	x6 = (x4 + x7 + 42) % 10007;
+	x0 = (x7 + x5 + 6) % 10007;
+	x3 = (x5 * 6 + x2 + 57) % 10007;
+	x7 = (x5 * 8 + x0 + 15) % 10007;
+	x7 = (x7 * 9 + x4 + 82) % 10007;
+	x5 = (x2 * 7 + x6 + 34) % 10007;
+	x0 = (x6 * 8 + x6 + 2) % 10007;
+	x3 = (x1 * 8 + x5 + 56) % 10007;
+	x1 = (x1 + x7 + 61) % 10007;
+	x3 = (x4 * 7 + x5 + 17) % 10007;
+	x0 = (x6 * 9 + x1 + 21) % 10007;
+	x0 = (x4 + x3 + 20) % 10007;
+	x3 = (x2 * 2 + x0 + 12) % 10007;
+	x0 = (x1 * 5 + x5 + 49) % 10007;
+	x1 = (x3 + x5 + 10) % 10007;
+	x4 = (x6 + x0 + 29) % 10007;
+	x4 = (x3 + x7 + 58) % 10007;
+	x7 = (x3 * 3 + x7 + 44) % 10007;
+	x6 = (x0 * 6 + x5 + 28) % 10007;
+	x0 = (x3 + x4 + 17) % 10007;
+	x1 = (x2 + x1 + 9) % 10007;
+	x1 = (x2 + x5 + 5) % 10007;
+	x4 = (x5 * 9 + x6 + 25) % 10007;
+	x4 = (x3 * 6 + x6 + 91) % 10007;
+	x1 = (x2 + x3 + 49) % 10007;
+	x6 = (x0 + x0 + 71) % 10007;
+	x6 = (x2 + x4 + 39) % 10007;
+	x4 = (x5 + x0 + 73) % 10007;
+	x0 = (x7 + x4 + 20) % 10007;
+	x4 = (x7 + x5 + 61) % 10007;
+	x5 = (x0 + x5 + 8) % 10007;
+	x5 = (x7 + x5 + 96) % 10007;
+	x0 = (x1 * 6 + x2 + 89) % 10007;
+	x1 = (x6 * 6 + x7 + 99) % 10007;
+	x2 = (x2 + x0 + 63) % 10007;
+	x0 = (x4 + x0 + 4) % 10007;
+	x2 = (x4 + x0 + 44) % 10007;
+	x6 = (x3 * 9 + x2 + 84) % 10007;
+	x0 = (x2 * 8 + x4 + 13) % 10007;
+	x1 = (x4 + x0 + 1) % 10007;
+	x2 = (x7 * 9 + x5 + 71) % 10007;
+	x5 = (x5 * 4 + x7 + 62) % 10007;
+	x1 = (x7 * 9 + x6 + 65) % 10007;
+	x7 = (x1 + x4 + 96) % 10007;
+	x1 = (x1 + x3 + 43) % 10007;
+	x6 = (x1 + x0 + 51) % 10007;
+	x3 = (x2 + x6 + 42) % 10007;
+	x7 = (x6 * 8 + x4 + 9) % 10007;
+	x0 = (x0 + x0 + 22) % 10007;
+	x0 = (x0 + x6 + 5) % 10007;
+	x7 = (x6 + x2 + 64) % 10007;
+	x1 = (x1 + x3 + 70) % 10007;
+	x1 = (x1 * 4 + x4 + 2) % 10007;
+	x3 = (x4 * 2 + x6 + 54) % 10007;
+	x3 = (x0 + x6 + 87) % 10007;
+	x4 = (x2 * 5 + x1 + 63) % 10007;
+	x6 = (x1 + x0 + 78) % 10007;
+	x3 = (x6 + x2 + 27) % 10007;
+	x1 = (x0 * 2 + x0 + 67) % 10007;
+	x0 = (x1 + x6 + 7) % 10007;
+	x7 = (x4 * 5 + x3 + 6) % 10007;
+	x0 = (x4 * 7 + x6 + 42) % 10007;
+	x0 = (x0 * 3 + x4 + 82) % 10007;
+	x1 = (x1 + x4 + 43) % 10007;
+	x1 = (x5 * 7 + x6 + 43) % 10007;
+	x7 = (x0 + x7 + 58) % 10007;
+	x2 = (x0 + x7 + 99) % 10007;
+	x6 = (x3 * 5 + x4 + 1) % 10007;
+	x6 = (x0 + x1 + 52) % 10007;
+	x6 = (x5 + x3 + 47) % 10007;
+	x0 = (x6 + x3 + 79) % 10007;
+	x6 = (x3 + x1 + 2) % 10007;
+	x1 = (x3 * 4 + x0 + 68) % 10007;
+	x1 = (x3 + x7 + 61) % 10007;
+	x1 = (x3 * 2 + x4 + 29) % 10007;
+	x2 = (x5 + x7 + 31) % 10007;
+	x1 = (x4 + x4 + 90) % 10007;
+	x0 = (x3 + x5 + 91) % 10007;
+	x0 = (x4 * 2 + x5 + 12) % 10007;
+	x6 = (x3 + x5 + 90) % 10007;
+	x4 = (x1 + x0 + 5) % 10007;
+	x5 = (x6 + x0 + 90) % 10007;
+	x3 = (x4 * 3 + x6 + 41) % 10007;
+	x0 = (x4 * 5 + x5 + 67) % 10007;
+	x7 = (x0 * 8 + x5 + 58) % 10007;
+	x0 = (x3 + x6 + 17) % 10007;
+	x7 = (x7 * 5 + x4 + 34) % 10007;
+	x4 = (x5 + x6 + 33) % 10007;
+	x1 = (x7 * 5 + x1 + 1) % 10007;
+	x6 = (x4 * 5 + x4 + 59) % 10007;
+	x5 = (x0 * 4 + x2 + 62) % 10007;
+	x4 = (x4 + x5 + 87) % 10007;
+	x3 = (x1 + x4 + 82) % 10007;
+	x5 = (x2 * 8 + x1 + 92) % 10007;
+	x0 = (x3 * 4 + x5 + 58) % 10007;
+	x6 = (x6 * 8 + x6 + 4) % 10007;
+	x1 = (x7 * 3 + x0 + 1) % 10007;
+	x0 = (x4 * 8 + x3 + 29) % 10007;
+	x3 = (x5 + x2 + 91) % 10007;
+	x5 = (x4 * 5 + x6 + 77) % 10007;
+	x1 = (x0 * 4 + x6 + 33) % 10007;
+	x4 = (x3 * 7 + x5 + 63) % 10007;
+	x6 = (x6 * 4 + x3 + 96) % 10007;
+	x1 = (x3 * 5 + x7 + 81) % 10007;
+	x6 = (x2 + x3 + 78) % 10007;
+	x4 = (x3 * 2 + x4 + 89) % 10007;
+	x4 = (x1 + x3 + 98) % 10007;
+	x4 = (x4 * 6 + x4 + 75) % 10007;
+	x0 = (x2 * 7 + x5 + 66) % 10007;
+	x5 = (x3 + x3 + 25) % 10007;
+	x7 = (x5 * 9 + x7 + 73) % 10007;
+	x1 = (x6 * 6 + x2 + 50) % 10007;
+	x4 = (x6 * 6 + x0 + 93) % 10007;
+	x4 = (x4 + x1 + 82) % 10007;
+	x5 = (x6 * 7 + x0 + 45) % 10007;
+	x7 = (x2 * 8 + x4 + 15) % 10007;
+	x3 = (x1 + x4 + 35) % 10007;
+	x5 = (x4 + x4 + 44) % 10007;
+	x7 = (x1 * 3 + x6 + 43) % 10007;
+	x0 = (x0 * 6 + x2 + 26) % 10007;
+	x3 = (x5 * 4 + x7 + 30) % 10007;
+	x5 = (x6 * 6 + x3 + 51) % 10007;
+	x7 = (x7 * 9 + x0 + 21) % 10007;
+	x4 = (x5 * 2 + x5 + 94) % 10007;
+	x5 = (x3 * 4 + x0 + 13) % 10007;
+	x5 = (x6 * 3 + x4 + 13) % 10007;
+	x1 = (x4 + x6 + 75) % 10007;
+	x4 = (x6 + x7 + 90) % 10007;
+	x5 = (x6 + x3 + 41) % 10007;
+	x1 = (x4 * 8 + x3 + 10) % 10007;
+	x5 = (x6 * 9 + x0 + 49) % 10007;
+	x5 = (x6 + x6 + 97) % 10007;
+	x5 = (x4 * 4 + x2 + 72) % 10007;
+	x3 = (x0 + x0 + 27) % 10007;
+	x2 = (x0 + x1 + 98) % 10007;
+	x6 = (x4 + x0 + 64) % 10007;
+	x4 = (x4 * 7 + x2 + 19) % 10007;
+	x4 = (x4 * 9 + x0 + 74) % 10007;
+	x7 = (x4 + x3 + 3) % 10007;
+	x4 = (x5 + x3 + 61) % 10007;
+	x6 = (x1 + x0 + 55) % 10007;
+	x7 = (x7 + x5 + 64) % 10007;
+	x0 = (x3 + x4 + 77) % 10007;
+	x7 = (x6 * 6 + x4 + 69) % 10007;
+	x0 = (x0 * 5 + x3 + 35) % 10007;
+	x7 = (x1 * 8 + x5 + 53) % 10007;
+	x3 = (x0 + x1 + 55) % 10007;
+	x1 = (x5 * 2 + x7 + 53) % 10007;
+	x1 = (x1 * 3 + x0 + 68) % 10007;
+	x4 = (x2 * 2 + x6 + 63) % 10007;
+	x5 = (x4 + x1 + 94) % 10007;
+	x3 = (x3 * 9 + x2 + 72) % 10007;
+	x3 = (x1 * 8 + x1 + 11) % 10007;
+	x6 = (x4 + x2 + 60) % 10007;
+	x4 = (x6 + x0 + 5) % 10007;
+	x6 = (x2 + x2 + 37) % 10007;
+	x5 = (x6 * 9 + x1 + 42) % 10007;
+	x5 = (x3 * 7 + x2 + 71) % 10007;
+	x6 = (x2 * 7 + x4 + 21) % 10007;
+	x4 = (x0 * 9 + x5 + 88) % 10007;
+	x7 = (x6 + x2 + 47) % 10007;
+	x4 = (x0 + x6 + 94) % 10007;
+	x1 = (x1 + x0 + 15) % 10007;
+	x5 = (x7 * 3 + x1 + 34) % 10007;
+	x1 = (x4 + x0 + 64) % 10007;
+	x5 = (x3 + x4 + 2) % 10007;
+	x5 = (x0 + x0 + 77) % 10007;
+	x0 = (x2 + x4 + 52) % 10007;
+	x5 = (x4 + x3 + 33) % 10007;
+	x3 = (x7 + x5 + 7) % 10007;
+	x1 = (x0 + x1 + 99) % 10007;
+	x2 = (x0 * 4 + x7 + 24) % 10007;
+	x3 = (x4 * 4 + x6 + 78) % 10007;
+	x0 = (x2 * 5 + x3 + 70) % 10007;
+	x4 = (x1 * 5 + x5 + 73) % 10007;
+	x3 = (x7 + x1 + 24) % 10007;
+	x5 = (x3 * 4 + x2 + 37) % 10007;
+	x2 = (x4 + x0 + 1) % 10007;
+	x3 = (x3 + x5 + 42) % 10007;
+	x6 = (x6 * 2 + x2 + 22) % 10007;
+	x2 = (x5 * 5 + x6 + 5) % 10007;
+	x4 = (x0 + x5 + 4) % 10007;
+	x5 = (x6 + x5 + 49) % 10007;
+	x2 = (x3 + x5 + 59) % 10007;
+	x6 = (x0 * 9 + x2 + 27) % 10007;
+	x1 = (x3 + x7 + 20) % 10007;
+	x1 = (x3 + x1 + 89) % 10007;
+	x2 = (x2 * 7 + x3 + 83) % 10007;
+	x1 = (x4 * 2 + x6 + 24) % 10007;
+	x1 = (x4 + x1 + 39) % 10007;
+	x0 = (x7 * 8 + x2 + 69) % 10007;
+	x5 = (x2 * 3 + x1 + 13) % 10007;
+	x5 = (x6 * 7 + x3 + 16) % 10007;
+	x5 = (x6 + x1 + 9) % 10007;
+	x1 = (x4 * 7 + x7 + 8) % 10007;
+	x5 = (x6 + x6 + 14) % 10007;
+	x0 = (x1 + x0 + 62) % 10007;
+	x0 = (x0 * 7 + x2 + 7) % 10007;
+	x1 = (x0 + x4 + 40) % 10007;
+	x4 = (x4 + x2 + 55) % 10007;
+	x3 = (x6 * 7 + x0 + 6) % 10007;
+	x2 = (x6 * 2 + x4 + 89) % 10007;
+	x4 = (x2 + x3 + 83) % 10007;
+	x4 = (x2 * 8 + x4 + 11) % 10007;
+	x4 = (x4 * 8 + x5 + 73) % 10007;
+	x3 = (x0 + x1 + 8) % 10007;
+	x1 = (x4 * 4 + x3 + 58) % 10007;
+	x6 = (x7 * 7 + x6 + 71) % 10007;
+	x6 = (x3 * 5 + x7 + 28) % 10007;
+	x0 = (x4 * 8 + x3 + 34) % 10007;
+	x5 = (x2 * 8 + x1 + 54) % 10007;
+	x3 = (x4 * 7 + x7 + 48) % 10007;
+	x7 = (x6 + x1 + 48) % 10007;
+	x4 = (x6 + x7 + 41) % 10007;
+	x3 = (x7 + x6 + 21) % 10007;
+	x3 = (x7 + x1 + 67) % 10007;
+	x5 = (x5 * 2 + x3 + 53) % 10007;
+	x6 = (x1 * 5 + x3 + 98) % 10007;
+	x2 = (x7 + x6 + 90) % 10007;
+	x0 = (x3 + x2 + 35) % 10007;
+	x5 = (x2 * 6 + x0 + 97) % 10007;
+	x3 = (x7 + x0 + 37) % 10007;
+	x6 = (x2 * 9 + x6 + 58) % 10007;
+	x5 = (x6 * 4 + x6 + 74) % 10007;
+	x5 = (x1 * 9 + x5 + 56) % 10007;
+	x4 = (x7 * 7 + x7 + 27) % 10007;
+	x0 = (x1 * 7 + x0 + 84) % 10007;
+	x2 = (x7 + x1 + 4) % 10007;
+	x3 = (x4 + x3 + 42) % 10007;
+	x5 = (x6 * 2 + x5 + 94) % 10007;
+	x0 = (x2 + x7 + 92) % 10007;
+	x3 = (x4 * 2 + x4 + 4) % 10007;
+	x0 = (x3 + x1 + 30) % 10007;
+	x2 = (x3 + x0 + 67) % 10007;
+	x1 = (x6 + x2 + 22) % 10007;
+	x4 = (x2 * 5 + x4 + 70) % 10007;
+	x2 = (x7 + x1 + 68) % 10007;
+	x0 = (x4 * 7 + x6 + 21) % 10007;
+	x7 = (x2 * 3 + x3 + 44) % 10007;
+	x1 = (x3 + x4 + 15) % 10007;
+	x6 = (x1 + x2 + 8) % 10007;
+	x5 = (x6 + x5 + 32) % 10007;
+	x6 = (x0 * 3 + x2 + 96) % 10007;
+	x6 = (x0 + x2 + 50) % 10007;
+	x7 = (x2 * 6 + x0 + 26) % 10007;
+	x2 = (x0 + x6 + 98) % 10007;
+	x5 = (x4 + x1 + 97) % 10007;
+	x3 = (x1 + x6 + 81) % 10007;
+	x1 = (x7 + x4 + 42) % 10007;
+	x6 = (x0 + x3 + 52) % 10007;
+	x0 = (x4 + x7 + 29) % 10007;
+	x5 = (x4 * 6 + x7 + 63) % 10007;
+	x5 = (x0 + x4 + 92) % 10007;
+	x3 = (x7 * 9 + x2 + 64) % 10007;
+	x0 = (x5 * 7 + x2 + 66) % 10007;
+	x7 = (x4 + x2 + 40) % 10007;
+	x3 = (x7 + x0 + 58) % 10007;
+	x0 = (x7 * 3 + x6 + 97) % 10007;
+	x3 = (x2 * 3 + x1 + 93) % 10007;
+	x3 = (x5 * 2 + x5 + 53) % 10007;
+	x5 = (x4 * 5 + x7 + 52) % 10007;
+	x6 = (x7 + x2 + 40) % 10007;
+	x3 = (x5 + x4 + 15) % 10007;
+	x4 = (x6 + x6 + 89) % 10007;
+	x5 = (x4 + x2 + 76) % 10007;
+	x3 = (x7 + x4 + 24) % 10007;
+	x6 = (x3 * 7 + x4 + 78) % 10007;
+	x4 = (x5 * 5 + x6 + 80) % 10007;
+	x3 = (x0 + x0 + 76) % 10007;
+	x5 = (x2 + x7 + 64) % 10007;
+	x1 = (x0 * 2 + x7 + 51) % 10007;
+	x6 = (x1 * 8 + x0 + 24) % 10007;
+	x7 = (x7 * 8 + x4 + 80) % 10007;
+	x6 = (x4 + x1 + 70) % 10007;
+	x3 = (x7 * 9 + x2 + 88) % 10007;
+	x3 = (x2 * 2 + x1 + 21) % 10007;
+	x4 = (x4 + x3 + 56) % 10007;
+	x4 = (x4 * 2 + x6 + 41) % 10007;
+	x1 = (x7 + x0 + 14) % 10007;
+	x7 = (x2 + x3 + 21) % 10007;
+	x1 = (x2 + x6 + 26) % 10007;
+	x7 = (x7 * 2 + x2 + 3) % 10007;
+	x5 = (x3 * 3 + x6 + 78) % 10007;
+	x4 = (x1 + x6 + 66) % 10007;
+	x5 = (x7 + x7 + 59) % 10007;
+	x3 = (x4 + x4 + 34) % 10007;
+	x7 = (x0 + x0 + 2) % 10007;
+	x6 = (x4 * 8 + x7 + 21) % 10007;
+	x1 = (x7 + x3 + 18) % 10007;
+	x5 = (x1 + x4 + 31) % 10007;
+	x1 = (x3 * 5 + x0 + 68) % 10007;
+	x2 = (x3 + x5 + 36) % 10007;
+	x2 = (x4 * 4 + x5 + 42) % 10007;
+	x5 = (x1 + x5 + 64) % 10007;
+	x2 = (x2 + x4 + 2) % 10007;
+	x4 = (x3 + x5 + 10) % 10007;
+	x0 = (x5 * 9 + x4 + 21) % 10007;
+	x1 = (x4 + x2 + 30) % 10007;
+	x0 = (x4 + x5 + 28) % 10007;
+	x1 = (x4 + x5 + 70) % 10007;
+	x0 = (x3 + x3 + 69) % 10007;
+	x3 = (x4 * 3 + x7 + 14) % 10007;
+	x6 = (x6 * 9 + x6 + 73) % 10007;
+	x7 = (x7 + x6 + 68) % 10007;
+	x4 = (x4 + x4 + 38) % 10007;
+	x5 = (x6 + x6 + 36) % 10007;
+	x7 = (x2 * 2 + x0 + 25) % 10007;
+	x0 = (x7 + x2 + 52) % 10007;
+	x6 = (x7 * 2 + x4 + 40) % 10007;
+	x4 = (x7 * 6 + x7 + 52) % 10007;
+	x3 = (x3 * 8 + x2 + 98) % 10007;
+	x6 = (x7 + x7 + 49) % 10007;
+	x0 = (x0 * 6 + x3 + 18) % 10007;
+	x5 = (x5 + x2 + 45) % 10007;
+	x1 = (x2 * 8 + x5 + 34) % 10007;
+	x7 = (x7 * 7 + x0 + 25) % 10007;
+	x2 = (x2 * 5 + x0 + 28) % 10007;
+	x4 = (x5 * 5 + x3 + 70) % 10007;
+	x3 = (x6 * 5 + x3 + 94) % 10007;
+	x3 = (x6 + x6 + 59) % 10007;
+	x4 = (x0 * 9 + x5 + 15) % 10007;
+	x6 = (x2 * 9 + x5 + 33) % 10007;
+	x6 = (x2 + x3 + 13) % 10007;
+	x1 = (x0 * 6 + x1 + 20) % 10007;
+	x7 = (x4 * 6 + x6 + 5) % 10007;
+	x2 = (x6 + x5 + 72) % 10007;
+	x3 = (x4 + x4 + 92) % 10007;
+	x3 = (x0 * 7 + x3 + 52) % 10007;
+	x0 = (x1 + x1 + 21) % 10007;
+	x7 = (x5 * 5 + x0 + 38) % 10007;
+	x6 = (x1 + x3 + 23) % 10007;
+	x7 = (x4 * 9 + x1 + 19) % 10007;
+	x2 = (x0 + x6 + 27) % 10007;
+	x3 = (x5 + x7 + 96) % 10007;
+	x3 = (x7 + x1 + 35) % 10007;
+	x1 = (x7 * 2 + x7 + 57) % 10007;
+	x6 = (x2 + x6 + 2) % 10007;
+	x3 = (x6 * 7 + x0 + 26) % 10007;
+	x7 = (x5 * 5 + x6 + 28) % 10007;
+	x6 = (x5 + x7 + 84) % 10007;
+	x3 = (x2 * 7 + x4 + 28) % 10007;
+	x4 = (x2 * 9 + x2 + 10) % 10007;
+	x3 = (x2 + x5 + 73) % 10007;
+	x0 = (x5 * 2 + x5 + 5) % 10007;
+	x2 = (x0 + x7 + 11) % 10007;
+	x7 = (x7 + x5 + 20) % 10007;
+	x1 = (x4 * 9 + x7 + 22) % 10007;
+	x7 = (x4 + x7 + 66) % 10007;
+	x3 = (x7 + x0 + 54) % 10007;
+	x7 = (x3 + x3 + 55) % 10007;
+	x3 = (x2 * 5 + x0 + 77) % 10007;
+	x1 = (x3 * 7 + x3 + 92) % 10007;
+	x2 = (x6 + x6 + 54) % 10007;
+	x4 = (x3 + x6 + 25) % 10007;
+	x1 = (x4 + x5 + 97) % 10007;
+	x6 = (x4 + x4 + 29) % 10007;
+	x4 = (x1 + x0 + 68) % 10007;
+	x2 = (x2 * 2 + x3 + 94) % 10007;
+	x1 = (x1 * 5 + x4 + 28) % 10007;
+	x7 = (x3 * 8 + x6 + 45) % 10007;
+	x4 = (x1 + x5 + 9) % 10007;
+	x0 = (x5 + x7 + 18) % 10007;
+	x0 = (x1 + x6 + 56) % 10007;
+	x1 = (x1 * 2 + x6 + 37) % 10007;
+	x7 = (x0 * 5 + x1 + 26) % 10007;
+	x6 = (x3 * 8 + x2 + 26) % 10007;
+	x4 = (x3 + x6 + 7) % 10007;
+	x1 = (x0 * 2 + x5 + 71) % 10007;
+	x3 = (x4 + x1 + 81) % 10007;
+	x5 = (x5 + x7 + 91) % 10007;
+	x5 = (x0 * 8 + x5 + 41) % 10007;
+	x6 = (x2 * 7 + x2 + 47) % 10007;
+	x5 = (x0 * 2 + x5 + 58) % 10007;
+	x5 = (x1 + x2 + 79) % 10007;
+	x2 = (x7 * 2 + x4 + 3) % 10007;
+	x5 = (x5 * 7 + x3 + 74) % 10007;
+	x1 = (x2 * 9 + x1 + 70) % 10007;
+	x5 = (x2 + x1 + 77) % 10007;
+	x3 = (x2 + x2 + 64) % 10007;
+	x4 = (x6 + x3 + 20) % 10007;
+	x2 = (x4 * 8 + x5 + 93) % 10007;
+	x7 = (x2 + x1 + 8) % 10007;
+	x3 = (x2 + x3 + 37) % 10007;
+	x1 = (x7 + x1 + 68) % 10007;
+	x1 = (x7 + x4 + 48) % 10007;
+	x3 = (x1 * 2 + x2 + 73) % 10007;
+	x6 = (x0 + x5 + 44) % 10007;
+	x5 = (x0 + x0 + 80) % 10007;
+	x2 = (x1 * 7 + x0 + 43) % 10007;
+	x5 = (x5 * 8 + x2 + 28) % 10007;
+	x5 = (x1 * 2 + x6 + 32) % 10007;
+	x2 = (x2 * 6 + x5 + 16) % 10007;
+	x5 = (x2 * 7 + x0 + 9) % 10007;
+	x7 = (x3 + x3 + 45) % 10007;
+	x6 = (x5 * 6 + x4 + 90) % 10007;
+	x1 = (x6 * 4 + x6 + 26) % 10007;
+	x7 = (x7 * 5 + x0 + 42) % 10007;
+	x7 = (x7 + x1 + 57) % 10007;
+	x2 = (x7 * 4 + x6 + 22) % 10007;
+	x5 = (x4 * 8 + x6 + 11) % 10007;
+	x5 = (x3 * 4 + x6 + 24) % 10007;
+	x1 = (x5 * 6 + x7 + 84) % 10007;
+	x3 = (x1 * 3 + x2 + 6) % 10007;
+	x3 = (x7 * 8 + x5 + 51) % 10007;
+	x5 = (x0 * 3 + x7 + 33) % 10007;
+	x2 = (x6 * 2 + x6 + 60) % 10007;
+	x6 = (x5 + x0 + 29) % 10007;
+	x0 = (x4 + x1 + 37) % 10007;
+	x3 = (x6 * 3 + x7 + 83) % 10007;
+	x6 = (x4 + x3 + 84) % 10007;
+	x1 = (x2 * 8 + x7 + 88) % 10007;
+	x7 = (x3 + x2 + 39) % 10007;
+	x6 = (x7 + x4 + 76) % 10007;
+	x5 = (x7 + x4 + 42) % 10007;
+	x4 = (x2 * 5 + x2 + 51) % 10007;
+	x0 = (x4 * 8 + x5 + 4) % 10007;
+	x6 = (x4 + x6 + 57) % 10007;
+	x0 = (x0 + x3 + 72) % 10007;
+	x0 = (x0 + x7 + 86) % 10007;
+	x4 = (x7 * 4 + x0 + 71) % 10007;
+	x5 = (x0 * 4 + x0 + 5) % 10007;
+	x6 = (x7 + x6 + 97) % 10007;
+	x5 = (x3 * 5 + x6 + 96) % 10007;
+	x7 = (x5 * 8 + x5 + 67) % 10007;
+	x6 = (x2 * 8 + x6 + 16) % 10007;
+	x6 = (x4 * 6 + x6 + 67) % 10007;
+	x1 = (x7 + x3 + 84) % 10007;
+	x7 = (x4 * 2 + x0 + 85) % 10007;
+	x4 = (x4 * 9 + x6 + 53) % 10007;
+	x2 = (x0 + x2 + 20) % 10007;
+	x4 = (x5 * 4 + x5 + 10) % 10007;
+	x3 = (x7 + x7 + 79) % 10007;
+	x2 = (x3 + x3 + 70) % 10007;
+	x6 = (x0 + x5 + 33) % 10007;
+	x2 = (x2 + x6 + 73) % 10007;
+	x4 = (x0 * 2 + x6 + 46) % 10007;
+	x2 = (x6 + x3 + 28) % 10007;
+	x7 = (x2 * 8 + x3 + 81) % 10007;
+	x4 = (x3 + x3 + 59) % 10007;
+	x6 = (x2 * 8 + x4 + 61) % 10007;
+	x5 = (x6 * 5 + x7 + 92) % 10007;
+	x1 = (x5 + x0 + 1) % 10007;
+	x4 = (x7 * 8 + x3 + 37) % 10007;
+	x7 = (x5 + x7 + 22) % 10007;
+	x7 = (x4 * 9 + x5 + 76) % 10007;
+	x5 = (x2 + x5 + 48) % 10007;
+	x5 = (x4 * 3 + x0 + 21) % 10007;
+	x7 = (x2 * 9 + x7 + 76) % 10007;
+	x1 = (x1 * 6 + x5 + 7) % 10007;
+	x7 = (x6 + x5 + 11) % 10007;
+	x2 = (x5 * 7 + x5 + 90) % 10007;
+	x6 = (x3 + x7 + 12) % 10007;
+	x7 = (x1 * 7 + x2 + 93) % 10007;
+	x0 = (x6 * 7 + x1 + 64) % 10007;
+	x0 = (x0 * 7 + x5 + 51) % 10007;
+	x0 = (x2 + x1 + 96) % 10007;
+	x1 = (x4 * 6 + x1 + 56) % 10007;
+	x2 = (x4 * 3 + x0 + 32) % 10007;
+	x2 = (x0 * 9 + x2 + 2) % 10007;
+	x3 = (x3 + x4 + 95) % 10007;
+	x5 = (x5 + x7 + 11) % 10007;
+	x4 = (x4 * 5 + x1 + 14) % 10007;
+	x7 = (x1 + x2 + 12) % 10007;
+	x2 = (x5 + x3 + 1) % 10007;
+	x1 = (x4 * 4 + x6 + 60) % 10007;
+	x4 = (x5 + x2 + 83) % 10007;
+	x3 = (x5 * 3 + x7 + 21) % 10007;
+	x1 = (x0 + x7 + 77) % 10007;
+	x5 = (x1 * 4 + x5 + 20) % 10007;
+	x1 = (x1 + x1 + 30) % 10007;
+	x4 = (x2 + x5 + 26) % 10007;
+	x6 = (x2 + x6 + 11) % 10007;
+	x7 = (x7 + x5 + 79) % 10007;
+	x4 = (x1 * 4 + x1 + 88) % 10007;
+	x3 = (x7 * 6 + x4 + 59) % 10007;
+	x4 = (x7 + x7 + 72) % 10007;
+	x4 = (x5 + x1 + 54) % 10007;
+	x5 = (x4 * 5 + x3 + 36) % 10007;
+	x1 = (x7 * 4 + x4 + 54) % 10007;
+	x0 = (x1 * 3 + x5 + 61) % 10007;
+	x1 = (x4 + x4 + 59) % 10007;
+	x5 = (x4 + x4 + 63) % 10007;
+	x2 = (x7 * 5 + x2 + 25) % 10007;
+	x2 = (x6 + x7 + 92) % 10007;
+	x1 = (x1 + x7 + 99) % 10007;
+	x1 = (x1 * 3 + x7 + 57) % 10007;
+	x0 = (x6 + x1 + 99) % 10007;
+	x3 = (x1 * 8 + x7 + 32) % 10007;
+	x6 = (x4 + x7 + 28) % 10007;
+	x2 = (x4 + x4 + 72) % 10007;
+	x5 = (x6 + x1 + 7) % 10007;
+	x6 = (x0 + x7 + 76) % 10007;
+	x1 = (x5 * 9 + x4 + 48) % 10007;
+	x4 = (x4 * 3 + x0 + 32) % 10007;
+	x1 = (x0 * 8 + x0 + 29) % 10007;
+	x4 = (x5 + x7 + 62) % 10007;
+	x5 = (x0 + x0 + 29) % 10007;
+	x2 = (x3 * 7 + x2 + 12) % 10007;
+	x1 = (x5 + x2 + 51) % 10007;
+	x2 = (x0 * 3 + x0 + 54) % 10007;
+	x2 = (x6 * 7 + x6 + 40) % 10007;
+	x7 = (x2 + x2 + 88) % 10007;
+	x2 = (x6 + x6 + 44) % 10007;
+	x2 = (x1 * 9 + x6 + 35) % 10007;
+	x3 = (x5 * 3 + x5 + 2) % 10007;
+	x5 = (x0 * 5 + x5 + 85) % 10007;
+	x1 = (x4 * 2 + x4 + 84) % 10007;
+	x2 = (x2 * 6 + x3 + 89) % 10007;
+	x0 = (x2 * 2 + x6 + 11) % 10007;
+	x2 = (x4 + x1 + 10) % 10007;
+	x6 = (x7 * 3 + x0 + 81) % 10007;
+	x1 = (x2 * 3 + x0 + 34) % 10007;
+	x0 = (x0 + x3 + 34) % 10007;
+	x5 = (x2 * 6 + x7 + 43) % 10007;
+	x3 = (x0 + x4 + 48) % 10007;
+	x5 = (x3 + x6 + 13) % 10007;
+	x4 = (x0 * 5 + x5 + 83) % 10007;
+	x7 = (x7 * 2 + x1 + 64) % 10007;
+	x7 = (x2 * 7 + x1 + 71) % 10007;
+	x3 = (x2 * 2 + x7 + 73) % 10007;
+	x3 = (x1 * 7 + x0 + 55) % 10007;
+	x4 = (x0 * 9 + x6 + 37) % 10007;
+	x7 = (x6 + x3 + 45) % 10007;
+	x2 = (x4 * 3 + x3 + 77) % 10007;
+	x1 = (x4 + x4 + 79) % 10007;
+	x0 = (x0 * 6 + x2 + 34) % 10007;
+	x6 = (x1 + x0 + 10) % 10007;
+	x5 = (x5 + x5 + 1) % 10007;
+	x1 = (x6 + x4 + 69) % 10007;
+	x4 = (x2 + x7 + 4) % 10007;
+	x4 = (x1 + x6 + 81) % 10007;
+	x5 = (x1 * 5 + x5 + 81) % 10007;
+	x2 = (x0 + x2 + 3) % 10007;
+	x0 = (x0 + x1 + 2) % 10007;
+	x6 = (x2 * 8 + x3 + 89) % 10007;
+	x4 = (x6 * 2 + x4 + 81) % 10007;
+	x3 = (x0 + x6 + 22) % 10007;
+	x4 = (x7 + x7 + 84) % 10007;
+	x6 = (x0 + x6 + 73) % 10007;
+	x2 = (x0 + x4 + 46) % 10007;
+	x1 = (x0 * 5 + x4 + 83) % 10007;
+	x7 = (x4 + x3 + 98) % 10007;
+	x6 = (x3 * 4 + x7 + 58) % 10007;
+	x0 = (x4 * 6 + x5 + 58) % 10007;
+	x2 = (x2 + x1 + 7) % 10007;
+	x3 = (x6 * 5 + x3 + 55) % 10007;
+	x7 = (x0 + x3 + 61) % 10007;
+	x1 = (x1 * 6 + x6 + 70) % 10007;
+	x7 = (x4 * 9 + x7 + 97) % 10007;
+	x1 = (x2 + x4 + 36) % 10007;
+	x0 = (x6 + x1 + 27) % 10007;
+	x4 = (x3 * 2 + x3 + 27) % 10007;
+	x0 = (x7 * 4 + x7 + 21) % 10007;
+	x4 = (x2 * 7 + x4 + 72) % 10007;
+	x7 = (x5 + x0 + 30) % 10007;
+	x7 = (x3 * 5 + x2 + 75) % 10007;
+	x1 = (x2 * 9 + x3 + 6) % 10007;
+	x4 = (x0 + x0 + 4) % 10007;
+	x2 = (x0 + x7 + 42) % 10007;
+	x7 = (x2 * 3 + x3 + 56) % 10007;
+	x4 = (x2 * 6 + x0 + 70) % 10007;
+	x2 = (x1 * 5 + x4 + 98) % 10007;
+	x3 = (x0 + x7 + 69) % 10007;
+	x0 = (x5 + x4 + 40) % 10007;
+	x4 = (x6 * 7 + x2 + 10) % 10007;
+	x0 = (x4 * 2 + x6 + 32) % 10007;
+	x6 = (x2 * 8 + x0 + 75) % 10007;
+	x3 = (x7 * 4 + x6 + 8) % 10007;
+	x6 = (x3 + x6 + 18) % 10007;
+	x5 = (x7 + x6 + 35) % 10007;
+	x6 = (x7 * 3 + x2 + 75) % 10007;
+	x4 = (x7 + x1 + 82) % 10007;
+	x6 = (x5 + x0 + 82) % 10007;
+	x7 = (x5 * 8 + x1 + 83) % 10007;
+	x3 = (x2 + x7 + 44) % 10007;
+	x4 = (x4 + x7 + 41) % 10007;
+	x6 = (x3 + x4 + 58) % 10007;
+	x7 = (x6 + x5 + 33) % 10007;
+	x5 = (x6 * 5 + x5 + 45) % 10007;
+	x1 = (x3 * 9 + x3 + 59) % 10007;
+	x5 = (x6 * 9 + x2 + 63) % 10007;
+	x6 = (x3 + x1 + 26) % 10007;
+	x1 = (x6 * 8 + x6 + 27) % 10007;
+	x4 = (x6 + x6 + 68) % 10007;
+	x0 = (x5 + x6 + 21) % 10007;
+	x0 = (x5 * 3 + x2 + 97) % 10007;
+	x7 = (x2 * 3 + x3 + 64) % 10007;
+	x4 = (x2 + x0 + 68) % 10007;
+	x1 = (x6 * 3 + x2 + 14) % 10007;
+	x4 = (x0 + x1 + 61) % 10007;
+	x0 = (x1 * 2 + x3 + 4) % 10007;
+	x2 = (x6 + x0 + 82) % 10007;
+	x5 = (x1 * 5 + x0 + 45) % 10007;
+	x5 = (x6 + x0 + 61) % 10007;
+	x4 = (x2 + x0 + 55) % 10007;
+	x2 = (x3 + x0 + 52) % 10007;
+	x6 = (x4 * 5 + x4 + 48) % 10007;
+	x2 = (x5 * 6 + x4 + 40) % 10007;
+	x0 = (x4 * 4 + x0 + 41) % 10007;
+	x2 = (x2 * 7 + x5 + 79) % 10007;
+	x2 = (x7 * 6 + x6 + 81) % 10007;
+	x6 = (x5 * 7 + x7 + 21) % 10007;
+	x6 = (x5 * 9 + x3 + 36) % 10007;
+	x4 = (x2 + x5 + 83) % 10007;
+	x1 = (x6 * 8 + x3 + 77) % 10007;
+	x0 = (x3 * 5 + x3 + 9) % 10007;
+	x1 = (x7 + x6 + 47) % 10007;
+	x2 = (x2 * 2 + x4 + 52) % 10007;
+	x2 = (x2 + x7 + 49) % 10007;
+	x5 = (x6 + x3 + 19) % 10007;
+	x3 = (x3 + x6 + 84) % 10007;
+	x2 = (x5 + x1 + 31) % 10007;
+	x6 = (x1 + x1 + 61) % 10007;
+	x6 = (x7 * 5 + x3 + 52) % 10007;
+	x5 = (x6 * 6 + x0 + 3) % 10007;
+	x0 = (x2 * 5 + x5 + 20) % 10007;
+	x4 = (x5 * 5 + x4 + 62) % 10007;
+	x5 = (x3 * 4 + x5 + 30) % 10007;
+	x2 = (x2 + x6 + 42) % 10007;
+	x4 = (x5 * 3 + x5 + 4) % 10007;
+	x7 = (x3 * 8 + x1 + 48) % 10007;
+	x3 = (x4 + x0 + 88) % 10007;
+	x7 = (x1 * 8 + x0 + 78) % 10007;
+	x4 = (x1 * 8 + x1 + 63) % 10007;
+	x4 = (x4 * 2 + x4 + 94) % 10007;
+	x2 = (x0 * 4 + x7 + 33) % 10007;
+	x4 = (x4 * 8 + x6 + 61) % 10007;
+	x1 = (x6 + x1 + 93) % 10007;
+	x1 = (x5 * 5 + x7 + 99) % 10007;
+	x3 = (x0 * 2 + x4 + 9) % 10007;
+	x1 = (x4 * 4 + x0 + 3) % 10007;
+	x3 = (x1 * 8 + x2 + 69) % 10007;
+	x2 = (x6 + x3 + 54) % 10007;
+	x1 = (x4 * 8 + x2 + 51) % 10007;
+	x2 = (x5 + x4 + 26) % 10007;
+	x7 = (x0 * 6 + x7 + 37) % 10007;
+	x3 = (x5 + x1 + 42) % 10007;
+	x6 = (x7 + x4 + 91) % 10007;
+	x1 = (x7 + x5 + 47) % 10007;
+	x7 = (x0 + x7 + 33) % 10007;
+	x3 = (x1 * 8 + x4 + 10) % 10007;
+	x3 = (x5 * 6 + x4 + 60) % 10007;
+	x0 = (x4 * 6 + x0 + 37) % 10007;
+	x5 = (x2 + x1 + 96) % 10007;
+	x5 = (x4 * 3 + x3 + 17) % 10007;
+	x1 = (x2 + x4 + 11) % 10007;
+	x6 = (x4 + x5 + 23) % 10007;
+	x4 = (x2 * 9 + x0 + 94) % 10007;
+	x7 = (x6 + x3 + 66) % 10007;
+	x6 = (x4 + x2 + 90) % 10007;
+	x0 = (x2 + x6 + 46) % 10007;
+	x7 = (x1 + x4 + 3) % 10007;
+	x0 = (x2 + x0 + 63) % 10007;
+	x3 = (x4 * 5 + x1 + 45) % 10007;
+	x3 = (x4 * 6 + x3 + 89) % 10007;
+	x0 = (x0 + x7 + 95) % 10007;
+	x3 = (x7 + x7 + 21) % 10007;
+	x2 = (x5 + x4 + 20) % 10007;
+	x3 = (x3 + x2 + 15) % 10007;
+	x5 = (x1 * 5 + x0 + 33) % 10007;
+	x0 = (x7 * 3 + x0 + 91) % 10007;
+	x6 = (x4 + x4 + 56) % 10007;
+	x6 = (x2 + x4 + 61) % 10007;
+	x4 = (x2 + x6 + 6) % 10007;
+	x3 = (x7 + x5 + 82) % 10007;
+	x0 = (x2 * 8 + x4 + 53) % 10007;
+	x4 = (x3 * 7 + x6 + 66) % 10007;
+	x7 = (x4 + x6 + 54) % 10007;
+	x3 = (x7 * 9 + x0 + 91) % 10007;
+	x2 = (x4 + x1 + 67) % 10007;
+	x2 = (x4 + x4 + 4) % 10007;
+	x0 = (x2 * 2 + x5 + 49) % 10007;
+	x0 = (x0 * 9 + x3 + 23) % 10007;
+	x2 = (x6 * 9 + x5 + 16) % 10007;
+	x0 = (x7 * 3 + x1 + 44) % 10007;
+	x2 = (x1 + x0 + 97) % 10007;
+	x6 = (x2 + x6 + 70) % 10007;
+	x7 = (x6 + x7 + 41) % 10007;
+	x0 = (x2 * 9 + x7 + 18) % 10007;
+	x3 = (x1 + x4 + 90) % 10007;
+	x5 = (x0 * 7 + x6 + 43) % 10007;
+	x2 = (x4 * 7 + x7 + 88) % 10007;
+	x1 = (x6 + x5 + 60) % 10007;
+	x2 = (x6 + x4 + 66) % 10007;
+	x6 = (x4 * 2 + x0 + 61) % 10007;
+	x3 = (x6 * 6 + x1 + 25) % 10007;
+	x5 = (x5 + x0 + 23) % 10007;
+	x2 = (x6 * 2 + x6 + 97) % 10007;
+	x1 = (x3 * 7 + x7 + 96) % 10007;
+	x7 = (x3 * 7 + x3 + 9) % 10007;
+	x0 = (x7 + x0 + 18) % 10007;
+	x2 = (x0 + x0 + 60) % 10007;
+	x5 = (x7 * 5 + x4 + 69) % 10007;
+	x1 = (x5 * 4 + x7 + 99) % 10007;
+	x7 = (x1 + x6 + 32) % 10007;
+	x3 = (x4 + x6 + 26) % 10007;
+	x5 = (x2 * 8 + x6 + 34) % 10007;
+	x4 = (x0 + x5 + 35) % 10007;
+	x1 = (x7 + x3 + 33) % 10007;
+	x2 = (x7 * 7 + x2 + 27) % 10007;
+	x7 = (x6 + x2 + 68) % 10007;
+	x7 = (x1 + x4 + 3) % 10007;
+	x6 = (x0 * 8 + x0 + 40) % 10007;
+	x1 = (x6 + x5 + 16) % 10007;
+	x2 = (x7 + x3 + 52) % 10007;
+	x4 = (x1 * 6 + x4 + 65) % 10007;
+	x4 = (x0 + x4 + 72) % 10007;
+	x7 = (x0 * 2 + x4 + 65) % 10007;
+	x3 = (x0 * 6 + x1 + 78) % 10007;
+	x0 = (x4 + x5 + 99) % 10007;
+	x0 = (x0 * 8 + x7 + 53) % 10007;
+	x0 = (x7 + x7 + 76) % 10007;
+	x4 = (x7 + x5 + 17) % 10007;
+	x3 = (x1 + x7 + 25) % 10007;
+	x5 = (x0 + x5 + 30) % 10007;
+	x0 = (x4 + x7 + 17) % 10007;
+	x3 = (x4 + x2 + 48) % 10007;
+	x6 = (x0 + x3 + 64) % 10007;
+	x2 = (x1 * 4 + x4 + 44) % 10007;
+	x3 = (x6 + x3 + 69) % 10007;
+	x2 = (x7 * 8 + x1 + 96) % 10007;
+	x5 = (x4 + x0 + 4) % 10007;
+	x4 = (x5 + x3 + 22) % 10007;
+	x3 = (x2 * 6 + x7 + 94) % 10007;
+	x4 = (x0 + x5 + 9) % 10007;
+	x1 = (x0 * 4 + x0 + 36) % 10007;
+	x3 = (x0 * 5 + x6 + 32) % 10007;
+	x4 = (x3 + x7 + 9) % 10007;
+	x0 = (x4 + x3 + 56) % 10007;
+	x4 = (x2 * 6 + x4 + 6) % 10007;
+	x6 = (x6 * 8 + x7 + 20) % 10007;
+	x5 = (x4 + x6 + 57) % 10007;
+	x0 = (x1 + x3 + 23) % 10007;
+	x1 = (x3 * 6 + x6 + 76) % 10007;
+	x1 = (x2 * 2 + x0 + 7) % 10007;
+	x1 = (x5 + x5 + 35) % 10007;
+	x4 = (x1 * 6 + x1 + 30) % 10007;
+	x1 = (x6 + x3 + 50) % 10007;
+	x0 = (x5 * 7 + x7 + 50) % 10007;
+	x0 = (x1 + x6 + 82) % 10007;
+	x7 = (x7 + x5 + 61) % 10007;
+	x1 = (x4 + x3 + 46) % 10007;
+	x5 = (x4 * 3 + x5 + 45) % 10007;
+	x7 = (x6 * 4 + x5 + 90) % 10007;
+	x7 = (x4 * 7 + x5 + 76) % 10007;
+	x4 = (x6 * 8 + x6 + 27) % 10007;
+	x0 = (x3 + x4 + 46) % 10007;
+	x0 = (x3 + x1 + 37) % 10007;
+	x7 = (x0 + x5 + 72) % 10007;
+	x6 = (x7 * 2 + x1 + 90) % 10007;
+	x6 = (x2 + x5 + 46) % 10007;
+	x0 = (x4 + x6 + 89) % 10007;
+	x1 = (x6 * 7 + x5 + 67) % 10007;
+	x7 = (x2 + x4 + 30) % 10007;
+	x7 = (x0 * 7 + x1 + 19) % 10007;
+	x4 = (x6 + x3 + 26) % 10007;
+	x0 = (x1 + x6 + 89) % 10007;
+	x0 = (x5 + x0 + 16) % 10007;
+	x7 = (x4 * 2 + x3 + 79) % 10007;
+	x5 = (x0 + x4 + 8) % 10007;
+	x1 = (x7 * 5 + x2 + 90) % 10007;
+	x7 = (x5 + x0 + 41) % 10007;
+	x0 = (x4 + x7 + 84) % 10007;
+	x6 = (x7 * 4 + x3 + 11) % 10007;
+	x1 = (x0 * 8 + x3 + 81) % 10007;
+	x6 = (x7 * 5 + x4 + 76) % 10007;
+	x4 = (x6 + x1 + 45) % 10007;
+	x4 = (x5 + x5 + 81) % 10007;
+	x1 = (x5 * 7 + x4 + 50) % 10007;
+	x5 = (x5 + x3 + 2) % 10007;
+	x7 = (x4 + x0 + 16) % 10007;
+	x6 = (x3 * 6 + x2 + 93) % 10007;
+	x6 = (x2 + x7 + 28) % 10007;
+	x0 = (x6 + x6 + 18) % 10007;
+	x3 = (x6 + x5 + 68) % 10007;
+	x1 = (x2 + x1 + 45) % 10007;
+	x4 = (x6 + x0 + 85) % 10007;
+	x0 = (x4 + x7 + 37) % 10007;
+	x3 = (x1 + x3 + 98) % 10007;
+	x4 = (x3 + x0 + 77) % 10007;
+	x3 = (x3 + x7 + 45) % 10007;
+	x1 = (x2 + x5 + 11) % 10007;
+	x6 = (x2 * 8 + x2 + 29) % 10007;
+	x3 = (x4 * 3 + x5 + 51) % 10007;
+	x4 = (x4 + x2 + 90) % 10007;
+	x1 = (x5 + x7 + 73) % 10007;
+	x0 = (x5 + x6 + 4) % 10007;
+	x4 = (x6 + x5 + 16) % 10007;
+	x5 = (x3 * 9 + x4 + 6) % 10007;
+	x2 = (x3 + x0 + 71) % 10007;
+	x6 = (x3 + x2 + 49) % 10007;
+	x0 = (x6 + x5 + 18) % 10007;
+	x2 = (x6 * 6 + x5 + 3) % 10007;
+	x4 = (x4 * 5 + x2 + 3) % 10007;
+	x6 = (x7 * 7 + x2 + 30) % 10007;
+	x7 = (x7 * 4 + x6 + 92) % 10007;
+	x3 = (x3 + x5 + 90) % 10007;
+	x6 = (x0 + x4 + 64) % 10007;
+	x1 = (x6 + x7 + 83) % 10007;
+	x6 = (x6 + x6 + 59) % 10007;
+	x5 = (x4 * 4 + x7 + 49) % 10007;
+	x2 = (x5 * 8 + x7 + 37) % 10007;
+	x4 = (x3 + x1 + 89) % 10007;
+	x6 = (x2 * 6 + x2 + 71) % 10007;
+	x2 = (x4 * 2 + x5 + 35) % 10007;
+	x2 = (x2 * 2 + x4 + 60) % 10007;
+	x4 = (x7 + x1 + 9) % 10007;
+	x7 = (x2 + x2 + 55) % 10007;
+	x4 = (x5 * 7 + x5 + 72) % 10007;
+	x5 = (x6 + x4 + 9) % 10007;
+	x3 = (x5 * 6 + x1 + 74) % 10007;
+	x6 = (x6 + x6 + 99) % 10007;
+	x4 = (x2 * 5 + x1 + 87) % 10007;
+	x5 = (x4 * 6 + x6 + 86) % 10007;
+	x6 = (x7 + x3 + 89) % 10007;
+	x3 = (x7 * 7 + x2 + 24) % 10007;
+	x1 = (x7 * 8 + x2 + 91) % 10007;
+	x7 = (x4 * 7 + x5 + 49) % 10007;
+	x5 = (x3 + x7 + 45) % 10007;
+	x4 = (x0 * 5 + x0 + 1) % 10007;
+	x5 = (x1 + x6 + 98) % 10007;
+	x1 = (x2 + x6 + 51) % 10007;
+	x5 = (x2 * 8 + x6 + 70) % 10007;
+	x2 = (x0 * 9 + x4 + 24) % 10007;
+	x1 = (x5 * 8 + x7 + 41) % 10007;
+	x3 = (x7 + x3 + 32) % 10007;
+	x3 = (x4 + x5 + 62) % 10007;
+	x6 = (x6 + x1 + 92) % 10007;
+	x5 = (x7 * 6 + x3 + 12) % 10007;
+	x0 = (x3 * 9 + x3 + 61) % 10007;
+	x0 = (x4 * 2 + x7 + 95) % 10007;
+	x1 = (x6 + x7 + 19) % 10007;
+	x2 = (x1 * 4 + x0 + 22) % 10007;
+	x6 = (x5 + x1 + 51) % 10007;
+	x2 = (x7 * 9 + x7 + 97) % 10007;
+	x1 = (x7 + x3 + 28) % 10007;
+	x1 = (x7 + x1 + 2) % 10007;
+	x4 = (x5 + x3 + 34) % 10007;
+	x3 = (x3 * 7 + x4 + 24) % 10007;
+	x4 = (x4 + x6 + 67) % 10007;
+	x1 = (x2 * 3 + x3 + 21) % 10007;
+	x1 = (x0 + x6 + 74) % 10007;
+	x3 = (x0 + x5 + 39) % 10007;
+	x2 = (x1 + x2 + 58) % 10007;
+	x3 = (x2 * 8 + x4 + 57) % 10007;
+	x6 = (x3 + x3 + 37) % 10007;
+	x2 = (x2 + x0 + 87) % 10007;
+	x5 = (x7 * 2 + x5 + 9) % 10007;
+	x5 = (x0 + x6 + 64) % 10007;
+	x1 = (x7 * 9 + x3 + 36) % 10007;
+	x5 = (x6 * 9 + x7 + 82) % 10007;
+	x5 = (x2 * 3 + x6 + 13) % 10007;
+	x3 = (x5 * 7 + x5 + 52) % 10007;
+	x6 = (x3 * 3 + x6 + 10) % 10007;
+	x1 = (x2 + x4 + 85) % 10007;
+	x0 = (x0 + x2 + 55) % 10007;
+	x5 = (x0 * 8 + x7 + 55) % 10007;
+	x1 = (x5 * 9 + x7 + 18) % 10007;
+	x6 = (x6 * 7 + x0 + 49) % 10007;
+	x2 = (x5 + x3 + 64) % 10007;
+	x5 = (x1 + x1 + 9) % 10007;
+	x4 = (x5 + x7 + 69) % 10007;
+	x5 = (x4 + x1 + 95) % 10007;
+	x5 = (x6 * 2 + x3 + 67) % 10007;
+	x1 = (x1 * 8 + x1 + 34) % 10007;
+	x3 = (x2 + x1 + 10) % 10007;
+	x0 = (x4 + x6 + 36) % 10007;
+	x2 = (x5 * 5 + x1 + 22) % 10007;
+	x4 = (x3 + x3 + 2) % 10007;
+	x1 = (x0 * 8 + x1 + 2) % 10007;
+	x3 = (x2 * 2 + x3 + 54) % 10007;
+	x4 = (x7 + x3 + 48) % 10007;
+	x4 = (x0 * 3 + x2 + 32) % 10007;
+	x5 = (x6 * 5 + x0 + 20) % 10007;
+	x4 = (x3 * 8 + x1 + 87) % 10007;
+	x6 = (x0 * 7 + x2 + 84) % 10007;
+	x0 = (x1 * 6 + x0 + 95) % 10007;
+	x6 = (x5 + x3 + 42) % 10007;
+	x4 = (x4 + x4 + 87) % 10007;
+	x6 = (x6 + x4 + 35) % 10007;
+	x2 = (x4 + x6 + 42) % 10007;
+	x6 = (x2 + x7 + 11) % 10007;
+	x5 = (x6 + x2 + 39) % 10007;
+	x6 = (x7 * 8 + x1 + 23) % 10007;
+	x5 = (x0 * 8 + x7 + 42) % 10007;
+	x4 = (x2 * 9 + x2 + 9) % 10007;
+	x2 = (x0 * 2 + x6 + 76) % 10007;
+	x0 = (x0 + x7 + 80) % 10007;
+	x7 = (x1 + x7 + 85) % 10007;
+	x5 = (x0 * 2 + x4 + 95) % 10007;
+	x2 = (x2 + x7 + 61) % 10007;
+	x4 = (x2 + x1 + 85) % 10007;
+	x2 = (x4 * 5 + x3 + 25) % 10007;
+	x6 = (x5 * 6 + x4 + 67) % 10007;
+	x6 = (x3 * 7 + x3 + 34) % 10007;
+	x0 = (x4 + x5 + 66) % 10007;
+	x3 = (x7 + x7 + 84) % 10007;
+	x5 = (x3 * 6 + x0 + 46) % 10007;
+	x5 = (x7 * 4 + x3 + 79) % 10007;
+	x5 = (x3 + x7 + 72) % 10007;
+	x7 = (x6 + x0 + 34) % 10007;
+	x5 = (x2 + x4 + 10) % 10007;
+	x3 = (x6 * 9 + x7 + 63) % 10007;
+	x5 = (x7 + x5 + 34) % 10007;
+	x2 = (x7 + x5 + 44) % 10007;
+	x6 = (x2 * 7 + x2 + 62) % 10007;
+	x3 = (x6 + x1 + 93) % 10007;
+	x7 = (x5 + x0 + 63) % 10007;
+	x2 = (x1 + x2 + 85) % 10007;
+	x5 = (x3 + x5 + 48) % 10007;
+	x0 = (x2 * 5 + x2 + 10) % 10007;
+	x6 = (x6 * 5 + x6 + 53) % 10007;
+	x6 = (x5 * 4 + x3 + 70) % 10007;
+	x0 = (x3 + x0 + 28) % 10007;
+	x1 = (x4 + x3 + 68) % 10007;
+	x2 = (x3 * 4 + x6 + 46) % 10007;
+	x3 = (x4 * 4 + x6 + 93) % 10007;
+	x5 = (x0 * 2 + x4 + 31) % 10007;
+	x6 = (x0 * 5 + x6 + 60) % 10007;
+	x2 = (x4 * 9 + x4 + 27) % 10007;
+	x5 = (x5 + x1 + 74) % 10007;
+	x1 = (x7 * 9 + x5 + 16) % 10007;
+	x2 = (x4 * 8 + x1 + 15) % 10007;
+	x7 = (x3 * 8 + x2 + 70) % 10007;
+	x5 = (x7 + x6 + 91) % 10007;
+	x4 = (x3 * 6 + x5 + 29) % 10007;
+	x6 = (x6 * 8 + x3 + 5) % 10007;
+	x6 = (x0 * 3 + x5 + 51) % 10007;
+	x7 = (x6 * 8 + x2 + 34) % 10007;
+	x0 = (x7 * 7 + x0 + 90) % 10007;
+	x3 = (x5 * 8 + x5 + 89) % 10007;
+	x4 = (x5 * 2 + x7 + 83) % 10007;
+	x7 = (x6 + x0 + 19) % 10007;
+	x4 = (x0 * 4 + x7 + 72) % 10007;
+	x2 = (x0 + x0 + 19) % 10007;
+	x3 = (x2 * 3 + x1 + 46) % 10007;
+	x4 = (x3 + x3 + 66) % 10007;
+	x7 = (x0 * 2 + x5 + 38) % 10007;
+	x7 = (x6 * 3 + x1 + 51) % 10007;
+	x6 = (x7 + x5 + 61) % 10007;
+	x5 = (x1 * 6 + x2 + 65) % 10007;
+	x3 = (x6 * 8 + x7 + 93) % 10007;
+	x0 = (x6 * 5 + x5 + 87) % 10007;
+	x6 = (x0 + x0 + 30) % 10007;
+	x1 = (x2 * 3 + x1 + 53) % 10007;
+	x5 = (x4 * 6 + x1 + 5) % 10007;
+	x0 = (x5 * 2 + x7 + 6) % 10007;
+	x3 = (x3 + x4 + 40) % 10007;
+	x6 = (x1 + x2 + 57) % 10007;
+	x3 = (x0 + x4 + 86) % 10007;
+	x2 = (x3 * 4 + x2 + 74) % 10007;
+	x2 = (x1 + x4 + 17) % 10007;
+	x5 = (x6 + x6 + 31) % 10007;
+	x6 = (x7 * 6 + x3 + 43) % 10007;
+	x7 = (x6 + x5 + 41) % 10007;
+	x6 = (x4 + x4 + 93) % 10007;
+	x7 = (x5 + x7 + 54) % 10007;
+	x4 = (x6 + x5 + 47) % 10007;
+	x5 = (x2 * 2 + x6 + 9) % 10007;
+	x7 = (x7 + x5 + 49) % 10007;
+	x4 = (x6 + x3 + 75) % 10007;
+	x6 = (x1 * 9 + x7 + 2) % 10007;
+	x1 = (x0 * 3 + x0 + 19) % 10007;
+	x4 = (x5 + x6 + 39) % 10007;
+	x5 = (x4 + x5 + 10) % 10007;
+	x2 = (x1 * 3 + x6 + 35) % 10007;
+	x1 = (x3 + x7 + 10) % 10007;
+	x1 = (x3 + x6 + 10) % 10007;
+	x6 = (x1 * 9 + x4 + 54) % 10007;
+	x4 = (x0 + x5 + 56) % 10007;
+	x1 = (x0 * 8 + x6 + 35) % 10007;
+	x0 = (x4 * 9 + x5 + 23) % 10007;
+	x6 = (x5 + x6 + 4) % 10007;
+	x4 = (x6 + x7 + 77) % 10007;
+	x7 = (x5 * 9 + x5 + 70) % 10007;
+	x6 = (x6 + x1 + 38) % 10007;
+	x0 = (x7 * 4 + x4 + 18) % 10007;
+	x5 = (x4 * 5 + x0 + 94) % 10007;
+	x3 = (x0 + x5 + 4) % 10007;
+	x2 = (x4 + x4 + 37) % 10007;
+	x1 = (x5 * 6 + x3 + 5) % 10007;
+	x1 = (x6 + x1 + 16) % 10007;
+	x2 = (x1 + x3 + 28) % 10007;
+	x6 = (x1 + x7 + 83) % 10007;
+	x0 = (x2 * 2 + x5 + 86) % 10007;
+	x5 = (x1 + x0 + 95) % 10007;
+	x1 = (x3 + x3 + 85) % 10007;
+	x5 = (x0 + x3 + 5) % 10007;
+	x0 = (x6 * 7 + x7 + 91) % 10007;
+	x1 = (x1 + x0 + 80) % 10007;
+	x3 = (x7 + x3 + 77) % 10007;
+	x3 = (x2 + x2 + 72) % 10007;
+	x7 = (x0 + x7 + 13) % 10007;
+	x3 = (x7 * 7 + x3 + 45) % 10007;
+	x5 = (x3 + x7 + 66) % 10007;
+	x4 = (x1 * 4 + x5 + 4) % 10007;
+	x0 = (x1 + x4 + 29) % 10007;
+	x2 = (x3 * 8 + x6 + 24) % 10007;
+	x3 = (x4 * 8 + x6 + 42) % 10007;
+	x1 = (x7 + x4 + 97) % 10007;
+	x3 = (x1 + x1 + 33) % 10007;
+	x0 = (x7 + x5 + 90) % 10007;
+	x6 = (x5 * 9 + x7 + 30) % 10007;
+	x5 = (x3 * 7 + x7 + 85) % 10007;
+	x7 = (x7 * 7 + x2 + 58) % 10007;
+	x2 = (x2 * 3 + x6 + 66) % 10007;
+	x7 = (x1 * 8 + x0 + 72) % 10007;
+	x0 = (x5 + x7 + 32) % 10007;
+	x0 = (x3 + x5 + 9) % 10007;
+	x2 = (x2 * 3 + x2 + 92) % 10007;
+	x2 = (x4 + x1 + 11) % 10007;
+	x7 = (x7 * 3 + x1 + 8) % 10007;
+	x4 = (x6 + x7 + 29) % 10007;
+	x4 = (x6 + x2 + 32) % 10007;
+	x0 = (x0 + x3 + 74) % 10007;
+	x4 = (x6 + x7 + 60) % 10007;
+	x5 = (x2 + x4 + 87) % 10007;
+	x1 = (x5 + x0 + 61) % 10007;
+	x0 = (x1 + x2 + 31) % 10007;
+	x3 = (x6 + x5 + 12) % 10007;
+	x2 = (x1 + x5 + 64) % 10007;
+	x7 = (x0 * 5 + x1 + 37) % 10007;
+	x6 = (x3 * 3 + x6 + 19) % 10007;
+	x0 = (x2 * 7 + x5 + 77) % 10007;
+	x2 = (x6 * 8 + x0 + 15) % 10007;
+	x0 = (x2 + x0 + 9) % 10007;
+	x2 = (x5 * 7 + x7 + 11) % 10007;
+	x5 = (x7 + x1 + 34) % 10007;
+	x1 = (x0 + x5 + 89) % 10007;
+	x7 = (x3 + x0 + 22) % 10007;
+	x2 = (x0 + x1 + 74) % 10007;
+	x6 = (x0 * 4 + x4 + 25) % 10007;
+	x2 = (x4 + x4 + 1) % 10007;
+	x6 = (x1 + x1 + 80) % 10007;
+	x5 = (x7 + x6 + 95) % 10007;
+	x6 = (x7 + x7 + 88) % 10007;
+	x2 = (x1 * 9 + x2 + 92) % 10007;
+	x0 = (x6 + x6 + 12) % 10007;
+	x0 = (x1 * 5 + x7 + 91) % 10007;
+	x0 = (x0 * 8 + x1 + 85) % 10007;
+	x6 = (x4 * 9 + x1 + 10) % 10007;
+	x1 = (x0 * 8 + x2 + 56) % 10007;
+	x0 = (x6 + x1 + 40) % 10007;
+	x0 = (x6 * 9 + x2 + 37) % 10007;
+	x0 = (x5 + x5 + 53) % 10007;
+	x5 = (x3 * 7 + x7 + 9) % 10007;
+	x2 = (x7 + x6 + 73) % 10007;
+	x5 = (x1 + x3 + 91) % 10007;
+	x5 = (x1 + x2 + 35) % 10007;
+	x7 = (x6 + x7 + 48) % 10007;
+	x1 = (x6 * 3 + x5 + 19) % 10007;
+	x5 = (x1 * 6 + x0 + 95) % 10007;
+	x1 = (x4 * 6 + x2 + 9) % 10007;
+	x3 = (x0 + x4 + 12) % 10007;
+	x4 = (x0 + x1 + 51) % 10007;
+	x6 = (x7 * 5 + x3 + 27) % 10007;
+	x2 = (x6 + x2 + 22) % 10007;
+	x5 = (x4 * 2 + x2 + 5) % 10007;
+	x7 = (x5 * 4 + x4 + 17) % 10007;
+	x3 = (x4 + x6 + 60) % 10007;
+	x7 = (x1 * 7 + x4 + 37) % 10007;
+	x2 = (x4 * 4 + x7 + 81) % 10007;
+	x4 = (x3 + x5 + 94) % 10007;
+	x5 = (x2 + x2 + 4) % 10007;
+	x1 = (x7 + x1 + 68) % 10007;
+	x0 = (x5 * 7 + x0 + 87) % 10007;
+	x4 = (x3 + x5 + 84) % 10007;
+	x4 = (x6 * 3 + x1 + 44) % 10007;
+	x7 = (x3 + x6 + 19) % 10007;
+	x1 = (x4 + x1 + 93) % 10007;
+	x5 = (x0 + x5 + 53) % 10007;
+	x0 = (x7 + x0 + 77) % 10007;
+	x6 = (x7 + x7 + 88) % 10007;
+	x7 = (x3 + x6 + 2) % 10007;
+	x2 = (x7 * 4 + x5 + 30) % 10007;
+	x5 = (x2 + x2 + 36) % 10007;
+	x7 = (x2 + x0 + 29) % 10007;
+	x2 = (x5 + x0 + 25) % 10007;
+	x3 = (x2 * 6 + x2 + 16) % 10007;
+	x1 = (x1 + x2 + 25) % 10007;
+	x5 = (x0 + x0 + 96) % 10007;
+	x7 = (x4 + x0 + 39) % 10007;
+	x7 = (x6 + x7 + 52) % 10007;
+	x2 = (x0 + x3 + 74) % 10007;
+	x4 = (x5 * 8 + x7 + 46) % 10007;
+	x3 = (x6 * 5 + x4 + 68) % 10007;
+	x0 = (x0 * 8 + x3 + 5) % 10007;
+	x5 = (x1 * 3 + x4 + 49) % 10007;
+	x0 = (x3 + x1 + 73) % 10007;
+	x4 = (x3 * 8 + x2 + 27) % 10007;
+	x3 = (x4 + x4 + 81) % 10007;
+	x0 = (x1 * 8 + x0 + 78) % 10007;
+	x0 = (x3 * 6 + x3 + 11) % 10007;
+	x4 = (x0 * 4 + x2 + 80) % 10007;
+	x2 = (x4 + x1 + 2) % 10007;
+	x6 = (x6 + x3 + 19) % 10007;
+	x7 = (x3 + x4 + 35) % 10007;
+	x6 = (x0 * 2 + x2 + 16) % 10007;
+	x6 = (x7 * 6 + x4 + 32) % 10007;
+	x7 = (x6 + x3 + 15) % 10007;
+	x7 = (x5 + x5 + 76) % 10007;
+	x7 = (x3 + x6 + 79) % 10007;
+	x6 = (x3 * 9 + x4 + 7) % 10007;
+	x6 = (x1 * 6 + x5 + 6) % 10007;
+	x5 = (x0 + x2 + 7) % 10007;
+	x7 = (x4 + x2 + 12) % 10007;
+	x7 = (x6 + x5 + 83) % 10007;
+	x7 = (x6 * 8 + x1 + 80) % 10007;
+	x1 = (x7 + x7 + 10) % 10007;
+	x3 = (x1 + x6 + 46) % 10007;
+	x4 = (x0 * 9 + x2 + 28) % 10007;
+	x1 = (x2 + x6 + 76) % 10007;
+	x0 = (x5 + x3 + 57) % 10007;
+	x7 = (x5 + x1 + 96) % 10007;
+	x5 = (x6 + x6 + 5) % 10007;
+	x2 = (x2 + x7 + 71) % 10007;
+	x5 = (x0 * 3 + x5 + 37) % 10007;
+	x6 = (x5 * 3 + x3 + 98) % 10007;
+	x5 = (x2 * 5 + x2 + 57) % 10007;
+	x5 = (x5 * 2 + x3 + 9) % 10007;
+	x7 = (x6 + x4 + 16) % 10007;
+	x1 = (x3 * 2 + x0 + 86) % 10007;
+	x1 = (x2 + x1 + 8) % 10007;
+	x2 = (x1 + x4 + 98) % 10007;
+	x5 = (x3 * 4 + x4 + 69) % 10007;
+	x5 = (x2 * 7 + x4 + 70) % 10007;
+	x0 = (x5 * 8 + x3 + 83) % 10007;
+	x2 = (x6 * 7 + x7 + 66) % 10007;
+	x5 = (x6 + x2 + 9) % 10007;
+	x1 = (x5 * 3 + x5 + 93) % 10007;
+	x2 = (x1 * 4 + x2 + 81) % 10007;
+	x7 = (x1 + x5 + 48) % 10007;
+	x0 = (x2 * 7 + x7 + 80) % 10007;
+	x5 = (x0 * 3 + x4 + 90) % 10007;
+	x0 = (x6 + x1 + 98) % 10007;
+	x0 = (x7 * 8 + x2 + 80) % 10007;
+	x5 = (x7 + x4 + 87) % 10007;
+	x0 = (x3 * 3 + x6 + 51) % 10007;
+	x2 = (x6 + x2 + 67) % 10007;
+	x2 = (x5 * 3 + x7 + 73) % 10007;
+	x2 = (x0 + x4 + 24) % 10007;
+	x0 = (x1 + x4 + 72) % 10007;
+	x2 = (x6 + x2 + 26) % 10007;
+	x2 = (x4 * 8 + x6 + 40) % 10007;
+	x5 = (x6 * 2 + x2 + 16) % 10007;
+	x4 = (x0 * 4 + x7 + 46) % 10007;
+	x2 = (x1 + x1 + 78) % 10007;
+	x3 = (x6 * 6 + x4 + 28) % 10007;
+	x6 = (x5 + x3 + 23) % 10007;
+	x1 = (x1 * 9 + x2 + 92) % 10007;
+	x7 = (x0 + x0 + 12) % 10007;
+	x4 = (x4 * 5 + x6 + 5) % 10007;
+	x6 = (x3 * 9 + x3 + 60) % 10007;
+	x6 = (x0 * 7 + x2 + 44) % 10007;
+	x3 = (x3 + x2 + 50) % 10007;
+	x5 = (x7 * 7 + x3 + 90) % 10007;
+	x5 = (x0 * 2 + x1 + 26) % 10007;
+	x2 = (x7 * 9 + x0 + 75) % 10007;
+	x2 = (x0 + x0 + 11) % 10007;
+	x0 = (x3 * 8 + x5 + 76) % 10007;
+	x6 = (x4 * 3 + x4 + 5) % 10007;
+	x5 = (x2 + x5 + 32) % 10007;
+	x4 = (x4 * 2 + x1 + 78) % 10007;
+	x0 = (x2 + x7 + 24) % 10007;
+	x0 = (x2 + x0 + 46) % 10007;
+	x2 = (x1 + x6 + 58) % 10007;
+	x4 = (x1 + x6 + 51) % 10007;
+	x7 = (x1 + x5 + 51) % 10007;
+	x0 = (x6 * 9 + x5 + 31) % 10007;
+	x7 = (x4 + x0 + 55) % 10007;
+	x0 = (x3 * 4 + x6 + 6) % 10007;
+	x1 = (x4 + x0 + 61) % 10007;
+	x1 = (x4 * 5 + x5 + 43) % 10007;
+	x2 = (x5 + x1 + 48) % 10007;
+	x3 = (x7 + x2 + 21) % 10007;
+	x6 = (x5 * 2 + x1 + 22) % 10007;
+	x5 = (x4 * 7 + x3 + 52) % 10007;
+	x3 = (x3 + x7 + 77) % 10007;
+	x6 = (x5 + x3 + 10) % 10007;
+	x0 = (x0 * 3 + x0 + 38) % 10007;
+	x7 = (x7 * 8 + x2 + 95) % 10007;
+	x5 = (x2 * 7 + x6 + 69) % 10007;
+	x4 = (x3 * 6 + x6 + 59) % 10007;
+	x4 = (x3 + x5 + 92) % 10007;
+	x4 = (x2 * 3 + x0 + 53) % 10007;
+	x7 = (x5 + x2 + 37) % 10007;
+	x6 = (x4 * 5 + x4 + 79) % 10007;
+	x6 = (x0 * 2 + x6 + 65) % 10007;
+	x4 = (x4 * 3 + x1 + 39) % 10007;
+	x5 = (x7 + x4 + 43) % 10007;
+	x7 = (x3 * 7 + x0 + 92) % 10007;
+	x5 = (x2 * 6 + x6 + 90) % 10007;
+	x4 = (x0 + x4 + 51) % 10007;
+	x4 = (x7 + x0 + 98) % 10007;
+	x1 = (x1 + x1 + 97) % 10007;
+	x3 = (x3 + x4 + 26) % 10007;
+	x2 = (x5 + x0 + 58) % 10007;
+	x2 = (x0 * 6 + x0 + 89) % 10007;
+	x0 = (x2 + x6 + 55) % 10007;
+	x7 = (x0 + x3 + 40) % 10007;
+	x4 = (x7 * 9 + x5 + 4) % 10007;
+	x3 = (x4 + x2 + 49) % 10007;
+	x4 = (x2 * 8 + x6 + 96) % 10007;
+	x0 = (x4 + x1 + 97) % 10007;
+	x7 = (x6 + x1 + 25) % 10007;
+	x3 = (x7 * 7 + x6 + 27) % 10007;
+	x6 = (x2 * 4 + x1 + 52) % 10007;
+	x2 = (x6 + x3 + 52) % 10007;
+	x6 = (x2 * 9 + x6 + 38) % 10007;
+	x2 = (x7 + x0 + 23) % 10007;
+	x2 = (x7 + x7 + 59) % 10007;
+	x1 = (x4 * 5 + x4 + 32) % 10007;
+	x7 = (x0 + x2 + 11) % 10007;
+	x5 = (x6 + x2 + 34) % 10007;
+	x2 = (x3 * 9 + x5 + 3) % 10007;
+	x4 = (x4 + x1 + 51) % 10007;
+	x4 = (x4 + x6 + 70) % 10007;
+	x1 = (x1 * 3 + x3 + 41) % 10007;
+	x1 = (x1 * 4 + x4 + 31) % 10007;
+	x6 = (x3 * 3 + x5 + 95) % 10007;
+	x5 = (x1 * 4 + x4 + 64) % 10007;
+	x4 = (x1 + x5 + 78) % 10007;
+	x3 = (x0 + x1 + 68) % 10007;
+	x2 = (x7 + x1 + 29) % 10007;
+	x0 = (x0 * 6 + x7 + 68) % 10007;
+	x2 = (x1 * 7 + x4 + 43) % 10007;
+	x4 = (x1 * 2 + x7 + 21) % 10007;
+	x0 = (x4 + x1 + 69) % 10007;
+	x7 = (x0 * 3 + x1 + 91) % 10007;
+	x0 = (x2 + x1 + 47) % 10007;
+	x1 = (x1 + x6 + 83) % 10007;
+	x7 = (x2 + x3 + 32) % 10007;
+	x0 = (x1 + x7 + 62) % 10007;
+	x4 = (x2 + x0 + 53) % 10007;
+	x3 = (x6 + x3 + 52) % 10007;
+	x2 = (x4 * 5 + x4 + 59) % 10007;
+	x0 = (x4 + x0 + 57) % 10007;
+	x1 = (x2 * 4 + x6 + 89) % 10007;
+	x2 = (x0 * 3 + x5 + 93) % 10007;
+	x7 = (x6 * 9 + x3 + 58) % 10007;
+	x3 = (x1 + x6 + 15) % 10007;
+	x5 = (x3 + x0 + 81) % 10007;
+	x4 = (x0 + x0 + 61) % 10007;
+	x7 = (x7 + x1 + 22) % 10007;
+	x4 = (x6 * 3 + x6 + 32) % 10007;
+	x6 = (x2 + x1 + 95) % 10007;
+	x7 = (x3 * 2 + x3 + 57) % 10007;
+	x0 = (x4 + x6 + 41) % 10007;
+	x6 = (x6 * 5 + x1 + 28) % 10007;
+	x4 = (x6 * 3 + x1 + 37) % 10007;
+	x5 = (x1 + x6 + 91) % 10007;
+	x0 = (x4 * 5 + x2 + 13) % 10007;
+	x0 = (x3 + x7 + 49) % 10007;
+	x3 = (x5 * 3 + x4 + 91) % 10007;
+	x7 = (x0 * 9 + x5 + 94) % 10007;
+	x5 = (x5 * 5 + x0 + 7) % 10007;
+	x4 = (x3 + x6 + 51) % 10007;
+	x0 = (x2 + x6 + 49) % 10007;
+	x0 = (x2 + x4 + 63) % 10007;
+	x1 = (x2 * 5 + x1 + 15) % 10007;
+	x6 = (x5 * 2 + x7 + 98) % 10007;
+	x5 = (x6 + x5 + 31) % 10007;
+	x6 = (x1 + x3 + 52) % 10007;
+	x2 = (x0 * 2 + x5 + 42) % 10007;
+	x6 = (x3 * 5 + x2 + 88) % 10007;
+	x0 = (x0 + x5 + 21) % 10007;
+	x0 = (x6 + x3 + 27) % 10007;
+	x0 = (x5 * 8 + x3 + 33) % 10007;
+	x1 = (x0 + x1 + 15) % 10007;
+	x1 = (x6 + x0 + 31) % 10007;
+	x7 = (x3 * 3 + x6 + 12) % 10007;
+	x0 = (x5 + x3 + 2) % 10007;
+	x7 = (x1 * 4 + x4 + 82) % 10007;
+	x7 = (x4 + x3 + 82) % 10007;
+	x4 = (x1 + x7 + 49) % 10007;
+	x7 = (x5 + x1 + 33) % 10007;
+	x7 = (x5 * 5 + x4 + 92) % 10007;
+	x7 = (x0 + x6 + 81) % 10007;
+	x3 = (x1 + x4 + 13) % 10007;
+	x2 = (x4 * 5 + x5 + 41) % 10007;
+	x6 = (x1 + x4 + 40) % 10007;
+	x4 = (x6 + x4 + 57) % 10007;
+	x5 = (x5 + x5 + 1) % 10007;
+	x6 = (x0 * 5 + x3 + 4) % 10007;
+	x3 = (x5 + x6 + 22) % 10007;
+	x5 = (x4 + x7 + 82) % 10007;
+	x4 = (x1 + x6 + 70) % 10007;
+	x0 = (x3 + x7 + 34) % 10007;
+	x0 = (x3 + x0 + 72) % 10007;
+	x4 = (x1 * 8 + x7 + 66) % 10007;
+	x3 = (x6 + x6 + 53) % 10007;
+	x6 = (x1 + x5 + 39) % 10007;
+	x2 = (x3 * 9 + x5 + 92) % 10007;
+	x2 = (x4 * 8 + x7 + 75) % 10007;
+	x0 = (x5 + x4 + 68) % 10007;
+	x0 = (x6 + x2 + 95) % 10007;
+	x6 = (x2 + x5 + 56) % 10007;
+	x1 = (x5 + x4 + 91) % 10007;
+	x7 = (x6 * 2 + x3 + 59) % 10007;
+	x5 = (x3 + x0 + 47) % 10007;
+	x2 = (x2 * 3 + x4 + 10) % 10007;
+	x7 = (x0 + x5 + 60) % 10007;
+	x2 = (x2 + x1 + 70) % 10007;
+	x1 = (x2 + x3 + 21) % 10007;
+	x2 = (x2 * 6 + x6 + 41) % 10007;
+	x4 = (x0 + x0 + 80) % 10007;
+	x5 = (x5 * 5 + x6 + 24) % 10007;
+	x4 = (x1 * 5 + x0 + 93) % 10007;
+	x4 = (x6 + x7 + 25) % 10007;
+	x3 = (x2 + x5 + 92) % 10007;
+	x2 = (x4 + x1 + 18) % 10007;
+	x1 = (x6 * 2 + x5 + 82) % 10007;
+	x3 = (x5 * 5 + x0 + 23) % 10007;
+	x2 = (x6 * 9 + x4 + 73) % 10007;
+	x5 = (x3 * 2 + x1 + 50) % 10007;
+	x2 = (x5 + x1 + 61) % 10007;
+	x0 = (x7 + x5 + 92) % 10007;
+	x1 = (x7 + x3 + 83) % 10007;
+	x7 = (x1 + x3 + 12) % 10007;
+	x6 = (x3 + x4 + 83) % 10007;
+	x5 = (x7 * 6 + x1 + 64) % 10007;
+	x3 = (x7 * 2 + x4 + 35) % 10007;
+	x1 = (x2 * 4 + x3 + 27) % 10007;
+	x7 = (x7 + x6 + 8) % 10007;
+	x6 = (x7 * 8 + x3 + 6) % 10007;
+	x7 = (x1 * 7 + x0 + 70) % 10007;
+	x2 = (x4 + x3 + 58) % 10007;
+	x1 = (x1 + x0 + 86) % 10007;
+	x4 = (x4 * 5 + x0 + 6) % 10007;
+	x4 = (x2 + x6 + 84) % 10007;
+	x2 = (x1 + x1 + 87) % 10007;
+	x5 = (x5 * 8 + x7 + 21) % 10007;
+	x0 = (x7 + x4 + 29) % 10007;
+	x0 = (x6 * 6 + x0 + 72) % 10007;
+	x3 = (x3 + x1 + 77) % 10007;
+	x5 = (x5 * 5 + x7 + 95) % 10007;
+	x2 = (x1 + x0 + 64) % 10007;
+	x1 = (x6 * 4 + x4 + 91) % 10007;
+	x2 = (x5 + x7 + 28) % 10007;
+	x0 = (x1 + x3 + 79) % 10007;
+	x2 = (x0 * 2 + x2 + 75) % 10007;
+	x3 = (x0 * 8 + x2 + 16) % 10007;
+	x3 = (x4 + x0 + 93) % 10007;
+	x0 = (x3 + x3 + 28) % 10007;
+	x4 = (x2 * 9 + x5 + 27) % 10007;
+	x1 = (x5 + x4 + 42) % 10007;
+	x0 = (x4 + x3 + 47) % 10007;
+	x6 = (x3 * 2 + x0 + 48) % 10007;
+	x7 = (x5 + x4 + 80) % 10007;
+	x5 = (x3 + x6 + 5) % 10007;
+	x4 = (x1 * 9 + x6 + 65) % 10007;
+	x6 = (x3 * 6 + x2 + 84) % 10007;
+	x0 = (x2 * 4 + x1 + 90) % 10007;
+	x1 = (x0 + x5 + 51) % 10007;
+	x7 = (x0 + x2 + 94) % 10007;
+	x0 = (x1 + x0 + 91) % 10007;
+	x1 = (x2 * 5 + x0 + 98) % 10007;
+	x1 = (x3 * 8 + x5 + 38) % 10007;
+	x7 = (x3 + x4 + 82) % 10007;
+	x6 = (x4 + x5 + 2) % 10007;
+	x6 = (x4 * 9 + x0 + 39) % 10007;
+	x0 = (x3 + x3 + 57) % 10007;
+	x2 = (x3 + x7 + 60) % 10007;
+	x6 = (x6 + x7 + 26) % 10007;
+	x5 = (x4 + x3 + 62) % 10007;
+	x0 = (x7 * 8 + x2 + 17) % 10007;
+	x0 = (x7 + x7 + 5) % 10007;
+	x3 = (x4 + x4 + 18) % 10007;
+	x6 = (x3 * 6 + x3 + 13) % 10007;
+	x7 = (x5 + x5 + 91) % 10007;
+	x4 = (x2 + x1 + 52) % 10007;
+	x7 = (x5 + x4 + 43) % 10007;
+	x1 = (x2 * 9 + x1 + 39) % 10007;
+	x7 = (x6 * 3 + x0 + 92) % 10007;
+	x5 = (x2 * 9 + x3 + 98) % 10007;
+	x4 = (x4 + x4 + 40) % 10007;
+	x7 = (x7 * 5 + x2 + 19) % 10007;
+	x3 = (x2 * 8 + x2 + 47) % 10007;
+	x5 = (x3 + x1 + 19) % 10007;
+	x4 = (x1 * 2 + x4 + 10) % 10007;
+	x6 = (x1 + x6 + 58) % 10007;
+	x0 = (x3 + x0 + 24) % 10007;
+	x0 = (x7 + x7 + 67) % 10007;
+	x5 = (x3 + x0 + 53) % 10007;
+	x0 = (x5 * 5 + x4 + 72) % 10007;
+	x4 = (x0 + x2 + 65) % 10007;
+	x1 = (x3 + x7 + 72) % 10007;
+	x3 = (x3 + x1 + 23) % 10007;
+	x5 = (x6 + x6 + 15) % 10007;
+	x7 = (x1 + x4 + 55) % 10007;
+	x2 = (x1 + x1 + 83) % 10007;
+	x1 = (x7 * 6 + x0 + 14) % 10007;
+	x4 = (x0 + x4 + 77) % 10007;
+	x7 = (x0 * 8 + x6 + 10) % 10007;
+	x5 = (x0 + x5 + 47) % 10007;
+	x3 = (x3 + x3 + 20) % 10007;
+	x0 = (x0 * 7 + x2 + 92) % 10007;
+	x4 = (x0 + x5 + 27) % 10007;
+	x3 = (x6 * 6 + x6 + 79) % 10007;
+	x6 = (x7 + x3 + 67) % 10007;
+	x6 = (x5 * 7 + x7 + 10) % 10007;
+	x7 = (x4 * 6 + x0 + 45) % 10007;
+	x5 = (x1 * 5 + x5 + 48) % 10007;
+	x2 = (x4 * 9 + x1 + 80) % 10007;
+	x1 = (x4 * 8 + x4 + 65) % 10007;
+	x4 = (x1 * 9 + x7 + 73) % 10007;
+	x4 = (x4 * 2 + x6 + 65) % 10007;
+	x1 = (x1 + x3 + 1) % 10007;
+	x6 = (x2 * 3 + x4 + 25) % 10007;
+	x6 = (x3 + x5 + 42) % 10007;
+	x1 = (x3 * 6 + x6 + 73) % 10007;
+	x6 = (x4 + x0 + 75) % 10007;
+	x1 = (x5 * 2 + x7 + 93) % 10007;
+	x3 = (x5 + x2 + 40) % 10007;
+	x7 = (x4 + x7 + 27) % 10007;
+	x2 = (x2 + x7 + 93) % 10007;
+	x6 = (x7 + x6 + 7) % 10007;
+	x1 = (x5 + x7 + 8) % 10007;
+	x1 = (x6 * 9 + x4 + 94) % 10007;
+	x5 = (x6 * 2 + x7 + 49) % 10007;
+	x1 = (x6 + x4 + 40) % 10007;
+	x3 = (x3 + x3 + 30) % 10007;
+	x6 = (x5 * 9 + x6 + 42) % 10007;
+	x7 = (x1 + x7 + 19) % 10007;
+	x3 = (x1 + x4 + 46) % 10007;
+	x7 = (x3 * 4 + x5 + 94) % 10007;
+	x4 = (x1 + x4 + 2) % 10007;
+	x5 = (x4 + x2 + 78) % 10007;
+	x2 = (x6 * 6 + x0 + 18) % 10007;
+	x0 = (x3 + x2 + 20) % 10007;
+	x7 = (x4 * 4 + x1 + 25) % 10007;
+	x1 = (x0 * 3 + x7 + 91) % 10007;
+	x5 = (x1 * 3 + x7 + 39) % 10007;
+	x0 = (x1 + x0 + 2) % 10007;
+	x2 = (x6 + x6 + 15) % 10007;
+	x1 = (x4 * 3 + x1 + 28) % 10007;
+	x0 = (x7 + x6 + 44) % 10007;
+	x6 = (x1 + x0 + 24) % 10007;
+	x2 = (x5 * 4 + x0 + 53) % 10007;
+	x7 = (x6 + x5 + 27) % 10007;
+	x6 = (x6 + x5 + 50) % 10007;
+	x2 = (x0 + x7 + 66) % 10007;
+	x7 = (x1 + x0 + 54) % 10007;
+	x5 = (x7 * 5 + x0 + 28) % 10007;
+	x6 = (x3 * 9 + x6 + 7) % 10007;
+	x6 = (x7 * 6 + x4 + 18) % 10007;
+	x3 = (x0 * 8 + x0 + 21) % 10007;
+	x2 = (x0 * 6 + x0 + 58) % 10007;
+	x2 = (x3 + x0 + 26) % 10007;
+	x0 = (x5 + x6 + 11) % 10007;
+	x1 = (x7 * 5 + x5 + 68) % 10007;
+	x3 = (x0 + x1 + 98) % 10007;
+	x2 = (x1 + x7 + 31) % 10007;
+	x3 = (x2 + x4 + 23) % 10007;
+	x6 = (x3 * 8 + x1 + 27) % 10007;
+	x1 = (x0 * 6 + x1 + 6) % 10007;
+	x0 = (x7 + x4 + 30) % 10007;
+	x2 = (x7 * 6 + x2 + 13) % 10007;
+	x2 = (x4 + x7 + 6) % 10007;
+	x4 = (x6 + x5 + 88) % 10007;
+	x0 = (x1 + x6 + 53) % 10007;
+	x0 = (x0 * 5 + x7 + 71) % 10007;
+	x5 = (x6 * 2 + x7 + 30) % 10007;
+	x1 = (x4 * 4 + x0 + 5) % 10007;
+	x5 = (x6 * 7 + x2 + 57) % 10007;
+	x3 = (x0 + x2 + 95) % 10007;
+	x4 = (x6 + x7 + 1) % 10007;
+	x1 = (x5 * 7 + x7 + 35) % 10007;
+	x5 = (x5 * 6 + x4 + 61) % 10007;
+	x0 = (x3 + x2 + 48) % 10007;
+	x7 = (x5 * 7 + x1 + 73) % 10007;
+	x7 = (x0 + x4 + 46) % 10007;
+	x1 = (x5 * 8 + x0 + 17) % 10007;
+	x0 = (x7 * 2 + x6 + 83) % 10007;
+	x5 = (x4 * 6 + x6 + 60) % 10007;
+	x5 = (x4 + x6 + 86) % 10007;
+	x6 = (x7 * 4 + x7 + 16) % 10007;
+	x6 = (x1 * 5 + x0 + 12) % 10007;
+	x3 = (x6 + x7 + 22) % 10007;
+	x1 = (x0 + x5 + 11) % 10007;
+	x1 = (x2 * 8 + x6 + 51) % 10007;
+	x7 = (x5 + x3 + 92) % 10007;
+	x0 = (x2 * 3 + x1 + 83) % 10007;
+	x5 = (x0 + x4 + 41) % 10007;
+	x5 = (x1 + x7 + 83) % 10007;
+	x3 = (x4 * 6 + x2 + 30) % 10007;
+	x1 = (x2 * 3 + x2 + 15) % 10007;
+	x2 = (x7 * 3 + x0 + 45) % 10007;
+	x4 = (x0 * 2 + x5 + 14) % 10007;
+	x1 = (x3 * 9 + x3 + 32) % 10007;
+	x2 = (x2 * 9 + x1 + 22) % 10007;
+	x0 = (x2 * 2 + x1 + 79) % 10007;
+	x1 = (x4 * 4 + x0 + 97) % 10007;
+	x7 = (x0 * 2 + x6 + 27) % 10007;
+	x2 = (x0 + x5 + 16) % 10007;
+	x2 = (x3 * 6 + x3 + 64) % 10007;
+	x4 = (x0 + x3 + 42) % 10007;
+	x5 = (x3 + x3 + 77) % 10007;
+	x2 = (x7 + x3 + 1) % 10007;
+	x3 = (x3 * 3 + x6 + 38) % 10007;
+	x1 = (x7 + x1 + 52) % 10007;
+	x5 = (x2 * 3 + x4 + 25) % 10007;
+	x6 = (x4 * 5 + x3 + 42) % 10007;
+	x6 = (x7 * 3 + x0 + 50) % 10007;
+	x4 = (x0 + x1 + 23) % 10007;
+	x0 = (x0 * 8 + x7 + 26) % 10007;
+	x5 = (x2 + x1 + 52) % 10007;
+	x0 = (x1 * 8 + x6 + 56) % 10007;
+	x4 = (x7 + x7 + 87) % 10007;
+	x4 = (x5 + x4 + 87) % 10007;
+	x3 = (x7 + x4 + 67) % 10007;
+	x6 = (x5 + x7 + 37) % 10007;
+	x2 = (x4 * 3 + x2 + 29) % 10007;
+	x0 = (x5 * 5 + x0 + 7) % 10007;
+	x3 = (x6 * 2 + x4 + 5) % 10007;
+	x6 = (x0 * 4 + x6 + 35) % 10007;
+	x6 = (x2 * 3 + x0 + 98) % 10007;
+	x6 = (x5 * 2 + x4 + 78) % 10007;
+	x2 = (x0 + x7 + 95) % 10007;
+	x2 = (x5 + x3 + 40) % 10007;
+	x0 = (x1 * 8 + x3 + 93) % 10007;
+	x6 = (x5 * 5 + x4 + 17) % 10007;
+	x7 = (x2 + x2 + 32) % 10007;
+	x3 = (x6 * 9 + x1 + 98) % 10007;
+	x6 = (x0 * 9 + x3 + 49) % 10007;
+	x2 = (x2 + x2 + 95) % 10007;
+	x2 = (x3 + x3 + 50) % 10007;
+	x3 = (x5 + x1 + 36) % 10007;
+	x1 = (x1 + x1 + 28) % 10007;
+	x4 = (x4 + x7 + 34) % 10007;
+	x2 = (x1 * 4 + x7 + 11) % 10007;
+	x1 = (x1 * 5 + x1 + 92) % 10007;
+	x2 = (x1 + x0 + 29) % 10007;
+	x5 = (x0 + x6 + 53) % 10007;
+	x4 = (x6 * 9 + x5 + 18) % 10007;
+	x5 = (x4 * 7 + x3 + 20) % 10007;
+	x4 = (x5 * 9 + x0 + 39) % 10007;
+	x2 = (x7 * 4 + x2 + 76) % 10007;
+	x4 = (x0 + x7 + 52) % 10007;
+	x4 = (x7 + x0 + 61) % 10007;
+	x4 = (x6 * 2 + x5 + 89) % 10007;
+	x7 = (x0 * 2 + x2 + 1) % 10007;
+	x3 = (x1 + x0 + 54) % 10007;
+	x6 = (x1 * 5 + x4 + 2) % 10007;
+	x6 = (x1 + x6 + 50) % 10007;
+	x5 = (x7 + x6 + 95) % 10007;
+	x0 = (x6 * 3 + x5 + 30) % 10007;
+	x1 = (x3 * 7 + x3 + 88) % 10007;
+	x6 = (x4 * 2 + x5 + 30) % 10007;
+	x1 = (x0 + x6 + 66) % 10007;
+	x0 = (x3 + x1 + 69) % 10007;
+	x5 = (x2 + x2 + 12) % 10007;
+	x2 = (x5 + x6 + 51) % 10007;
+	x5 = (x0 + x1 + 58) % 10007;
+	x6 = (x6 + x5 + 59) % 10007;
+	x4 = (x4 + x6 + 79) % 10007;
+	x1 = (x5 + x2 + 15) % 10007;
+	x3 = (x3 * 9 + x5 + 68) % 10007;
+	x2 = (x1 * 3 + x7 + 96) % 10007;
+	x5 = (x1 * 6 + x5 + 3) % 10007;
+	x4 = (x4 + x0 + 18) % 10007;
+	x4 = (x3 * 4 + x0 + 28) % 10007;
+	x6 = (x2 * 4 + x4 + 22) % 10007;
+	x4 = (x2 * 5 + x1 + 89) % 10007;
+	x2 = (x1 * 8 + x6 + 20) % 10007;
+	x5 = (x2 + x6 + 96) % 10007;
+	x3 = (x4 * 8 + x6 + 84) % 10007;
+	x3 = (x6 * 3 + x1 + 39) % 10007;
+	x7 = (x4 * 9 + x3 + 87) % 10007;
+	x3 = (x1 + x2 + 92) % 10007;
+	x3 = (x0 + x2 + 37) % 10007;
+	x3 = (x2 + x4 + 25) % 10007;
+	x1 = (x7 * 2 + x7 + 58) % 10007;
+	x0 = (x6 + x3 + 30) % 10007;
+	x2 = (x1 * 3 + x7 + 64) % 10007;
+	x7 = (x5 + x4 + 52) % 10007;
+	x6 = (x0 * 9 + x5 + 45) % 10007;
+	x4 = (x4 + x1 + 99) % 10007;
+	x1 = (x4 * 7 + x3 + 12) % 10007;
+	x6 = (x0 * 2 + x7 + 56) % 10007;
+	x0 = (x5 * 3 + x3 + 15) % 10007;
+	x3 = (x6 + x1 + 71) % 10007;
+	x4 = (x6 + x3 + 49) % 10007;
+	x3 = (x5 * 3 + x1 + 24) % 10007;
+	x7 = (x3 * 6 + x7 + 15) % 10007;
+	x0 = (x7 + x4 + 94) % 10007;
+	x4 = (x7 * 6 + x3 + 55) % 10007;
+	x2 = (x7 + x7 + 40) % 10007;
+	x2 = (x4 * 3 + x3 + 10) % 10007;
+	x6 = (x7 + x5 + 35) % 10007;
+	x1 = (x7 + x7 + 41) % 10007;
+	x1 = (x1 * 6 + x4 + 98) % 10007;
+	x2 = (x3 + x1 + 38) % 10007;
+	x4 = (x7 + x2 + 58) % 10007;
+	x3 = (x2 + x5 + 60) % 10007;
+	x6 = (x6 * 6 + x5 + 61) % 10007;
+	x3 = (x5 * 3 + x1 + 58) % 10007;
+	x7 = (x5 + x3 + 33) % 10007;
+	x7 = (x3 * 2 + x0 + 73) % 10007;
+	x7 = (x2 * 8 + x7 + 59) % 10007;
+	x4 = (x0 + x7 + 78) % 10007;
+	x4 = (x7 * 6 + x5 + 98) % 10007;
+	x7 = (x3 * 4 + x1 + 17) % 10007;
+	x2 = (x0 + x4 + 42) % 10007;
+	x2 = (x6 + x5 + 46) % 10007;
+	x6 = (x7 * 7 + x7 + 19) % 10007;
+	x5 = (x7 * 5 + x1 + 7) % 10007;
+	x0 = (x6 * 6 + x2 + 63) % 10007;
+	x3 = (x7 + x4 + 12) % 10007;
+	x3 = (x6 * 4 + x5 + 33) % 10007;
+	x6 = (x6 * 8 + x5 + 34) % 10007;
+	x4 = (x7 * 7 + x0 + 84) % 10007;
+	x1 = (x7 * 8 + x1 + 73) % 10007;
+	x3 = (x1 + x5 + 71) % 10007;
+	x5 = (x6 * 9 + x0 + 17) % 10007;
+	x4 = (x7 + x0 + 37) % 10007;
+	x0 = (x1 * 4 + x1 + 14) % 10007;
+	x7 = (x4 * 9 + x3 + 3) % 10007;
+	x7 = (x1 * 3 + x6 + 66) % 10007;
+	x5 = (x5 + x0 + 49) % 10007;
+	x6 = (x2 * 5 + x4 + 89) % 10007;
+	x1 = (x3 * 2 + x0 + 6) % 10007;
+	x2 = (x1 * 4 + x1 + 54) % 10007;
+	x1 = (x1 + x1 + 75) % 10007;
+	x0 = (x4 * 2 + x0 + 43) % 10007;
+	x4 = (x4 + x3 + 43) % 10007;
+	x1 = (x2 + x0 + 57) % 10007;
+	x5 = (x4 * 9 + x6 + 88) % 10007;
+	x3 = (x3 * 2 + x3 + 19) % 10007;
+	x2 = (x0 * 7 + x2 + 41) % 10007;
+	x4 = (x5 * 9 + x5 + 5) % 10007;
+	x6 = (x5 * 6 + x5 + 66) % 10007;
+	x6 = (x6 + x5 + 84) % 10007;
+	x2 = (x2 * 2 + x0 + 14) % 10007;
+	x7 = (x6 * 4 + x6 + 31) % 10007;
+	x1 = (x2 + x0 + 6) % 10007;
+	x3 = (x0 * 8 + x1 + 3) % 10007;
+	x6 = (x2 + x3 + 84) % 10007;
+	x1 = (x2 + x1 + 90) % 10007;
+	x2 = (x6 * 8 + x0 + 68) % 10007;
+	x7 = (x5 * 9 + x3 + 56) % 10007;
+	x6 = (x4 + x3 + 84) % 10007;
+	x1 = (x1 + x0 + 30) % 10007;
+	x3 = (x7 + x2 + 94) % 10007;
+	x7 = (x2 * 2 + x0 + 76) % 10007;
+	x7 = (x7 * 8 + x7 + 40) % 10007;
+	x4 = (x7 * 5 + x0 + 47) % 10007;
+	x2 = (x5 * 4 + x5 + 59) % 10007;
+	x0 = (x2 * 8 + x4 + 68) % 10007;
+	x0 = (x4 * 8 + x5 + 61) % 10007;
+	x3 = (x0 * 2 + x5 + 29) % 10007;
+	x3 = (x7 * 5 + x2 + 49) % 10007;
+	x4 = (x5 + x6 + 79) % 10007;
+	x2 = (x2 * 2 + x7 + 80) % 10007;
+	x6 = (x5 * 4 + x6 + 48) % 10007;
+	x0 = (x1 * 4 + x7 + 21) % 10007;
+	x6 = (x5 + x0 + 55) % 10007;
+	x6 = (x4 + x0 + 41) % 10007;
+	x6 = (x2 * 9 + x5 + 55) % 10007;
+	x4 = (x4 + x2 + 27) % 10007;
+	x6 = (x7 * 3 + x7 + 59) % 10007;
+	x3 = (x7 * 7 + x1 + 61) % 10007;
+	x4 = (x6 + x1 + 18) % 10007;
+	x2 = (x2 + x1 + 86) % 10007;
+	x2 = (x2 + x6 + 37) % 10007;
+	x4 = (x0 * 2 + x4 + 34) % 10007;
+	x1 = (x4 + x5 + 41) % 10007;
+	x6 = (x3 * 6 + x5 + 38) % 10007;
+	x3 = (x4 + x3 + 35) % 10007;
+	x1 = (x7 * 8 + x4 + 43) % 10007;
+	x4 = (x5 + x3 + 76) % 10007;
+	x2 = (x2 + x5 + 89) % 10007;
+	x4 = (x7 + x3 + 19) % 10007;
+	x5 = (x4 + x3 + 12) % 10007;
+	x7 = (x7 * 7 + x4 + 39) % 10007;
+	x0 = (x6 + x2 + 73) % 10007;
+	x2 = (x6 + x7 + 84) % 10007;
+	x3 = (x6 + x6 + 31) % 10007;
+	x7 = (x7 * 8 + x7 + 49) % 10007;
+	x0 = (x5 + x4 + 93) % 10007;
+	x4 = (x5 * 3 + x5 + 27) % 10007;
+	x3 = (x7 + x0 + 67) % 10007;
+	x6 = (x4 * 4 + x6 + 88) % 10007;
+	x7 = (x5 * 2 + x7 + 4) % 10007;
+	x2 = (x5 + x4 + 84) % 10007;
+	x3 = (x2 + x2 + 9) % 10007;
+	x4 = (x4 + x0 + 73) % 10007;
+	x5 = (x5 + x7 + 85) % 10007;
+	x3 = (x5 * 3 + x0 + 70) % 10007;
+	x5 = (x2 + x0 + 43) % 10007;
+	x7 = (x7 * 9 + x5 + 78) % 10007;
+	x4 = (x5 * 2 + x7 + 21) % 10007;
+	x4 = (x2 + x2 + 42) % 10007;
+	x6 = (x2 + x0 + 70) % 10007;
+	x0 = (x0 * 5 + x6 + 78) % 10007;
+	x5 = (x2 + x3 + 81) % 10007;
+	x2 = (x4 * 7 + x2 + 23) % 10007;
+	x5 = (x7 * 9 + x3 + 9) % 10007;
+	x7 = (x7 * 6 + x7 + 13) % 10007;
+	x7 = (x1 + x5 + 32) % 10007;
+	x0 = (x5 + x2 + 80) % 10007;
+	x1 = (x3 * 8 + x1 + 95) % 10007;
+	x1 = (x0 * 3 + x4 + 36) % 10007;
+	x3 = (x7 * 9 + x7 + 87) % 10007;
+	x5 = (x5 + x6 + 69) % 10007;
+	x5 = (x4 * 4 + x3 + 82) % 10007;
+	x2 = (x2 * 4 + x3 + 7) % 10007;
+	x4 = (x4 * 7 + x2 + 32) % 10007;
+	x3 = (x5 * 4 + x4 + 22) % 10007;
+	x1 = (x6 + x5 + 37) % 10007;
+	x0 = (x4 * 3 + x0 + 47) % 10007;
+	x6 = (x2 + x3 + 16) % 10007;
+	x1 = (x0 + x3 + 44) % 10007;
+	x1 = (x1 + x2 + 44) % 10007;
+	x5 = (x4 * 2 + x2 + 75) % 10007;
+	x6 = (x5 + x6 + 79) % 10007;
+	x1 = (x5 * 2 + x0 + 92) % 10007;
+	x4 = (x3 * 9 + x5 + 3) % 10007;
+	x0 = (x3 + x1 + 3) % 10007;
+	x3 = (x3 * 4 + x1 + 35) % 10007;
+	x4 = (x0 + x1 + 24) % 10007;
+	x5 = (x6 + x7 + 11) % 10007;
+	x6 = (x2 * 5 + x7 + 77) % 10007;
+	x4 = (x7 + x4 + 84) % 10007;
+	x5 = (x6 * 8 + x7 + 12) % 10007;
+	x1 = (x7 + x2 + 83) % 10007;
+	x0 = (x6 + x6 + 17) % 10007;
+	x6 = (x0 * 8 + x2 + 92) % 10007;
+	x3 = (x3 * 5 + x2 + 60) % 10007;
+	x2 = (x4 + x1 + 20) % 10007;
+	x1 = (x2 * 4 + x0 + 64) % 10007;
+	x7 = (x7 * 6 + x1 + 74) % 10007;
+	x4 = (x1 * 9 + x3 + 56) % 10007;
+	x5 = (x5 * 2 + x5 + 96) % 10007;
+	x3 = (x7 * 3 + x1 + 77) % 10007;
+	x4 = (x6 + x5 + 49) % 10007;
+	x4 = (x6 * 3 + x6 + 14) % 10007;
+	x3 = (x0 + x3 + 25) % 10007;
+	x0 = (x2 * 8 + x4 + 98) % 10007;
+	x4 = (x3 + x3 + 47) % 10007;
+	x6 = (x6 * 2 + x5 + 53) % 10007;
+	x0 = (x5 * 6 + x4 + 94) % 10007;
+	x6 = (x2 + x3 + 24) % 10007;
+	x2 = (x2 * 5 + x7 + 11) % 10007;
+	x1 = (x7 + x2 + 66) % 10007;
+	x3 = (x2 * 2 + x4 + 63) % 10007;
+	x4 = (x1 * 4 + x6 + 58) % 10007;
+	x6 = (x2 * 8 + x3 + 43) % 10007;
+	x2 = (x4 + x0 + 43) % 10007;
+	x2 = (x3 * 6 + x5 + 43) % 10007;
+	x7 = (x7 * 8 + x7 + 40) % 10007;
+	x4 = (x5 * 8 + x5 + 57) % 10007;
+	x4 = (x7 + x2 + 43) % 10007;
+	x4 = (x6 + x6 + 52) % 10007;
+	x6 = (x7 + x4 + 31) % 10007;
+	x7 = (x2 + x6 + 16) % 10007;
+	x6 = (x2 + x0 + 44) % 10007;
+	x3 = (x1 * 9 + x2 + 15) % 10007;
+	x4 = (x2 * 7 + x5 + 66) % 10007;
+	x3 = (x5 * 9 + x7 + 54) % 10007;
+	x5 = (x0 * 6 + x6 + 32) % 10007;
+	x6 = (x1 * 7 + x3 + 2) % 10007;
+	x0 = (x6 * 6 + x6 + 17) % 10007;
+	x5 = (x1 + x6 + 18) % 10007;
+	x6 = (x7 + x6 + 79) % 10007;
+	x5 = (x2 + x7 + 64) % 10007;
+	x5 = (x2 * 4 + x1 + 19) % 10007;
+	x4 = (x3 + x7 + 92) % 10007;
+	x0 = (x5 + x0 + 57) % 10007;
+	x2 = (x7 + x5 + 66) % 10007;
+	x6 = (x7 * 3 + x2 + 89) % 10007;
+	x0 = (x3 + x7 + 91) % 10007;
+	x4 = (x2 * 6 + x3 + 99) % 10007;
+	x6 = (x6 + x7 + 19) % 10007;
+	x2 = (x5 * 6 + x4 + 11) % 10007;
+	x1 = (x7 + x3 + 90) % 10007;
+	x6 = (x6 * 5 + x0 + 59) % 10007;
+	x2 = (x7 * 5 + x7 + 96) % 10007;
+	x3 = (x3 * 8 + x0 + 30) % 10007;
+	x0 = (x3 + x1 + 14) % 10007;
+	x7 = (x1 + x3 + 56) % 10007;
+	x0 = (x5 * 7 + x7 + 95) % 10007;
+	x2 = (x7 * 8 + x2 + 53) % 10007;
+	x1 = (x5 * 5 + x3 + 52) % 10007;
+	x6 = (x4 * 2 + x3 + 25) % 10007;
+	x0 = (x0 + x0 + 95) % 10007;
+	x2 = (x0 * 8 + x7 + 88) % 10007;
+	x5 = (x0 + x3 + 40) % 10007;
+	x3 = (x3 + x4 + 60) % 10007;
+	x0 = (x0 * 3 + x3 + 89) % 10007;
+	x2 = (x2 * 2 + x2 + 97) % 10007;
+	x0 = (x7 * 2 + x6 + 55) % 10007;
+	x0 = (x0 + x7 + 19) % 10007;
+	x4 = (x6 + x6 + 95) % 10007;
+	x1 = (x3 * 5 + x7 + 7) % 10007;
+	x5 = (x7 + x4 + 29) % 10007;
+	x2 = (x0 * 2 + x6 + 80) % 10007;
+	x1 = (x3 + x7 + 61) % 10007;
+	x7 = (x1 + x5 + 22) % 10007;
+	x6 = (x0 + x3 + 60) % 10007;
+	x3 = (x3 + x2 + 56) % 10007;
+	x2 = (x2 * 3 + x1 + 47) % 10007;
+	x0 = (x0 + x6 + 97) % 10007;
+	x1 = (x3 * 4 + x3 + 35) % 10007;
+	x5 = (x7 + x0 + 23) % 10007;
+	x5 = (x0 + x1 + 84) % 10007;
+	x5 = (x2 * 9 + x5 + 19) % 10007;
+	x1 = (x1 + x6 + 79) % 10007;
+	x6 = (x3 + x3 + 81) % 10007;
+	x5 = (x6 * 5 + x2 + 8) % 10007;
+	x2 = (x1 + x1 + 65) % 10007;
+	x6 = (x4 * 3 + x5 + 56) % 10007;
+	x2 = (x5 + x1 + 94) % 10007;
+	x5 = (x3 * 4 + x4 + 13) % 10007;
+	x4 = (x0 * 6 + x6 + 98) % 10007;
+	x6 = (x1 + x6 + 73) % 10007;
+	x5 = (x7 * 6 + x4 + 76) % 10007;
+	x3 = (x2 + x1 + 22) % 10007;
+	x7 = (x5 + x7 + 18) % 10007;
+	x5 = (x0 * 4 + x2 + 69) % 10007;
+	x3 = (x2 + x4 + 23) % 10007;
+	x3 = (x1 * 4 + x3 + 91) % 10007;
+	x4 = (x6 * 8 + x6 + 27) % 10007;
+	x4 = (x5 + x6 + 93) % 10007;
+	x2 = (x0 + x4 + 79) % 10007;
+	x4 = (x4 * 3 + x5 + 57) % 10007;
+	x7 = (x5 * 9 + x4 + 55) % 10007;
+	x3 = (x0 * 4 + x6 + 26) % 10007;
+	x5 = (x2 + x6 + 65) % 10007;
+	x6 = (x0 * 3 + x5 + 59) % 10007;
+	x7 = (x7 * 4 + x4 + 76) % 10007;
+	x7 = (x4 + x4 + 53) % 10007;
+	x2 = (x0 * 9 + x1 + 61) % 10007;
+	x6 = (x3 + x1 + 78) % 10007;
+	x5 = (x0 + x5 + 55) % 10007;
+	x6 = (x7 * 9 + x2 + 19) % 10007;
+	x4 = (x6 * 6 + x1 + 80) % 10007;
+	x2 = (x3 * 6 + x2 + 71) % 10007;
+	x3 = (x4 * 5 + x1 + 58) % 10007;
+	x2 = (x5 + x0 + 92) % 10007;
+	x0 = (x2 + x1 + 43) % 10007;
+	x1 = (x1 + x0 + 80) % 10007;
+	x2 = (x0 * 4 + x0 + 20) % 10007;
+	x4 = (x2 * 4 + x6 + 4) % 10007;
+	x3 = (x4 * 2 + x5 + 45) % 10007;
+	x3 = (x7 * 9 + x5 + 52) % 10007;
+	x5 = (x0 + x7 + 88) % 10007;
+	x4 = (x2 + x7 + 87) % 10007;
+	x3 = (x7 + x1 + 66) % 10007;
+	x5 = (x7 * 6 + x7 + 71) % 10007;
+	x4 = (x3 * 7 + x0 + 90) % 10007;
+	x5 = (x7 + x2 + 25) % 10007;
+	x6 = (x5 + x7 + 44) % 10007;
+	x7 = (x1 + x7 + 2) % 10007;
+	x4 = (x1 * 5 + x5 + 84) % 10007;
+	x6 = (x1 * 8 + x5 + 60) % 10007;
+	x0 = (x7 + x5 + 35) % 10007;
+	x5 = (x3 + x4 + 87) % 10007;
+	x1 = (x6 + x1 + 96) % 10007;
+	x2 = (x5 * 7 + x4 + 54) % 10007;
+	x5 = (x4 * 8 + x5 + 68) % 10007;
+	x0 = (x5 + x3 + 66) % 10007;
+	x5 = (x1 + x5 + 71) % 10007;
+	x7 = (x0 + x4 + 97) % 10007;
+	x4 = (x4 + x1 + 55) % 10007;
+	x7 = (x4 + x5 + 10) % 10007;
+	x6 = (x1 + x1 + 38) % 10007;
+	x1 = (x4 + x2 + 68) % 10007;
+	x2 = (x7 + x5 + 47) % 10007;
+	x5 = (x1 + x5 + 77) % 10007;
+	x5 = (x5 + x5 + 50) % 10007;
+	x1 = (x0 * 3 + x3 + 79) % 10007;
+	x2 = (x6 * 2 + x0 + 98) % 10007;
+	x6 = (x1 * 5 + x2 + 55) % 10007;
+	x4 = (x2 * 7 + x3 + 44) % 10007;
+	x2 = (x0 + x7 + 96) % 10007;
+	x2 = (x3 * 3 + x0 + 55) % 10007;
+	x4 = (x4 * 6 + x7 + 65) % 10007;
+	x1 = (x4 * 9 + x3 + 75) % 10007;
+	x6 = (x7 + x7 + 89) % 10007;
+	x0 = (x0 * 6 + x0 + 13) % 10007;
+	x6 = (x5 + x0 + 57) % 10007;
+	x3 = (x6 + x5 + 98) % 10007;
+	x2 = (x2 * 3 + x5 + 25) % 10007;
+	x5 = (x1 * 5 + x4 + 89) % 10007;
+	x1 = (x2 * 6 + x1 + 60) % 10007;
+	x3 = (x3 * 5 + x3 + 28) % 10007;
+	x5 = (x2 * 7 + x0 + 17) % 10007;
+	x0 = (x5 + x1 + 79) % 10007;
+	x2 = (x1 + x6 + 88) % 10007;
+	x2 = (x2 * 6 + x2 + 72) % 10007;
+	x0 = (x7 * 2 + x3 + 49) % 10007;
+	x3 = (x3 + x7 + 36) % 10007;
+	x0 = (x0 + x4 + 93) % 10007;
+	x6 = (x1 * 9 + x7 + 89) % 10007;
+	x2 = (x4 * 4 + x3 + 73) % 10007;
+	x6 = (x1 * 5 + x4 + 57) % 10007;
+	x2 = (x6 + x6 + 86) % 10007;
+	x6 = (x4 + x7 + 65) % 10007;
+	x6 = (x6 + x7 + 12) % 10007;
+	x7 = (x3 + x5 + 48) % 10007;
+	x6 = (x1 * 7 + x6 + 80) % 10007;
+	x6 = (x7 * 2 + x1 + 92) % 10007;
+	x0 = (x5 * 6 + x6 + 18) % 10007;
+	x0 = (x3 * 7 + x4 + 10) % 10007;
+	x1 = (x0 * 2 + x5 + 21) % 10007;
+	x2 = (x3 + x1 + 38) % 10007;
+	x5 = (x2 * 8 + x3 + 9) % 10007;
+	x1 = (x0 + x4 + 97) % 10007;
+	x2 = (x6 * 7 + x3 + 35) % 10007;
+	x0 = (x5 * 4 + x4 + 21) % 10007;
+	x3 = (x5 * 9 + x6 + 51) % 10007;
+	x2 = (x3 + x5 + 15) % 10007;
+	x7 = (x6 + x7 + 7) % 10007;
+	x0 = (x0 + x1 + 76) % 10007;
+	x7 = (x4 + x5 + 34) % 10007;
+	x2 = (x5 + x3 + 74) % 10007;
+	x5 = (x0 + x7 + 78) % 10007;
+	x5 = (x2 * 5 + x5 + 18) % 10007;
+	x3 = (x1 + x5 + 48) % 10007;
+	x4 = (x5 + x2 + 83) % 10007;
+	x7 = (x7 + x1 + 97) % 10007;
+	x3 = (x4 * 4 + x2 + 84) % 10007;
+	x1 = (x4 + x5 + 54) % 10007;
+	x3 = (x7 + x5 + 36) % 10007;
+	x7 = (x5 * 5 + x5 + 64) % 10007;
+	x7 = (x5 * 9 + x2 + 71) % 10007;
+	x0 = (x0 * 3 + x3 + 13) % 10007;
+	x5 = (x4 * 2 + x0 + 38) % 10007;
+	x4 = (x0 + x4 + 76) % 10007;
+	x6 = (x2 + x4 + 79) % 10007;
+	x7 = (x4 * 6 + x6 + 75) % 10007;
+	x0 = (x6 * 6 + x5 + 99) % 10007;
+	x6 = (x0 * 9 + x2 + 58) % 10007;
+	x2 = (x3 * 3 + x7 + 48) % 10007;
+	x7 = (x6 + x1 + 75) % 10007;
+	x5 = (x6 + x7 + 48) % 10007;
+	x2 = (x6 * 4 + x5 + 51) % 10007;
+	x7 = (x3 + x1 + 15) % 10007;
+	x4 = (x1 + x3 + 31) % 10007;
+	x3 = (x5 + x3 + 90) % 10007;
+	x5 = (x6 + x5 + 56) % 10007;
+	x3 = (x3 + x6 + 95) % 10007;
+	x4 = (x1 * 4 + x3 + 11) % 10007;
+	x5 = (x5 + x0 + 91) % 10007;
+	x0 = (x0 * 5 + x4 + 74) % 10007;
+	x0 = (x1 + x5 + 91) % 10007;
+	x7 = (x4 * 3 + x7 + 71) % 10007;
+	x3 = (x4 * 4 + x4 + 11) % 10007;
+	x3 = (x7 + x1 + 43) % 10007;
+	x1 = (x5 + x2 + 59) % 10007;
+	x5 = (x1 + x1 + 78) % 10007;
+	x2 = (x7 + x4 + 94) % 10007;
+	x5 = (x6 + x4 + 40) % 10007;
+	x0 = (x3 * 6 + x3 + 4) % 10007;
+	x2 = (x3 + x5 + 99) % 10007;
+	x7 = (x0 * 6 + x6 + 77) % 10007;
+	x7 = (x0 * 6 + x3 + 45) % 10007;
+	x0 = (x4 + x5 + 80) % 10007;
+	x6 = (x5 * 9 + x6 + 24) % 10007;
+	x5 = (x3 * 4 + x0 + 33) % 10007;
+	x3 = (x3 + x7 + 4) % 10007;
+	x7 = (x2 + x5 + 6) % 10007;
+	x5 = (x0 * 3 + x6 + 42) % 10007;
+	x5 = (x7 + x1 + 49) % 10007;
+	x4 = (x0 * 5 + x5 + 47) % 10007;
+	x3 = (x5 + x7 + 22) % 10007;
+	x2 = (x3 + x1 + 66) % 10007;
+	x4 = (x4 * 3 + x4 + 52) % 10007;
+	x5 = (x0 * 2 + x4 + 68) % 10007;
+	x4 = (x0 * 5 + x3 + 15) % 10007;
+	x5 = (x7 * 6 + x5 + 82) % 10007;
+	x4 = (x1 + x0 + 93) % 10007;
+	x7 = (x4 + x3 + 26) % 10007;
+	x0 = (x7 * 9 + x1 + 75) % 10007;
+	x0 = (x2 + x5 + 84) % 10007;
+	x7 = (x3 + x7 + 48) % 10007;
+	x7 = (x0 * 5 + x5 + 81) % 10007;
+	x7 = (x4 + x6 + 49) % 10007;
+	x6 = (x0 * 6 + x0 + 97) % 10007;
+	x3 = (x1 + x0 + 13) % 10007;
+	x2 = (x6 + x3 + 74) % 10007;
+	x2 = (x5 * 8 + x1 + 45) % 10007;
+	x2 = (x2 + x0 + 31) % 10007;
+	x3 = (x4 * 5 + x1 + 10) % 10007;
+	x7 = (x6 + x5 + 81) % 10007;
+	x6 = (x2 + x6 + 11) % 10007;
+	x6 = (x0 * 9 + x6 + 34) % 10007;
+	x2 = (x7 + x3 + 65) % 10007;
+	x0 = (x6 + x7 + 79) % 10007;
+	x6 = (x5 + x2 + 42) % 10007;
+	x4 = (x4 * 2 + x5 + 74) % 10007;
+	x2 = (x2 * 7 + x1 + 9) % 10007;
+	x3 = (x2 * 5 + x0 + 24) % 10007;
+	x2 = (x7 + x2 + 86) % 10007;
+	x2 = (x4 * 4 + x4 + 90) % 10007;
+	x4 = (x7 * 9 + x5 + 1) % 10007;
+	x5 = (x2 + x0 + 27) % 10007;
+	x4 = (x3 + x3 + 46) % 10007;
+	x0 = (x4 * 9 + x7 + 86) % 10007;
+	x3 = (x5 + x1 + 45) % 10007;
+	x3 = (x1 * 6 + x6 + 18) % 10007;
+	x0 = (x1 * 5 + x5 + 13) % 10007;
+	x3 = (x3 + x1 + 82) % 10007;
+	x6 = (x6 * 5 + x2 + 67) % 10007;
+	x3 = (x4 * 9 + x4 + 81) % 10007;
+	x4 = (x1 + x5 + 80) % 10007;
+	x3 = (x0 * 2 + x6 + 71) % 10007;
+	x7 = (x3 * 5 + x4 + 11) % 10007;
+	x3 = (x7 + x0 + 39) % 10007;
+	x6 = (x3 + x2 + 72) % 10007;
+	x1 = (x2 + x3 + 43) % 10007;
+	x0 = (x5 + x0 + 77) % 10007;
+	x5 = (x1 * 9 + x6 + 14) % 10007;
+	x3 = (x1 * 6 + x5 + 90) % 10007;
+	x1 = (x1 + x0 + 97) % 10007;
+	x2 = (x5 + x6 + 59) % 10007;
+	x0 = (x0 + x3 + 70) % 10007;
+	x5 = (x1 * 3 + x5 + 53) % 10007;
+	x2 = (x4 * 7 + x1 + 48) % 10007;
+	x7 = (x1 + x7 + 8) % 10007;
+	x5 = (x3 * 4 + x1 + 35) % 10007;
+	x1 = (x0 * 4 + x4 + 20) % 10007;
+	x5 = (x0 * 9 + x3 + 9) % 10007;
+	x0 = (x5 * 2 + x1 + 83) % 10007;
+	x0 = (x7 * 2 + x7 + 19) % 10007;
+	x5 = (x3 * 8 + x3 + 54) % 10007;
+	x4 = (x5 * 8 + x2 + 42) % 10007;
+	x7 = (x6 + x7 + 69) % 10007;
+	x0 = (x4 + x0 + 40) % 10007;
+	x2 = (x4 * 8 + x0 + 1) % 10007;
+	x0 = (x6 + x3 + 43) % 10007;
+	x3 = (x4 * 9 + x0 + 86) % 10007;
+	x3 = (x6 + x5 + 35) % 10007;
+	x0 = (x0 * 3 + x0 + 38) % 10007;
+	x5 = (x3 * 8 + x0 + 66) % 10007;
+	x7 = (x2 + x5 + 55) % 10007;
+	x4 = (x3 * 5 + x0 + 72) % 10007;
+	x2 = (x3 + x2 + 62) % 10007;
+	x2 = (x1 * 8 + x7 + 63) % 10007;
+	x1 = (x3 + x5 + 60) % 10007;
+	x2 = (x5 + x7 + 10) % 10007;
+	x7 = (x2 + x3 + 91) % 10007;
+	x0 = (x1 * 8 + x2 + 92) % 10007;
+	x4 = (x1 + x2 + 31) % 10007;
+	x6 = (x6 + x6 + 97) % 10007;
+	x0 = (x5 * 2 + x6 + 75) % 10007;
+	x3 = (x4 * 2 + x5 + 80) % 10007;
+	x6 = (x3 + x3 + 61) % 10007;
+	x2 = (x4 * 5 + x1 + 90) % 10007;
+	x6 = (x2 + x5 + 25) % 10007;
+	x4 = (x6 + x1 + 54) % 10007;
+	x2 = (x1 + x2 + 46) % 10007;
+	x7 = (x4 * 5 + x3 + 40) % 10007;
+	x1 = (x4 * 6 + x5 + 77) % 10007;
+	x5 = (x4 + x6 + 28) % 10007;
+	x6 = (x2 + x0 + 48) % 10007;
+	x2 = (x1 * 6 + x5 + 93) % 10007;
+	x5 = (x0 + x2 + 98) % 10007;
+	x5 = (x0 * 4 + x3 + 70) % 10007;
+	x4 = (x6 + x5 + 72) % 10007;
+	x5 = (x2 + x7 + 47) % 10007;
+	x0 = (x3 + x4 + 71) % 10007;
+	x2 = (x5 + x6 + 20) % 10007;
+	x7 = (x0 + x1 + 45) % 10007;
+	x0 = (x6 + x7 + 24) % 10007;
+	x2 = (x5 * 7 + x6 + 22) % 10007;
+	x2 = (x5 * 5 + x7 + 68) % 10007;
+	x2 = (x5 * 3 + x0 + 37) % 10007;
+	x3 = (x3 * 7 + x5 + 94) % 10007;
+	x0 = (x4 * 5 + x1 + 90) % 10007;
+	x6 = (x2 * 9 + x7 + 18) % 10007;
+	x7 = (x0 + x6 + 70) % 10007;
+	x7 = (x0 * 8 + x5 + 95) % 10007;
+	x2 = (x7 + x7 + 65) % 10007;
+	x0 = (x7 * 6 + x0 + 42) % 10007;
+	x3 = (x0 + x6 + 93) % 10007;
+	x5 = (x7 * 8 + x2 + 26) % 10007;
+	x3 = (x0 + x1 + 51) % 10007;
+	x0 = (x3 * 9 + x2 + 65) % 10007;
+	x4 = (x3 * 4 + x3 + 47) % 10007;
+	x3 = (x7 + x6 + 69) % 10007;
+	x2 = (x7 + x4 + 22) % 10007;
+	x6 = (x7 + x6 + 73) % 10007;
+	x6 = (x4 * 8 + x0 + 23) % 10007;
+	x6 = (x5 + x3 + 11) % 10007;
+	x5 = (x4 * 8 + x0 + 24) % 10007;
+	x3 = (x2 + x1 + 85) % 10007;
+	x4 = (x5 + x3 + 23) % 10007;
+	x2 = (x2 * 2 + x3 + 21) % 10007;
+	x2 = (x3 * 9 + x3 + 66) % 10007;
+	x6 = (x0 * 8 + x0 + 84) % 10007;
+	x3 = (x6 * 8 + x3 + 32) % 10007;
+	x6 = (x3 + x3 + 98) % 10007;
+	x1 = (x6 + x3 + 86) % 10007;
+	x4 = (x0 + x4 + 44) % 10007;
+	x0 = (x7 + x7 + 29) % 10007;
+	x6 = (x2 + x6 + 47) % 10007;
+	x5 = (x2 * 4 + x7 + 3) % 10007;
+	x2 = (x6 + x1 + 65) % 10007;
+	x7 = (x3 + x1 + 14) % 10007;
+	x2 = (x4 * 3 + x2 + 40) % 10007;
+	x3 = (x1 + x2 + 14) % 10007;
+	x6 = (x1 + x6 + 81) % 10007;
+	x3 = (x4 + x7 + 42) % 10007;
+	x6 = (x3 + x3 + 61) % 10007;
+	x6 = (x2 + x1 + 60) % 10007;
+	x4 = (x2 * 5 + x2 + 65) % 10007;
+	x3 = (x4 + x2 + 30) % 10007;
+	x1 = (x6 + x2 + 90) % 10007;
+	x7 = (x6 + x1 + 93) % 10007;
+	x7 = (x1 + x6 + 8) % 10007;
+	x3 = (x0 + x1 + 23) % 10007;
+	x1 = (x1 * 5 + x2 + 94) % 10007;
+	x2 = (x1 * 7 + x6 + 98) % 10007;
+	x6 = (x4 + x1 + 15) % 10007;
+	x2 = (x1 + x5 + 18) % 10007;
+	x3 = (x4 * 7 + x4 + 37) % 10007;
+	x1 = (x7 + x6 + 65) % 10007;
+	x5 = (x1 * 2 + x6 + 98) % 10007;
+	x0 = (x6 + x7 + 85) % 10007;
+	x1 = (x7 * 2 + x5 + 42) % 10007;
+	x3 = (x5 + x7 + 95) % 10007;
+	x2 = (x6 * 7 + x0 + 68) % 10007;
+	x7 = (x3 * 5 + x4 + 48) % 10007;
+	x5 = (x4 + x3 + 48) % 10007;
+	x1 = (x7 * 6 + x4 + 49) % 10007;
+	x4 = (x5 + x3 + 46) % 10007;
+	x6 = (x2 * 4 + x0 + 51) % 10007;
+	x3 = (x4 + x2 + 38) % 10007;
+	x0 = (x0 * 9 + x5 + 35) % 10007;
+	x7 = (x0 * 8 + x7 + 77) % 10007;
+	x7 = (x2 * 4 + x6 + 50) % 10007;
+	x5 = (x2 * 8 + x2 + 19) % 10007;
+	x5 = (x1 * 4 + x3 + 28) % 10007;
+	x4 = (x4 + x7 + 34) % 10007;
+	x4 = (x7 + x5 + 59) % 10007;
+	x6 = (x2 * 8 + x6 + 31) % 10007;
+	x6 = (x6 + x2 + 15) % 10007;
+	x1 = (x4 * 9 + x6 + 53) % 10007;
+	x5 = (x4 + x4 + 42) % 10007;
+	x5 = (x4 + x7 + 69) % 10007;
+	x0 = (x4 + x4 + 95) % 10007;
+	x2 = (x7 * 3 + x5 + 39) % 10007;
+	x3 = (x5 + x2 + 27) % 10007;
+	x2 = (x0 * 8 + x3 + 74) % 10007;
+	x4 = (x4 + x3 + 85) % 10007;
+	x6 = (x5 * 3 + x5 + 61) % 10007;
+	x7 = (x3 * 9 + x7 + 82) % 10007;
+	x0 = (x0 * 7 + x1 + 78) % 10007;
+	x2 = (x5 * 7 + x4 + 11) % 10007;
+	x4 = (x3 + x4 + 22) % 10007;
+	x4 = (x3 + x2 + 33) % 10007;
+	x7 = (x1 + x5 + 4) % 10007;
+	x1 = (x7 + x1 + 82) % 10007;
+	x4 = (x6 * 8 + x4 + 76) % 10007;
+	x5 = (x1 + x6 + 2) % 10007;
+	x4 = (x1 * 5 + x2 + 68) % 10007;
+	x4 = (x7 * 7 + x2 + 38) % 10007;
+	x3 = (x0 + x5 + 89) % 10007;
+	x3 = (x2 + x3 + 18) % 10007;
+	x1 = (x2 + x5 + 28) % 10007;
+	x0 = (x0 + x3 + 48) % 10007;
+	x2 = (x4 * 7 + x1 + 59) % 10007;
+	x4 = (x5 + x1 + 4) % 10007;
+	x0 = (x4 * 6 + x2 + 45) % 10007;
+	x6 = (x0 * 5 + x1 + 73) % 10007;
+	x7 = (x7 * 8 + x6 + 9) % 10007;
+	x2 = (x6 * 9 + x7 + 16) % 10007;
+	x5 = (x2 * 7 + x1 + 27) % 10007;
+	x4 = (x6 + x2 + 99) % 10007;
+	x1 = (x5 + x7 + 29) % 10007;
+	x4 = (x5 * 8 + x7 + 16) % 10007;
+	x2 = (x3 * 8 + x6 + 83) % 10007;
+	x0 = (x1 + x5 + 68) % 10007;
+	x5 = (x6 + x0 + 88) % 10007;
+	x0 = (x6 * 3 + x5 + 78) % 10007;
+	x1 = (x3 + x0 + 1) % 10007;
+	x5 = (x7 * 6 + x5 + 97) % 10007;
+	x3 = (x6 + x2 + 34) % 10007;
+	x6 = (x5 * 9 + x5 + 98) % 10007;
+	x5 = (x7 + x2 + 3) % 10007;
+	x0 = (x1 * 4 + x1 + 26) % 10007;
+	x1 = (x1 * 7 + x0 + 1) % 10007;
+	x3 = (x6 * 6 + x5 + 74) % 10007;
+	x3 = (x3 * 9 + x0 + 84) % 10007;
+	x3 = (x6 + x1 + 98) % 10007;
+	x4 = (x6 + x0 + 99) % 10007;
+	x1 = (x3 * 2 + x1 + 73) % 10007;
+	x5 = (x2 + x4 + 60) % 10007;
+	x1 = (x7 + x6 + 28) % 10007;
+	x4 = (x5 + x5 + 94) % 10007;
+	x3 = (x0 + x0 + 79) % 10007;
+	x3 = (x7 + x1 + 69) % 10007;
+	x4 = (x3 * 9 + x2 + 74) % 10007;
+	x7 = (x0 + x7 + 98) % 10007;
+	x2 = (x5 * 3 + x6 + 29) % 10007;
+	x5 = (x7 * 8 + x6 + 94) % 10007;
+	x0 = (x5 * 6 + x6 + 30) % 10007;
+	x7 = (x3 + x2 + 80) % 10007;
+	x2 = (x5 + x1 + 85) % 10007;
+	x0 = (x4 * 3 + x1 + 26) % 10007;
+	x2 = (x5 * 9 + x3 + 73) % 10007;
+	x7 = (x6 + x7 + 8) % 10007;
+	x0 = (x7 * 4 + x4 + 20) % 10007;
+	x0 = (x3 + x5 + 97) % 10007;
+	x3 = (x7 + x2 + 8) % 10007;
+	x6 = (x1 + x2 + 60) % 10007;
+	x1 = (x2 + x3 + 2) % 10007;
+	x6 = (x6 + x5 + 84) % 10007;
+	x4 = (x0 * 4 + x4 + 95) % 10007;
+	x3 = (x1 * 7 + x1 + 55) % 10007;
+	x2 = (x0 * 9 + x4 + 49) % 10007;
+	x7 = (x4 * 6 + x5 + 54) % 10007;
+	x1 = (x4 * 8 + x2 + 20) % 10007;
+	x6 = (x5 * 2 + x7 + 27) % 10007;
+	x6 = (x0 * 5 + x4 + 89) % 10007;
+	x6 = (x1 + x5 + 2) % 10007;
+	x5 = (x0 * 6 + x0 + 98) % 10007;
+	x3 = (x1 + x0 + 20) % 10007;
+	x2 = (x3 + x3 + 42) % 10007;
+	x6 = (x0 * 9 + x1 + 49) % 10007;
+	x2 = (x0 * 4 + x4 + 99) % 10007;
+	x6 = (x1 + x5 + 26) % 10007;
+	x0 = (x4 + x2 + 99) % 10007;
+	x1 = (x4 * 6 + x3 + 3) % 10007;
+	x2 = (x4 * 9 + x7 + 70) % 10007;
+	x2 = (x1 * 3 + x3 + 60) % 10007;
+	x7 = (x3 * 6 + x2 + 95) % 10007;
+	x0 = (x0 * 5 + x3 + 10) % 10007;
+	x7 = (x1 * 8 + x7 + 85) % 10007;
+	x0 = (x6 + x2 + 84) % 10007;
+	x0 = (x2 + x1 + 73) % 10007;
+	x4 = (x0 + x5 + 33) % 10007;
+	x3 = (x7 * 8 + x0 + 38) % 10007;
+	x5 = (x4 * 4 + x3 + 78) % 10007;
+	x3 = (x0 + x6 + 8) % 10007;
+	x7 = (x2 + x5 + 72) % 10007;
+	x7 = (x1 + x0 + 65) % 10007;
+	x0 = (x4 + x6 + 71) % 10007;
+	x0 = (x0 * 3 + x5 + 99) % 10007;
+	x7 = (x0 + x7 + 27) % 10007;
+	x4 = (x5 + x0 + 9) % 10007;
+	x0 = (x0 * 2 + x4 + 96) % 10007;
+	x4 = (x0 * 2 + x0 + 71) % 10007;
+	x3 = (x1 * 6 + x4 + 56) % 10007;
+	x0 = (x5 * 9 + x7 + 18) % 10007;
+	x4 = (x0 + x6 + 12) % 10007;
+	x6 = (x7 + x3 + 93) % 10007;
+	x4 = (x5 * 8 + x7 + 27) % 10007;
+	x4 = (x3 + x2 + 75) % 10007;
+	x2 = (x4 + x3 + 55) % 10007;
+	x1 = (x3 + x5 + 15) % 10007;
+	x0 = (x5 * 9 + x4 + 9) % 10007;
+	x0 = (x0 + x0 + 54) % 10007;
+	x5 = (x2 * 6 + x7 + 22) % 10007;
+	x6 = (x6 * 7 + x7 + 76) % 10007;
+	x2 = (x4 * 5 + x4 + 83) % 10007;
+	x1 = (x4 * 8 + x4 + 31) % 10007;
+	x1 = (x2 * 4 + x6 + 36) % 10007;
+	x2 = (x4 + x3 + 99) % 10007;
+	x4 = (x7 * 6 + x6 + 48) % 10007;
+	x5 = (x1 * 3 + x4 + 10) % 10007;
+	x0 = (x4 + x1 + 32) % 10007;
+	x5 = (x3 * 2 + x1 + 84) % 10007;
+	x4 = (x1 + x3 + 34) % 10007;
+	x3 = (x4 * 8 + x0 + 93) % 10007;
+	x1 = (x5 + x4 + 94) % 10007;
+	x4 = (x1 + x7 + 95) % 10007;
+	x7 = (x0 * 4 + x7 + 21) % 10007;
+	x4 = (x6 * 5 + x4 + 59) % 10007;
+	x6 = (x5 + x0 + 74) % 10007;
+	x6 = (x2 * 9 + x4 + 10) % 10007;
+	x6 = (x3 + x5 + 62) % 10007;
+	x7 = (x6 * 5 + x2 + 63) % 10007;
+	x1 = (x6 * 6 + x2 + 13) % 10007;
+	x1 = (x0 + x3 + 10) % 10007;
+	x3 = (x6 * 6 + x5 + 17) % 10007;
+	x2 = (x0 * 5 + x6 + 43) % 10007;
+	x5 = (x3 * 6 + x2 + 18) % 10007;
+	x6 = (x0 + x0 + 28) % 10007;
+	x3 = (x5 * 6 + x6 + 34) % 10007;
+	x5 = (x7 * 3 + x1 + 48) % 10007;
+	x5 = (x3 + x3 + 39) % 10007;
+	x0 = (x5 * 5 + x3 + 93) % 10007;
+	x4 = (x3 * 6 + x3 + 98) % 10007;
+	x2 = (x5 * 3 + x3 + 71) % 10007;
+	x2 = (x0 * 6 + x6 + 76) % 10007;
+	x4 = (x4 * 4 + x5 + 80) % 10007;
+	x7 = (x5 + x1 + 11) % 10007;
+	x0 = (x3 + x6 + 29) % 10007;
+	x2 = (x0 + x0 + 83) % 10007;
+	x4 = (x6 * 7 + x5 + 91) % 10007;
+	x1 = (x3 * 8 + x7 + 28) % 10007;
+	x6 = (x4 + x0 + 70) % 10007;
+	x6 = (x2 + x0 + 98) % 10007;
+	x1 = (x1 * 7 + x4 + 56) % 10007;
+	x2 = (x3 * 9 + x7 + 4) % 10007;
+	x3 = (x6 * 3 + x7 + 39) % 10007;
+	x5 = (x7 + x1 + 17) % 10007;
+	x6 = (x7 + x5 + 54) % 10007;
+	x1 = (x3 * 4 + x7 + 32) % 10007;
+	x1 = (x5 + x5 + 67) % 10007;
+	x1 = (x7 * 7 + x0 + 21) % 10007;
+	x6 = (x0 * 7 + x2 + 76) % 10007;
+	x1 = (x1 + x7 + 34) % 10007;
+	x7 = (x7 * 3 + x3 + 55) % 10007;
+	x6 = (x5 + x6 + 71) % 10007;
+	x6 = (x6 * 9 + x5 + 76) % 10007;
+	x4 = (x1 * 6 + x1 + 73) % 10007;
+	x4 = (x7 * 8 + x5 + 17) % 10007;
+	x4 = (x5 * 5 + x0 + 53) % 10007;
+	x4 = (x5 + x2 + 69) % 10007;
+	x1 = (x0 + x5 + 66) % 10007;
+	x2 = (x3 * 8 + x4 + 43) % 10007;
+	x0 = (x2 * 5 + x0 + 25) % 10007;
+	x2 = (x5 + x2 + 53) % 10007;
+	x5 = (x5 * 3 + x4 + 62) % 10007;
+	x5 = (x5 + x6 + 78) % 10007;
+	x3 = (x7 * 7 + x4 + 41) % 10007;
+	x7 = (x0 + x6 + 68) % 10007;
+	x4 = (x3 * 5 + x6 + 77) % 10007;
+	x2 = (x4 * 3 + x6 + 47) % 10007;
+	x3 = (x7 * 3 + x2 + 15) % 10007;
+	x7 = (x2 + x7 + 37) % 10007;
+	x2 = (x4 + x0 + 72) % 10007;
+	x7 = (x7 + x2 + 42) % 10007;
+	x7 = (x4 + x2 + 93) % 10007;
+	x0 = (x4 * 7 + x5 + 92) % 10007;
+	x4 = (x7 + x7 + 85) % 10007;
+	x3 = (x1 + x0 + 2) % 10007;
+	x2 = (x2 * 5 + x1 + 52) % 10007;
+	x2 = (x7 * 7 + x5 + 1) % 10007;
+	x6 = (x2 * 4 + x4 + 47) % 10007;
+	x4 = (x0 * 4 + x7 + 90) % 10007;
+	x3 = (x5 + x3 + 37) % 10007;
+	x0 = (x6 + x0 + 89) % 10007;
+	x4 = (x1 * 4 + x4 + 5) % 10007;
+	x1 = (x0 * 6 + x6 + 68) % 10007;
+	x3 = (x6 + x0 + 76) % 10007;
+	x2 = (x7 * 5 + x6 + 64) % 10007;
+	x0 = (x2 + x7 + 98) % 10007;
+	x4 = (x7 + x5 + 28) % 10007;
+	x3 = (x6 + x6 + 42) % 10007;
+	x5 = (x4 + x6 + 50) % 10007;
+	x0 = (x6 + x1 + 85) % 10007;
+	x1 = (x4 + x1 + 6) % 10007;
+	x3 = (x3 + x6 + 55) % 10007;
+	x0 = (x3 * 7 + x3 + 48) % 10007;
+	x0 = (x5 * 3 + x2 + 26) % 10007;
+	x5 = (x4 * 5 + x7 + 47) % 10007;
+	x2 = (x3 + x6 + 83) % 10007;
+	x4 = (x4 * 9 + x6 + 74) % 10007;
+	x7 = (x1 + x7 + 73) % 10007;
+	x6 = (x0 * 7 + x3 + 67) % 10007;
+	x0 = (x5 + x4 + 65) % 10007;
+	x7 = (x2 * 2 + x0 + 20) % 10007;
+	x6 = (x6 * 5 + x4 + 68) % 10007;
+	x6 = (x5 * 3 + x5 + 94) % 10007;
+	x5 = (x0 * 6 + x3 + 38) % 10007;
+	x3 = (x6 * 5 + x7 + 11) % 10007;
+	x1 = (x1 + x2 + 85) % 10007;
+	x0 = (x7 * 7 + x4 + 20) % 10007;
+	x7 = (x4 + x5 + 95) % 10007;
+	x6 = (x1 * 9 + x2 + 53) % 10007;
+	x1 = (x0 + x3 + 95) % 10007;
+	x7 = (x4 * 5 + x7 + 57) % 10007;
+	x2 = (x0 * 2 + x4 + 4) % 10007;
+	x7 = (x3 + x7 + 30) % 10007;
+	x6 = (x2 + x1 + 76) % 10007;
+	x5 = (x1 * 6 + x4 + 68) % 10007;
+	x7 = (x2 + x2 + 64) % 10007;
+	x1 = (x6 + x6 + 55) % 10007;
+	x4 = (x0 + x1 + 42) % 10007;
+	x6 = (x2 + x2 + 79) % 10007;
+	x5 = (x4 * 3 + x7 + 91) % 10007;
+	x1 = (x2 * 5 + x6 + 86) % 10007;
+	x4 = (x0 + x2 + 99) % 10007;
+	x7 = (x0 + x5 + 33) % 10007;
+	x0 = (x5 + x7 + 67) % 10007;
+	x2 = (x7 + x6 + 97) % 10007;
+	x2 = (x0 + x2 + 20) % 10007;
+	x2 = (x5 * 5 + x0 + 83) % 10007;
+	x3 = (x6 + x3 + 48) % 10007;
+	x7 = (x3 + x4 + 12) % 10007;
+	x3 = (x7 + x3 + 65) % 10007;
+	x6 = (x5 * 8 + x2 + 52) % 10007;
+	x1 = (x1 + x3 + 95) % 10007;
+	x2 = (x3 * 3 + x6 + 41) % 10007;
+	x0 = (x2 * 8 + x0 + 52) % 10007;
+	x2 = (x3 * 4 + x4 + 8) % 10007;
+	x1 = (x5 + x2 + 45) % 10007;
+	x0 = (x7 + x5 + 2) % 10007;
+	x6 = (x6 * 8 + x3 + 16) % 10007;
+	x2 = (x2 * 7 + x5 + 64) % 10007;
+	x4 = (x5 + x6 + 4) % 10007;
+	x6 = (x1 + x4 + 96) % 10007;
+	x4 = (x7 + x1 + 63) % 10007;
+	x7 = (x6 * 2 + x1 + 75) % 10007;
+	x0 = (x5 + x5 + 92) % 10007;
+	x5 = (x2 + x4 + 31) % 10007;
+	x0 = (x7 * 7 + x1 + 41) % 10007;
+	x6 = (x5 * 6 + x0 + 28) % 10007;
+	x6 = (x6 + x6 + 18) % 10007;
+	x2 = (x3 * 4 + x1 + 18) % 10007;
+	x5 = (x6 + x0 + 35) % 10007;
+	x1 = (x2 * 7 + x0 + 45) % 10007;
+	x5 = (x7 * 3 + x3 + 60) % 10007;
+	x0 = (x3 + x1 + 31) % 10007;
+	x3 = (x4 + x2 + 34) % 10007;
+	x0 = (x3 + x0 + 34) % 10007;
+	x2 = (x4 + x2 + 69) % 10007;
+	x2 = (x5 * 6 + x4 + 31) % 10007;
+	x1 = (x6 * 2 + x3 + 94) % 10007;
+	x6 = (x2 + x1 + 54) % 10007;
+	x7 = (x2 * 4 + x5 + 60) % 10007;
+	x1 = (x3 * 2 + x5 + 12) % 10007;
+	x7 = (x2 + x5 + 97) % 10007;
+	x6 = (x0 + x4 + 80) % 10007;
+	x5 = (x0 * 7 + x4 + 68) % 10007;
+	x0 = (x2 * 8 + x1 + 82) % 10007;
+	x2 = (x6 * 6 + x0 + 99) % 10007;
+	x2 = (x1 + x6 + 22) % 10007;
+	x4 = (x4 + x3 + 85) % 10007;
+	x6 = (x6 + x4 + 29) % 10007;
+	x1 = (x0 * 2 + x5 + 44) % 10007;
+	x1 = (x2 + x6 + 81) % 10007;
+	x4 = (x7 * 9 + x7 + 62) % 10007;
+	x3 = (x6 * 8 + x5 + 68) % 10007;
+	x4 = (x5 * 6 + x7 + 64) % 10007;
+	x7 = (x1 + x5 + 34) % 10007;
+	x6 = (x0 + x1 + 55) % 10007;
+	x0 = (x0 * 6 + x1 + 90) % 10007;
+	x5 = (x3 + x7 + 10) % 10007;
+	x6 = (x0 + x1 + 49) % 10007;
+	x0 = (x2 + x3 + 36) % 10007;
+	x0 = (x2 + x6 + 43) % 10007;
+	x2 = (x1 + x1 + 15) % 10007;
+	x7 = (x5 + x5 + 5) % 10007;
+	x7 = (x0 + x1 + 51) % 10007;
+	x5 = (x4 * 5 + x3 + 67) % 10007;
+	x5 = (x4 * 3 + x0 + 26) % 10007;
+	x2 = (x4 * 7 + x4 + 67) % 10007;
+	x0 = (x7 * 2 + x2 + 72) % 10007;
+	x0 = (x1 + x6 + 20) % 10007;
+	x2 = (x3 * 6 + x0 + 4) % 10007;
+	x5 = (x6 + x6 + 71) % 10007;
+	x2 = (x0 + x7 + 88) % 10007;
+	x7 = (x2 * 2 + x1 + 9) % 10007;
+	x1 = (x6 * 8 + x5 + 30) % 10007;
+	x3 = (x7 * 8 + x2 + 45) % 10007;
+	x3 = (x0 * 8 + x1 + 93) % 10007;
+	x6 = (x4 * 4 + x3 + 94) % 10007;
+	x7 = (x3 + x0 + 51) % 10007;
+	x2 = (x6 * 5 + x4 + 64) % 10007;
+	x7 = (x2 * 4 + x5 + 27) % 10007;
+	x7 = (x4 * 9 + x2 + 10) % 10007;
+	x6 = (x3 * 3 + x3 + 91) % 10007;
+	x4 = (x4 * 5 + x2 + 15) % 10007;
+	x6 = (x4 + x5 + 79) % 10007;
+	x4 = (x6 + x4 + 65) % 10007;
+	x0 = (x0 + x1 + 38) % 10007;
+	x5 = (x0 + x5 + 57) % 10007;
+	x1 = (x0 * 6 + x5 + 9) % 10007;
+	x5 = (x5 * 4 + x3 + 47) % 10007;
+	x0 = (x1 * 4 + x3 + 72) % 10007;
+	x0 = (x7 * 2 + x1 + 40) % 10007;
+	x1 = (x5 + x4 + 78) % 10007;
+	x1 = (x3 + x4 + 13) % 10007;
+	x0 = (x5 + x6 + 68) % 10007;
+	x1 = (x1 * 8 + x6 + 10) % 10007;
+	x4 = (x1 + x3 + 45) % 10007;
+	x3 = (x3 * 6 + x0 + 94) % 10007;
+	x2 = (x0 + x2 + 16) % 10007;
+	x0 = (x0 + x0 + 53) % 10007;
+	x2 = (x3 * 9 + x3 + 95) % 10007;
+	x0 = (x6 + x2 + 7) % 10007;
+	x4 = (x4 + x0 + 43) % 10007;
+	x1 = (x0 + x5 + 73) % 10007;
+	x6 = (x4 * 6 + x4 + 79) % 10007;
+	x0 = (x3 + x4 + 16) % 10007;
+	x4 = (x6 + x1 + 85) % 10007;
+	x0 = (x3 * 7 + x0 + 54) % 10007;
+	x6 = (x4 + x7 + 87) % 10007;
+	x3 = (x7 * 8 + x2 + 16) % 10007;
+	x1 = (x6 * 2 + x6 + 90) % 10007;
+	x1 = (x7 * 8 + x7 + 44) % 10007;
+	x3 = (x6 * 3 + x0 + 52) % 10007;
+	x1 = (x4 + x0 + 3) % 10007;
+	x4 = (x6 * 4 + x3 + 38) % 10007;
+	x2 = (x0 * 5 + x6 + 63) % 10007;
+	x7 = (x0 + x2 + 8) % 10007;
+	x4 = (x7 * 7 + x5 + 92) % 10007;
+	x7 = (x7 * 6 + x7 + 64) % 10007;
+	x0 = (x2 * 2 + x5 + 19) % 10007;
+	x7 = (x4 * 3 + x6 + 51) % 10007;
+	x7 = (x1 + x6 + 18) % 10007;
+	x0 = (x4 * 9 + x5 + 71) % 10007;
+	x1 = (x6 + x0 + 57) % 10007;
+	x2 = (x4 + x4 + 47) % 10007;
+	x2 = (x7 + x4 + 93) % 10007;
+	x5 = (x2 * 6 + x6 + 8) % 10007;
+	x5 = (x5 + x3 + 22) % 10007;
+	x5 = (x1 + x6 + 83) % 10007;
+	x7 = (x2 * 4 + x5 + 90) % 10007;
+	x0 = (x4 * 5 + x7 + 50) % 10007;
+	x1 = (x1 * 4 + x4 + 77) % 10007;
+	x1 = (x7 + x4 + 93) % 10007;
+	x3 = (x5 + x6 + 40) % 10007;
+	x0 = (x2 * 4 + x6 + 88) % 10007;
+	x7 = (x1 + x2 + 9) % 10007;
+	x7 = (x7 + x4 + 66) % 10007;
+	x0 = (x7 + x6 + 71) % 10007;
+	x0 = (x1 + x3 + 80) % 10007;
+	x7 = (x5 + x0 + 5) % 10007;
+	x5 = (x0 * 9 + x7 + 13) % 10007;
+	x0 = (x7 + x4 + 30) % 10007;
+	x5 = (x0 + x4 + 78) % 10007;
+	x3 = (x7 + x2 + 47) % 10007;
+	x1 = (x1 + x1 + 14) % 10007;
+	x4 = (x1 + x7 + 45) % 10007;
+	x4 = (x2 + x2 + 82) % 10007;
+	x1 = (x6 * 5 + x2 + 48) % 10007;
+	x7 = (x4 * 8 + x7 + 27) % 10007;
+	x4 = (x3 + x7 + 65) % 10007;
+	x6 = (x3 + x2 + 17) % 10007;
+	x6 = (x7 * 5 + x0 + 3) % 10007;
+	x2 = (x7 + x1 + 12) % 10007;
+	x6 = (x4 * 9 + x7 + 4) % 10007;
+	x2 = (x6 * 4 + x4 + 72) % 10007;
+	x3 = (x0 * 8 + x1 + 48) % 10007;
+	x2 = (x1 + x2 + 58) % 10007;
+	x0 = (x4 + x2 + 1) % 10007;
+	x6 = (x0 + x7 + 4) % 10007;
+	x1 = (x4 * 5 + x1 + 42) % 10007;
+	x0 = (x6 * 9 + x1 + 85) % 10007;
+	x2 = (x3 * 3 + x7 + 79) % 10007;
+	x7 = (x6 * 6 + x6 + 40) % 10007;
+	x2 = (x6 * 2 + x5 + 2) % 10007;
+	x6 = (x6 + x6 + 53) % 10007;
+	x6 = (x1 * 8 + x4 + 82) % 10007;
+	x7 = (x3 * 2 + x7 + 63) % 10007;
+	x2 = (x5 + x3 + 87) % 10007;
+	x2 = (x7 + x5 + 36) % 10007;
+	x1 = (x7 + x5 + 12) % 10007;
+	x6 = (x6 + x6 + 26) % 10007;
+	x6 = (x5 + x2 + 18) % 10007;
+	x4 = (x3 + x4 + 25) % 10007;
+	x3 = (x6 * 4 + x0 + 25) % 10007;
+	x1 = (x4 + x1 + 67) % 10007;
+	x7 = (x6 * 4 + x4 + 82) % 10007;
+	x2 = (x0 * 5 + x0 + 81) % 10007;
+	x4 = (x6 + x0 + 6) % 10007;
+	x6 = (x2 + x3 + 49) % 10007;
+	x6 = (x3 * 8 + x2 + 23) % 10007;
+	x1 = (x2 + x6 + 74) % 10007;
+	x1 = (x3 * 3 + x1 + 68) % 10007;
+	x6 = (x7 + x4 + 31) % 10007;
+	x2 = (x6 * 2 + x6 + 46) % 10007;
+	x3 = (x5 + x2 + 73) % 10007;
+	x5 = (x7 + x4 + 60) % 10007;
+	x6 = (x0 + x0 + 82) % 10007;
+	x5 = (x1 * 4 + x4 + 31) % 10007;
+	x5 = (x5 + x4 + 64) % 10007;
+	x1 = (x7 + x5 + 7) % 10007;
+	x0 = (x3 * 9 + x6 + 66) % 10007;
+	x7 = (x6 + x5 + 24) % 10007;
+	x6 = (x5 + x1 + 82) % 10007;
+	x4 = (x7 * 8 + x2 + 61) % 10007;
+	x5 = (x1 + x3 + 57) % 10007;
+	x3 = (x0 * 7 + x3 + 60) % 10007;
+	x4 = (x5 + x5 + 60) % 10007;
+	x3 = (x4 + x3 + 61) % 10007;
+	x6 = (x1 + x3 + 34) % 10007;
+	x6 = (x2 * 8 + x5 + 24) % 10007;
+	x2 = (x2 * 4 + x0 + 41) % 10007;
+	x0 = (x0 * 3 + x2 + 39) % 10007;
+	x4 = (x0 + x4 + 90) % 10007;
+	x7 = (x5 * 8 + x5 + 12) % 10007;
+	x4 = (x6 + x0 + 33) % 10007;
+	x5 = (x0 * 3 + x3 + 70) % 10007;
+	x2 = (x6 * 7 + x0 + 47) % 10007;
+	x7 = (x0 + x1 + 98) % 10007;
+	x2 = (x1 + x5 + 9) % 10007;
+	x6 = (x6 * 8 + x3 + 11) % 10007;
+	x2 = (x1 * 6 + x2 + 10) % 10007;
+	x4 = (x5 * 8 + x6 + 29) % 10007;
+	x4 = (x1 * 9 + x4 + 7) % 10007;
+	x4 = (x4 * 2 + x2 + 4) % 10007;
+	x3 = (x2 * 6 + x1 + 15) % 10007;
+	x2 = (x3 + x3 + 17) % 10007;
+	x7 = (x6 * 5 + x3 + 71) % 10007;
+	x3 = (x7 * 9 + x7 + 18) % 10007;
+	x6 = (x5 * 3 + x5 + 62) % 10007;
+	x2 = (x0 + x6 + 14) % 10007;
+	x2 = (x3 + x1 + 72) % 10007;
+	x0 = (x1 + x6 + 54) % 10007;
+	x2 = (x1 * 9 + x7 + 33) % 10007;
+	x7 = (x2 + x0 + 11) % 10007;
+	x6 = (x2 + x0 + 38) % 10007;
+	x4 = (x7 * 5 + x3 + 1) % 10007;
+	x5 = (x0 * 5 + x7 + 7) % 10007;
+	x0 = (x5 + x2 + 34) % 10007;
+	x5 = (x2 * 2 + x0 + 45) % 10007;
+	x1 = (x6 + x5 + 36) % 10007;
+	x3 = (x1 + x1 + 97) % 10007;
+	x1 = (x7 + x5 + 62) % 10007;
+	x1 = (x6 * 8 + x2 + 67) % 10007;
+	x5 = (x7 + x6 + 50) % 10007;
+	x0 = (x7 * 3 + x0 + 77) % 10007;
+	x5 = (x3 + x7 + 21) % 10007;
+	x2 = (x7 * 5 + x4 + 46) % 10007;
+	x5 = (x0 * 3 + x5 + 66) % 10007;
+	x0 = (x3 * 9 + x6 + 4) % 10007;
+	x6 = (x2 * 3 + x3 + 25) % 10007;
+	x2 = (x2 * 2 + x3 + 28) % 10007;
+	x5 = (x1 * 4 + x6 + 75) % 10007;
+	x0 = (x2 * 2 + x0 + 58) % 10007;
+	x2 = (x7 * 6 + x4 + 50) % 10007;
+	x4 = (x6 * 9 + x5 + 63) % 10007;
+	x5 = (x3 * 3 + x7 + 49) % 10007;
+	x4 = (x2 * 3 + x2 + 96) % 10007;
+	x5 = (x0 + x5 + 33) % 10007;
+	x4 = (x6 + x5 + 23) % 10007;
+	x7 = (x3 * 2 + x0 + 4) % 10007;
+	x2 = (x6 + x5 + 71) % 10007;
+	x5 = (x5 * 7 + x2 + 42) % 10007;
+	x3 = (x4 + x3 + 51) % 10007;
+	x7 = (x5 + x4 + 74) % 10007;
+	x6 = (x0 + x7 + 66) % 10007;
+	x5 = (x0 + x1 + 62) % 10007;
+	x1 = (x1 + x3 + 10) % 10007;
+	x6 = (x1 + x1 + 94) % 10007;
+	x6 = (x1 * 6 + x3 + 42) % 10007;
+	x5 = (x2 + x5 + 99) % 10007;
+	x5 = (x5 * 9 + x5 + 26) % 10007;
+	x3 = (x0 + x4 + 13) % 10007;
+	x7 = (x0 + x0 + 11) % 10007;
+	x7 = (x7 * 2 + x7 + 59) % 10007;
+	x3 = (x5 + x2 + 26) % 10007;
+	x1 = (x1 + x4 + 39) % 10007;
+	x5 = (x1 + x0 + 70) % 10007;
+	x7 = (x5 + x2 + 16) % 10007;
+	x2 = (x0 * 5 + x4 + 32) % 10007;
+	x1 = (x7 * 2 + x5 + 97) % 10007;
+	x1 = (x5 + x1 + 22) % 10007;
+	x0 = (x5 * 3 + x7 + 80) % 10007;
+	x4 = (x4 + x0 + 33) % 10007;
+	x1 = (x3 * 7 + x4 + 48) % 10007;
+	x0 = (x3 + x7 + 13) % 10007;
+	x7 = (x2 * 2 + x4 + 91) % 10007;
+	x2 = (x5 + x2 + 15) % 10007;
+	x2 = (x7 * 7 + x1 + 81) % 10007;
+	x7 = (x6 * 4 + x4 + 78) % 10007;
+	x4 = (x0 * 6 + x6 + 67) % 10007;
+	x4 = (x6 + x4 + 70) % 10007;
+	x3 = (x5 * 3 + x5 + 33) % 10007;
+	x5 = (x7 * 9 + x7 + 84) % 10007;
+	x1 = (x7 + x1 + 16) % 10007;
+	x4 = (x4 + x2 + 65) % 10007;
+	x1 = (x0 + x2 + 83) % 10007;
+	x7 = (x6 + x2 + 9) % 10007;
+	x5 = (x0 * 9 + x6 + 3) % 10007;
+	x7 = (x5 * 3 + x6 + 62) % 10007;
+	x3 = (x3 + x0 + 24) % 10007;
+	x7 = (x3 * 8 + x7 + 39) % 10007;
+	x5 = (x3 + x5 + 49) % 10007;
+	x4 = (x1 * 5 + x6 + 92) % 10007;
+	x2 = (x7 + x0 + 46) % 10007;
+	x2 = (x3 + x1 + 14) % 10007;
+	x2 = (x4 + x1 + 49) % 10007;
+	x7 = (x0 + x4 + 62) % 10007;
+	x0 = (x3 * 4 + x2 + 91) % 10007;
+	x1 = (x5 * 8 + x5 + 88) % 10007;
+	x4 = (x6 + x7 + 80) % 10007;
+	x6 = (x7 + x6 + 31) % 10007;
+	x1 = (x3 * 4 + x5 + 54) % 10007;
+	x4 = (x4 + x4 + 33) % 10007;
+	x3 = (x6 + x3 + 6) % 10007;
+	x2 = (x6 * 5 + x3 + 84) % 10007;
+	x3 = (x5 * 5 + x3 + 92) % 10007;
+	x6 = (x4 + x3 + 49) % 10007;
+	x7 = (x4 * 5 + x2 + 85) % 10007;
+	x2 = (x0 + x4 + 30) % 10007;
+	x5 = (x1 * 9 + x2 + 15) % 10007;
+	x2 = (x2 * 7 + x1 + 19) % 10007;
+	x0 = (x4 + x6 + 42) % 10007;
+	x2 = (x1 + x4 + 53) % 10007;
+	x0 = (x6 * 6 + x2 + 29) % 10007;
+	x1 = (x7 * 4 + x4 + 27) % 10007;
+	x2 = (x3 + x5 + 21) % 10007;
+	x5 = (x5 + x5 + 56) % 10007;
+	x0 = (x3 + x0 + 41) % 10007;
+	x3 = (x2 * 7 + x1 + 10) % 10007;
+	x7 = (x2 * 5 + x6 + 57) % 10007;
+	x1 = (x6 * 7 + x1 + 49) % 10007;
+	x0 = (x0 * 5 + x2 + 91) % 10007;
+	x7 = (x0 + x1 + 86) % 10007;
+	x3 = (x5 * 5 + x0 + 84) % 10007;
+	x0 = (x2 * 5 + x6 + 63) % 10007;
+	x4 = (x4 * 6 + x3 + 6) % 10007;
+	x4 = (x2 + x0 + 64) % 10007;
+	x3 = (x1 * 5 + x2 + 96) % 10007;
+	x3 = (x2 + x4 + 93) % 10007;
+	x7 = (x2 * 8 + x4 + 76) % 10007;
+	x1 = (x3 + x5 + 43) % 10007;
+	x0 = (x6 * 7 + x7 + 73) % 10007;
+	x3 = (x1 + x1 + 30) % 10007;
+	x7 = (x0 * 5 + x6 + 81) % 10007;
+	x7 = (x0 * 3 + x3 + 20) % 10007;
+	x1 = (x5 * 2 + x0 + 67) % 10007;
+	x3 = (x4 + x5 + 72) % 10007;
+	x3 = (x7 + x6 + 88) % 10007;
+	x3 = (x5 + x6 + 61) % 10007;
+	x4 = (x3 * 8 + x5 + 2) % 10007;
+	x5 = (x4 + x0 + 30) % 10007;
+	x4 = (x1 * 9 + x1 + 3) % 10007;
+	x7 = (x3 * 5 + x5 + 13) % 10007;
+	x0 = (x4 * 5 + x1 + 36) % 10007;
+	x6 = (x4 + x3 + 36) % 10007;
+	x1 = (x7 * 2 + x0 + 97) % 10007;
+	x0 = (x2 + x3 + 7) % 10007;
+	x4 = (x3 * 7 + x4 + 35) % 10007;
+	x1 = (x6 + x3 + 37) % 10007;
+	x2 = (x5 * 8 + x6 + 78) % 10007;
+	x0 = (x4 * 2 + x1 + 6) % 10007;
+	x3 = (x7 + x7 + 99) % 10007;
+	x2 = (x0 + x7 + 40) % 10007;
+	x3 = (x2 + x4 + 2) % 10007;
+	x0 = (x7 * 8 + x2 + 92) % 10007;
+	x2 = (x5 * 4 + x0 + 15) % 10007;
+	x1 = (x0 * 7 + x5 + 31) % 10007;
+	x2 = (x0 * 5 + x2 + 60) % 10007;
+	x5 = (x5 * 3 + x1 + 5) % 10007;
+	x2 = (x0 + x1 + 61) % 10007;
+	x2 = (x3 * 9 + x3 + 84) % 10007;
+	x4 = (x3 * 2 + x2 + 50) % 10007;
+	x5 = (x2 * 2 + x7 + 61) % 10007;
+	x6 = (x4 + x1 + 17) % 10007;
+	x7 = (x6 + x4 + 16) % 10007;
+	x5 = (x7 * 3 + x3 + 72) % 10007;
+	x7 = (x7 + x2 + 46) % 10007;
+	x7 = (x4 + x0 + 21) % 10007;
+	x0 = (x7 * 6 + x7 + 56) % 10007;
+	x1 = (x6 + x7 + 65) % 10007;
+	x0 = (x0 * 2 + x4 + 54) % 10007;
+	x4 = (x5 * 8 + x2 + 27) % 10007;
+	x7 = (x7 + x7 + 59) % 10007;
+	x7 = (x0 * 9 + x7 + 62) % 10007;
+	x2 = (x4 + x1 + 8) % 10007;
+	x2 = (x4 + x1 + 38) % 10007;
+	x0 = (x5 + x2 + 13) % 10007;
+	x3 = (x6 + x7 + 18) % 10007;
+	x6 = (x2 + x3 + 22) % 10007;
+	x3 = (x6 * 3 + x4 + 73) % 10007;
+	x2 = (x1 + x3 + 60) % 10007;
+	x7 = (x4 * 2 + x5 + 35) % 10007;
+	x6 = (x4 * 3 + x0 + 44) % 10007;
+	x7 = (x2 * 6 + x0 + 16) % 10007;
+	x5 = (x6 + x1 + 6) % 10007;
+	x2 = (x7 + x5 + 38) % 10007;
+	x1 = (x2 + x4 + 12) % 10007;
+	x7 = (x1 * 7 + x5 + 89) % 10007;
+	x7 = (x3 + x5 + 8) % 10007;
+	x0 = (x2 * 6 + x3 + 57) % 10007;
+	x4 = (x7 + x2 + 63) % 10007;
+	x0 = (x5 * 9 + x1 + 22) % 10007;
+	x1 = (x7 + x3 + 64) % 10007;
+	x7 = (x6 * 8 + x0 + 94) % 10007;
+	x3 = (x1 * 6 + x2 + 54) % 10007;
+	x7 = (x4 + x2 + 62) % 10007;
+	x2 = (x6 + x3 + 29) % 10007;
+	x6 = (x5 * 7 + x0 + 1) % 10007;
+	x0 = (x1 * 6 + x4 + 21) % 10007;
+	x3 = (x6 * 7 + x7 + 14) % 10007;
+	x2 = (x1 * 9 + x0 + 30) % 10007;
+	x4 = (x7 + x2 + 11) % 10007;
+	x5 = (x7 + x3 + 10) % 10007;
+	x4 = (x1 * 4 + x4 + 60) % 10007;
+	x5 = (x7 + x5 + 82) % 10007;
+	x7 = (x5 * 7 + x0 + 48) % 10007;
+	x5 = (x6 * 5 + x4 + 33) % 10007;
+	printf("%d %d %d %d\n", x0 + x1, x2 + x3, x4 + x5, x6 + x7);
+	return 0;
+}
@@ -0,0 +1,80 @@
+/*
+# arena
+=======
+
+a bump allocator, objects are carved out of large blocks one after another
+and are all freed at once by release, which also runs the destructors of
+the objects that have one
+*/
+
+#ifndef __CPL_ARENA_H__
+#define __CPL_ARENA_H__
+
+#include <vector>
+#include <new>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+
+namespace Mem {
+
+using namespace std;
+
+
+class Arena {
+public:
+	static const size_t blockSize = 1 << 16;
+
+	vector <char *> blocks;
+	char *cur = nullptr, *end = nullptr;
+	vector <pair <void *, void (*)(void *)>> destructors;
+
+	Arena() {}
+	Arena(const Arena &) = delete;
+	Arena &operator = (const Arena &) = delete;
+
+	~Arena() {
+		release();
+	}
+
+	void *allocate(size_t size, size_t align) {
+		size_t pad = -(uintptr_t)cur & (align - 1);
+		if (cur == nullptr || cur + pad + size > end) {
+			size_t len = max(size + align, blockSize);
+			cur = new char[len];
+			end = cur + len;
+			blocks.emplace_back(cur);
+			pad = -(uintptr_t)cur & (align - 1);
+		}
+		void *res = cur + pad;
+		cur += pad + size;
+		return res;
+	}
+
+	template <typename T, typename... Args>
+	T *make(Args &&...args) {
+		T *obj = new (allocate(sizeof(T), alignof(T))) T(forward <Args>(args)...);
+		if (!is_trivially_destructible <T>::value) {
+			destructors.emplace_back(obj, [](void *ptr) { ((T *)ptr)->~T(); });
+		}
+		return obj;
+	}
+
+	void release() {
+		for (auto it = destructors.rbegin(); it != destructors.rend(); ++it) {
+			it->second(it->first);
+		}
+		destructors.clear();
+		for (char *block : blocks) {
+			delete[] block;
+		}
+		blocks.clear();
+		cur = end = nullptr;
+	}
+};
+
+}
+
+#endif
@@ -463,6 +463,8 @@ public:
 	Token ident;
 	Node *params = nullptr;
 
+	Scp::Function *func = nullptr;
+
 	Type type() const { return TUnaryExp; }
 
 	void accept(Visitor &visitor) {
@@ -21,6 +21,14 @@
 	#define CPL_IO_UseStderr false
 #endif
 
+#ifndef CPL_IO_UseMmap
+	#if defined(__unix__) || defined(__APPLE__)
+		#define CPL_IO_UseMmap true
+	#else
+		#define CPL_IO_UseMmap false
+	#endif
+#endif
+
 #define CPL_IO_InputFileName "testfile.txt"
 #define CPL_IO_OutputFileName "mips.txt"
 #define CPL_IO_ErrorFileName "error.txt"
@@ -37,6 +45,8 @@
 #define CPL_IR_UseComputedValue true
 #define CPL_IR_EnableLibsysy true
 #define CPL_IR_PrintStrMinLength 2
+#define CPL_IR_InitLoopMinCount 256
+#define CPL_IR_InitCopyMinCount 1024
 
 
 #define CPL_Opt_EnableSSA true
@@ -45,6 +55,20 @@
 
 #define CPL_Opt_EnableAddrToReg true
 
+#ifndef CPL_Opt_FastCompile
+	#define CPL_Opt_FastCompile false
+#endif
+
+#ifndef CPL_Opt_ProfileGen
+	#define CPL_Opt_ProfileGen false
+#endif
+#ifndef CPL_Opt_ProfileUse
+	#define CPL_Opt_ProfileUse false
+#endif
+
+#define CPL_Opt_ProfileFileName "profile.txt"
+#define CPL_Opt_ProfileInputFileName "input.txt"
+
 
 #ifndef CPL_Gen_IR
 	#define CPL_Gen_IR false
@@ -48,10 +48,11 @@ const Type RetValType   = Type("", "return value type mismatched");
 using Error = pair <Location, Type>;
 
 static bool compare (const Error &a, const Error &b) {
-	if (a.first.line != b.first.line) {
-		return a.first.line < b.first.line;
+	int lineA = a.first.line(), lineB = b.first.line();
+	if (lineA != lineB) {
+		return lineA < lineB;
 	}
-	return a.first.col < b.first.col;
+	return a.first.col() < b.first.col();
 }
 
 
@@ -69,7 +70,7 @@ struct Log {
 		for (auto error : log) {
 			if (CPL_Err_PlainText) {
 				if (strlen(error.second.name) > 0) {
-					IO::err << error.first.line << " " << error.second << endl;
+					IO::err << error.first.line() << " " << error.second << endl;
 				}
 				continue;
 			}
@@ -1,218 +1,247 @@
+/*
+# expression hashing
+====================
+
+keys for value numbering, an expression is an opcode followed by a small
+fixed array of encoded operands, so building a key allocates nothing
+
+operands of commutative operations are put into a canonical order with
+sortGroups, which sorts the operands in groups of the given size, e.g.
+1 for add and mul and 2 for the (value, block) pairs of a phi
+
+operands past maxOperands, e.g. of a phi with many incoming edges or a
+long gep, are spilled into a vector, only such keys allocate
+
+the keys are stored in an open addressing table with linear probing,
+erased slots are left as tombstones until the table is rebuilt
+*/
+
 #ifndef __CPL_EXPRHASH_H__
 #define __CPL_EXPRHASH_H__
 
 #include <vector>
+#include <algorithm>
+#include <initializer_list>
 
 #include "types.h"
 
 
 namespace ExprHash {
 
+using namespace std;
 using namespace Types;
 
 
-static const Type TItem  = Type();
-static const Type TSet   = Type();
-static const Type TArray = Type();
-static const Type TConst = Type();
-static const Type TReg   = Type();
-
-class HashItem {
-public:
-	int hashValue = 0;
+struct ExprKey {
+	static const int maxOperands = 8;
 
-	virtual Type itemType() const { return TItem; }
+	// operands are tagged in the high bits to keep different kinds apart
+	enum OperandTag {
+		TagConst = 1,
+		TagReg,
+		TagPhysReg,
+		TagLabel
+	};
 
-	virtual void calcHashValue() {}
+	int op = 0;
+	int size = 0;
+	long long operands[maxOperands] = {0};
+	vector <long long> spilled;
 
-	virtual bool equals(HashItem *item) = 0;
-};
-
-class HashSet final : public HashItem {
-public:
-	static const int mod = 998244353;
-	static vector <HashSet *> allocated;
+	ExprKey() {}
+	ExprKey(int op) {
+		this->op = op;
+	}
 
-	vector <HashItem *> items;
+	static long long operand(OperandTag tag, int value) {
+		return ((long long)tag << 32) | (unsigned)value;
+	}
 
-	HashSet() {
-		allocated.emplace_back(this);
+	static long long constant(int value) {
+		return operand(TagConst, value);
 	}
 
-	int f(int v) {
-		int r = (1ll * v * v % mod * v + v) % mod;
-		r ^= (1ll * v * v % mod) >> 7;
-		r ^= (v & 0x3fff) << 17;
-		return r;
+	static long long reg(int id) {
+		return operand(TagReg, id);
 	}
 
-	Type itemType() const { return TSet; }
+	long long &at(int i) {
+		return i < maxOperands ? operands[i] : spilled[i - maxOperands];
+	}
 
-	static bool compare(HashItem *a, HashItem *b) {
-		return a->hashValue < b->hashValue;
+	long long at(int i) const {
+		return i < maxOperands ? operands[i] : spilled[i - maxOperands];
 	}
 
-	void calcHashValue() {
-		sort(items.begin(), items.end(), compare);
-		hashValue = 1;
-		for (HashItem *item : items) {
-			hashValue = 1ll * hashValue * f(item->hashValue) % mod;
+	void add(long long operand) {
+		if (size >= maxOperands) {
+			spilled.emplace_back(operand);
+			size++;
+			return;
 		}
+		operands[size++] = operand;
 	}
 
-	bool equals(HashItem *item) {
-		if (item->itemType() != TSet) {
-			return false;
-		}
-		HashSet *hSet = (HashSet *)item;
-		if (items.size() != hSet->items.size()) {
-			return false;
-		}
-		for (int i = 0; i < items.size(); i++) {
-			if (!items[i]->equals(hSet->items[i])) {
-				return false;
+	void sortGroups(int groupSize) {
+		int groupCnt = size / groupSize;
+		// groups are few, insertion sort is enough
+		for (int i = 1; i < groupCnt; i++) {
+			for (int j = i; j > 0 && lessGroup(j, j - 1, groupSize); j--) {
+				for (int k = 0; k < groupSize; k++) {
+					swap(at(j * groupSize + k), at((j - 1) * groupSize + k));
+				}
 			}
 		}
-		return true;
 	}
 
-	static void clear() {
-		for (HashSet *hSet : allocated) {
-			delete hSet;
+	bool lessGroup(int a, int b, int groupSize) const {
+		for (int k = 0; k < groupSize; k++) {
+			long long x = at(a * groupSize + k), y = at(b * groupSize + k);
+			if (x != y) {
+				return x < y;
+			}
 		}
-		allocated.clear();
+		return false;
 	}
-};
-
-class HashArray final : public HashItem {
-public:
-	static const int mod = 998244353;
-	static vector <HashArray *> allocated;
 
-	vector <HashItem *> items;
-
-	HashArray() {
-		allocated.emplace_back(this);
-	}
-
-	int f(int v) {
-		int r = (1ll * v * v % mod * v + v) % mod;
-		r ^= (1ll * v * v % mod) >> 7;
-		r ^= (v & 0x3fff) << 17;
-		return r;
-	}
-
-	Type itemType() const { return TArray; }
-
-	void calcHashValue() {
-		hashValue = 0;
-		int count = 1;
-		for (HashItem *item : items) {
-			hashValue = (hashValue + 1ll * count * f(item->hashValue)) % mod;
-			count++;
+	unsigned long long hash() const {
+		unsigned long long h = (unsigned)op * 0x9e3779b97f4a7c15ull + size;
+		for (int i = 0; i < size; i++) {
+			h ^= at(i) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
 		}
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdull;
+		h ^= h >> 33;
+		return h;
 	}
 
-	bool equals(HashItem *item) {
-		if (item->itemType() != TArray) {
+	friend bool operator == (const ExprKey &a, const ExprKey &b) {
+		if (a.op != b.op || a.size != b.size) {
 			return false;
 		}
-		HashArray *hArray = (HashArray *)item;
-		if (items.size() != hArray->items.size()) {
-			return false;
-		}
-		for (int i = 0; i < items.size(); i++) {
-			if (!items[i]->equals(hArray->items[i])) {
+		for (int i = 0; i < a.size; i++) {
+			if (a.at(i) != b.at(i)) {
 				return false;
 			}
 		}
 		return true;
 	}
+};
 
-	static void clear() {
-		for (HashArray *hArray : allocated) {
-			delete hArray;
-		}
-		allocated.clear();
+
+// an opcode applied to operands in order
+static ExprKey A(const Type &type, initializer_list <long long> operands) {
+	ExprKey key(type.id);
+	for (long long operand : operands) {
+		key.add(operand);
 	}
-};
+	return key;
+}
 
-class HashConst final : public HashItem {
-public:
-	static const int mod = 998244353;
-	static vector <HashConst *> allocated;
+// an opcode applied to commutative operands
+static ExprKey S(const Type &type, initializer_list <long long> operands) {
+	ExprKey key = A(type, operands);
+	key.sortGroups(1);
+	return key;
+}
 
-	int value;
+static long long T(const Type &type) {
+	return ExprKey::constant(type.id);
+}
 
-	HashConst(int value) {
-		this->value = value;
-		calcHashValue();
-		allocated.emplace_back(this);
-	}
 
-	Type itemType() const { return TConst; }
+template <typename V>
+class ExprTable {
+public:
+	enum SlotState {
+		SlotEmpty,
+		SlotFull,
+		SlotErased
+	};
+
+	struct Slot {
+		ExprKey key;
+		V value;
+		SlotState state = SlotEmpty;
+	};
 
-	void calcHashValue() {
-		hashValue = (value % mod + mod) % mod;
+	vector <Slot> slots;
+	// indices of the slots in use, so clearing a sparse table is cheap
+	vector <int> usedSlots;
+	int fullCnt = 0;
+
+	ExprTable() {
+		slots.resize(64);
 	}
 
-	bool equals(HashItem *item) {
-		if (item->itemType() != TConst) {
-			return false;
-		}
-		HashConst *hConst = (HashConst *)item;
-		return value == hConst->value;
+	int mask() const {
+		return slots.size() - 1;
 	}
 
-	static void clear() {
-		for (HashConst *hConst : allocated) {
-			delete hConst;
+	int findSlot(const ExprKey &key) const {
+		for (int i = key.hash() & mask(); slots[i].state != SlotEmpty; i = (i + 1) & mask()) {
+			if (slots[i].state == SlotFull && slots[i].key == key) {
+				return i;
+			}
 		}
-		allocated.clear();
+		return -1;
 	}
-};
-
-class HashReg final : public HashItem {
-public:
-	static const int mod = 998244353;
-	static vector <HashReg *> allocated;
 
-	int reg;
-
-	HashReg(int reg) {
-		this->reg = reg;
-		calcHashValue();
-		allocated.emplace_back(this);
+	V *find(const ExprKey &key) {
+		int i = findSlot(key);
+		return i < 0 ? nullptr : &slots[i].value;
 	}
 
-	Type itemType() const { return TReg; }
+	// the key must not be in the table
+	void insert(const ExprKey &key, const V &value) {
+		if ((usedSlots.size() + 1) * 2 > slots.size()) {
+			rebuild(fullCnt * 4 >= slots.size() ? slots.size() * 2 : slots.size());
+		}
+		int i = key.hash() & mask();
+		while (slots[i].state == SlotFull) {
+			i = (i + 1) & mask();
+		}
+		if (slots[i].state == SlotEmpty) {
+			usedSlots.emplace_back(i);
+		}
+		slots[i].key = key;
+		slots[i].value = value;
+		slots[i].state = SlotFull;
+		fullCnt++;
+	}
 
-	void calcHashValue() {
-		hashValue = reg;
-		hashValue = (hashValue % mod + mod) % mod;
+	void erase(const ExprKey &key) {
+		int i = findSlot(key);
+		if (i >= 0) {
+			slots[i].state = SlotErased;
+			fullCnt--;
+		}
 	}
 
-	bool equals(HashItem *item) {
-		if (item->itemType() != TReg) {
-			return false;
+	void rebuild(int capacity) {
+		vector <Slot> full;
+		for (int i : usedSlots) {
+			if (slots[i].state == SlotFull) {
+				full.emplace_back(slots[i]);
+			}
+		}
+		slots.assign(capacity, Slot());
+		usedSlots.clear();
+		fullCnt = 0;
+		for (Slot &slot : full) {
+			insert(slot.key, slot.value);
 		}
-		HashReg *hReg = (HashReg *)item;
-		return reg == hReg->reg;
 	}
 
-	static void clear() {
-		for (HashReg *hReg : allocated) {
-			delete hReg;
+	void clear() {
+		for (int i : usedSlots) {
+			slots[i].state = SlotEmpty;
 		}
-		allocated.clear();
+		usedSlots.clear();
+		fullCnt = 0;
 	}
 };
 
-vector <HashSet *> HashSet::allocated;
-vector <HashArray *> HashArray::allocated;
-vector <HashConst *> HashConst::allocated;
-vector <HashReg *> HashReg::allocated;
-
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,61 @@
+/*
+# string interner
+=================
+
+every identifier is interned once by the lexer, later phases refer to it
+by its symbol id and compare names as integers
+
+the names are kept in a deque, which never moves its elements, so the
+lookup table can be keyed by views into the stored names
+*/
+
+#ifndef __CPL_INTERNER_H__
+#define __CPL_INTERNER_H__
+
+#include <string>
+#include <string_view>
+#include <deque>
+#include <unordered_map>
+
+
+namespace Intern {
+
+using namespace std;
+
+
+class Interner {
+public:
+	deque <string> names;
+	unordered_map <string_view, int> ids;
+
+	int intern(string_view name) {
+		auto it = ids.find(name);
+		if (it != ids.end()) {
+			return it->second;
+		}
+		int id = names.size();
+		names.emplace_back(name);
+		ids[names.back()] = id;
+		return id;
+	}
+
+	const string &name(int id) const {
+		return names[id];
+	}
+
+	int size() const {
+		return names.size();
+	}
+
+	void release() {
+		unordered_map <string_view, int>().swap(ids);
+		deque <string>().swap(names);
+	}
+};
+
+
+static Interner symbols;
+
+}
+
+#endif
@@ -3,6 +3,8 @@
 
 #include <vector>
 #include <string>
+#include <utility>
+#include <algorithm>
 
 #include "scope.h"
 #include "symtypes.h"
@@ -225,6 +227,8 @@ public:
 	vector <BasicBlock *> jumpFrom, jumpTo;
 	LinkedList <Inst> insts;
 	Value *label = new Value(TLabel);
+	// estimated execution count per function entry
+	double freq = 1;
 
 	BasicBlock() { regId = UNAVAILABLE; }
 
@@ -274,7 +278,6 @@ public:
 	bool reserved = false;
 	vector <Function *> asCallee, asCaller;
 	LinkedList <BasicBlock> blocks;
-	Scp::Function *func = nullptr;
 	vector <Value *> params;
 
 	Function() { regId = UNAVAILABLE; }
@@ -284,8 +287,7 @@ public:
 		regId = UNAVAILABLE;
 	}
 	Function(Scp::Function *func) {
-		this->func = func;
-		name = "@" + func->ident.token;
+		name = "@" + func->ident.name();
 		type = func->funcType;
 		type.toIRType();
 		func->irFunc = this;
@@ -406,18 +408,60 @@ public:
 };
 
 
+// what the ir keeps of a source variable, the scopes are freed once the
+// ir is generated
+struct VarInfo {
+	SymType symType;
+	// the nonzero initial values by the index of the element in the
+	// flattened array, sorted by the index
+	vector <pair <int, int>> inits;
+	// the register holding the address of the variable
+	Value *irValue = nullptr;
+
+	VarInfo(const SymType &symType) {
+		this->symType = symType;
+	}
+
+	// the number of int elements
+	int count() const {
+		int cnt = 1;
+		for (int i = 0; i < symType.dimLen; i++) {
+			cnt *= symType[i];
+		}
+		return cnt;
+	}
+
+	vector <pair <int, int>>::const_iterator find(int index) const {
+		return lower_bound(inits.begin(), inits.end(), index, [](const pair <int, int> &init, int index) {
+			return init.first < index;
+		});
+	}
+
+	int get(int index = 0) const {
+		auto it = find(index);
+		return it != inits.end() && it->first == index ? it->second : 0;
+	}
+
+	bool isZero() const {
+		return inits.empty();
+	}
+
+	// whether the elements in [first, first + cnt) are all zero
+	bool isZero(int first, int cnt) const {
+		auto it = find(first);
+		return it == inits.end() || it->first >= first + cnt;
+	}
+};
+
+
 class GlobalVar : public User, public LinkedListItem {
 public:
 	Value *reg = nullptr;
-	Scp::Variable *var = nullptr;
+	VarInfo *var = nullptr;
 
-	GlobalVar(Scp::Variable *var, const string &name = string()) {
+	GlobalVar(VarInfo *var, const string &name) {
 		this->var = var;
-		if (name.length() == 0) {
-			this->name = "@" + var->ident.token;
-		} else {
-			this->name = name;
-		}
+		this->name = name;
 		type = var->symType;
 		type.toIRType();
 		reg = new Value(type, this->name);
@@ -440,37 +484,38 @@ public:
 		visitor.visitGlobalVar(this);
 	}
 
-	void printInitVal(ostream &out, Scp::Variable *var, int &cnt) const {
-		var->symType.toIRType();
-		out << var->symType << " ";
-		if (var->isZeroInit || !var->init) {
-			if (var->symType.isArray) {
+	// prints the cnt elements of type starting from the element first
+	void printInitVal(ostream &out, SymType type, int first, int cnt) const {
+		type.toIRType();
+		out << type << " ";
+		if (var->isZero(first, cnt)) {
+			if (type.isArray) {
 				out << "zeroinitializer";
 			} else {
 				out << "0";
 			}
 			return;
 		}
-		if (var->symType.isArray) {
+		if (type.isArray) {
+			int len = type[0];
+			type.pop();
 			out << "[";
-			for (int i = 0; i < var->symType[0]; i++) {
+			for (int i = 0; i < len; i++) {
 				if (i > 0) {
 					out << ", ";
 				}
-				printInitVal(out, (*var)[i], cnt);
+				printInitVal(out, type, first + i * (cnt / len), cnt / len);
 			}
 			out << "]";
 		} else {
-			out << values[cnt];
-			cnt++;
+			out << var->get(first);
 		}
 	}
 
 	void print(ostream &out) const {
 		out << name << " = dso_local global ";
 		if (var) {
-			int cnt = 1;
-			printInitVal(out, var, cnt);
+			printInitVal(out, var->symType, 0, var->count());
 		} else {
 			out << type << " " << values[0];
 		}
@@ -676,6 +721,9 @@ public:
 
 class CallInst : public Inst {
 public:
+	// execution count from the profile, -1 if unknown
+	long long profCount = -1;
+
 	CallInst(const SymType &type, Value *func) {
 		this->type = type;
 		appendValue(func);
@@ -707,6 +755,7 @@ public:
 				inst->appendValue((*this)[i]);
 			}
 		}
+		inst->profCount = profCount;
 		return inst;
 	}
 
@@ -732,9 +781,9 @@ public:
 
 class AllocaInst : public Inst {
 public:
-	Scp::Variable *var = nullptr;
+	VarInfo *var = nullptr;
 
-	AllocaInst(const SymType &type, Value *res, Scp::Variable *var) {
+	AllocaInst(const SymType &type, Value *res, VarInfo *var) {
 		this->type = type;
 		appendValue(res);
 		this->var = var;
@@ -846,9 +895,9 @@ public:
 
 class PhiInst : public Inst {
 public:
-	Scp::Variable *var = nullptr;
+	VarInfo *var = nullptr;
 
-	PhiInst(const SymType &type, Value *res, Scp::Variable *var = nullptr) {
+	PhiInst(const SymType &type, Value *res, VarInfo *var = nullptr) {
 		this->type = type;
 		appendValue(res);
 		this->var = var;
@@ -933,6 +982,8 @@ public:
 class BrInst : public Inst {
 public:
 	bool hasCond = false;
+	// probability of the true branch from the profile, -1 if unknown
+	double profProb = -1;
 
 	BrInst(Value *target) {
 		type = Int1;
@@ -966,6 +1017,7 @@ public:
 		} else {
 			inst = new BrInst((*this)[0]);
 		}
+		inst->profProb = profProb;
 		return inst;
 	}
 
@@ -26,8 +26,8 @@ class IRGenerator : public Visitor {
 public:
 	Module *module;
 	Function *curFunc = nullptr;
+	Scp::Function *curDefFunc = nullptr;
 	BasicBlock *curBlock = nullptr;
-	User *curVar = nullptr;
 	Value *curReg = nullptr;
 	Inst *curInst = nullptr;
 	Scp::Scope *globalScope = nullptr;
@@ -66,6 +66,31 @@ public:
 	}
 
 
+	// collects the nonzero leaves of the initializer of var, whose first
+	// element is at index first of the flattened array
+	void flattenInit(Scp::Variable *var, int first, VarInfo *info) {
+		if (!var->symType.isArray) {
+			if (var->initVal != 0) {
+				info->inits.emplace_back(first, var->initVal);
+			}
+			return;
+		}
+		int size = 1;
+		for (int i = 1; i < var->symType.dimLen; i++) {
+			size *= var->symType[i];
+		}
+		for (int i = 0; i < var->initArray.size(); i++) {
+			flattenInit(var->initArray[i], first + i * size, info);
+		}
+	}
+
+	VarInfo *makeVarInfo(Scp::Variable *var) {
+		VarInfo *info = new VarInfo(var->symType);
+		flattenInit(var, 0, info);
+		return info;
+	}
+
+
 	void visitCompUnit(CompUnit *node) {
 		globalScope = node->scope;
 		for (Node *decl : node->decl) {
@@ -85,26 +110,13 @@ public:
 
 	void visitConstDef(ConstDef *node) {
 		Scp::Variable *var = node->scope->getVar(node->ident);
-		GlobalVar *globalVar = nullptr;
-		if (node->scope == globalScope) {
-			globalVar = new GlobalVar(var);
-		} else {
-			string name("@.scope." + to_string(node->scope->id) + "." + var->ident.token);
-			globalVar = new GlobalVar(var, name);
+		string name("@" + var->ident.name());
+		if (node->scope != globalScope) {
+			name = "@.scope." + to_string(node->scope->id) + "." + var->ident.name();
 		}
+		GlobalVar *globalVar = new GlobalVar(makeVarInfo(var), name);
+		var->irValue = globalVar->reg;
 		module->appendGlobalVar(globalVar);
-		curVar = globalVar;
-		node->initVal->accept(*this);
-	}
-
-	void visitConstInitVal(ConstInitVal *node) {
-		if (node->isArray) {
-			for (Node *initVal : node->initVal) {
-				initVal->accept(*this);
-			}
-		} else {
-			curVar->appendValue(new NumberLiteral(node->expr->computedValue));
-		}
 	}
 
 	void visitVarDecl(VarDecl *node) {
@@ -114,63 +126,185 @@ public:
 	}
 
 	vector <int> initValDim;
+	// elements stored by the initializer of the local array being defined
+	vector <bool> initCovered;
+
+	// address of the element at the flat index of the array at addr
+	Value *elementAddr(Value *addr, int index) {
+		const SymType &type = addr->type;
+		vector <int> subscripts(type.dimLen);
+		for (int i = type.dimLen - 1; i >= 0; i--) {
+			subscripts[i] = index % type[i];
+			index /= type[i];
+		}
+		Value *res = new Value(Int32);
+		GetPtrInst *inst = new GetPtrInst(type, res, addr);
+		for (int subscript : subscripts) {
+			inst->appendValue(new NumberLiteral(subscript));
+		}
+		appendInst(inst);
+		return res;
+	}
+
+	// fills the elements in [first, last) of the array at addr in a loop,
+	// copying them from the array at src or zeroing them when src is null,
+	// the addresses of the first elements are taken before the loop and
+	// indexed as pointers inside it
+	void fillArray(Value *addr, Value *src, int first, int last) {
+		SymType pointer = Int32.toPointer();
+		Value *base = elementAddr(addr, 0);
+		base->type = pointer;
+		if (src) {
+			src = elementAddr(src, 0);
+			src->type = pointer;
+		}
+		VarInfo *counter = new VarInfo(Int32);
+		counter->irValue = new Value(Int32);
+		appendInst(new AllocaInst(Int32, counter->irValue, counter));
+		appendInst(new StoreInst(Int32, new NumberLiteral(first), counter->irValue));
+		BasicBlock *endBlock = appendBlock();
+		BasicBlock *loopBlock = appendBlock();
+		appendInst(new BrInst(loopBlock));
+		curBlock = loopBlock;
+		Value *index = new Value(Int32);
+		appendInst(new LoadInst(Int32, index, counter->irValue));
+		Value *value = new NumberLiteral(0);
+		if (src) {
+			Value *from = new Value(Int32);
+			GetPtrInst *inst = new GetPtrInst(pointer, from, src);
+			inst->appendValue(index);
+			appendInst(inst);
+			value = new Value(Int32);
+			appendInst(new LoadInst(Int32, value, from));
+		}
+		Value *elem = new Value(Int32);
+		GetPtrInst *inst = new GetPtrInst(pointer, elem, base);
+		inst->appendValue(index);
+		appendInst(inst);
+		appendInst(new StoreInst(Int32, value, elem));
+		Value *next = new Value(Int32);
+		appendInst(new AddInst(Int32, next, index, new NumberLiteral(1)));
+		appendInst(new StoreInst(Int32, next, counter->irValue));
+		Value *cond = new Value(Int1);
+		appendInst(new IcmpInst(Int32, CondSlt, cond, next, new NumberLiteral(last)));
+		appendInst(new BrInst(cond, loopBlock, endBlock));
+		curBlock = endBlock;
+	}
+
+	// counts the values listed in the initializer and checks they are all
+	// known at compile time
+	void scanInitVal(InitVal *node, int &valueCnt, bool &computed) {
+		if (node->isArray) {
+			for (Node *initVal : node->initVal) {
+				scanInitVal((InitVal *)initVal, valueCnt, computed);
+			}
+			return;
+		}
+		valueCnt++;
+		computed &= node->expr->computed && CPL_IR_UseComputedValue;
+	}
+
+	// a constant initializer listing at least CPL_IR_InitCopyMinCount values
+	// is copied in a loop from a template in the data segment, otherwise the
+	// listed elements are stored one by one, the elements left out are zero,
+	// they are stored one by one too, except for long runs of them, which
+	// are filled in a loop
+	void initLocalArray(VarDef *node, VarInfo *info) {
+		int count = info->count();
+		int valueCnt = 0;
+		bool computed = true;
+		scanInitVal((InitVal *)node->initVal, valueCnt, computed);
+		if (computed && valueCnt >= CPL_IR_InitCopyMinCount) {
+			SymType type = info->symType;
+			type.isConst = true;
+			VarInfo *init = new VarInfo(type);
+			init->inits = info->inits;
+			string name("@.scope." + to_string(node->scope->id) + "." + node->ident.name() + ".init");
+			GlobalVar *globalVar = new GlobalVar(init, name);
+			module->appendGlobalVar(globalVar);
+			fillArray(curReg, globalVar->reg, 0, count);
+			return;
+		}
+		initValDim.clear();
+		initCovered.assign(count, false);
+		node->initVal->accept(*this);
+		int first = 0;
+		while (first < count) {
+			if (initCovered[first]) {
+				first++;
+				continue;
+			}
+			int last = first;
+			while (last < count && !initCovered[last]) {
+				last++;
+			}
+			if (last - first >= CPL_IR_InitLoopMinCount) {
+				fillArray(curReg, nullptr, first, last);
+			} else {
+				for (int i = first; i < last; i++) {
+					appendInst(new StoreInst(Int32, new NumberLiteral(0), elementAddr(curReg, i)));
+				}
+			}
+			first = last;
+		}
+		initCovered.clear();
+	}
 
 	void visitVarDef(VarDef *node) {
 		Scp::Variable *var = node->scope->getVar(node->ident);
+		VarInfo *info = makeVarInfo(var);
 		if (node->scope == globalScope) {
-			GlobalVar *globalVar = new GlobalVar(var);
+			GlobalVar *globalVar = new GlobalVar(info, "@" + var->ident.name());
+			var->irValue = globalVar->reg;
 			module->appendGlobalVar(globalVar);
-			curVar = globalVar;
-		} else {
-			Value *reg = new Value(var->symType);
-			var->irValue = reg;
-			curReg = reg;
-			appendInst(new AllocaInst(reg->type, reg, var));
+			return;
 		}
-		if (node->initVal) {
+		Value *reg = new Value(var->symType);
+		var->irValue = reg;
+		info->irValue = reg;
+		curReg = reg;
+		appendInst(new AllocaInst(reg->type, reg, info));
+		if (node->initVal && var->symType.isArray) {
+			initLocalArray(node, info);
+		} else if (node->initVal) {
 			initValDim.clear();
 			node->initVal->accept(*this);
 		}
 	}
 
 	void visitInitVal(InitVal *node) {
-		if (node->scope == globalScope) {
-			if (node->isArray) {
-				for (Node *initVal : node->initVal) {
-					initVal->accept(*this);
-				}
-			} else {
-				curVar->appendValue(new NumberLiteral(node->expr->computedValue));
+		if (node->isArray) {
+			int dim = 0;
+			for (Node *initVal : node->initVal) {
+				initValDim.emplace_back(dim);
+				initVal->accept(*this);
+				initValDim.pop_back();
+				dim++;
 			}
 		} else {
-			if (node->isArray) {
-				int dim = 0;
-				for (Node *initVal : node->initVal) {
-					initValDim.emplace_back(dim);
-					initVal->accept(*this);
-					initValDim.pop_back();
-					dim++;
-				}
+			if (node->expr->computed && CPL_IR_UseComputedValue) {
+				node->value = new NumberLiteral(node->expr->computedValue);
+				node->valType = Int32;
 			} else {
-				if (node->expr->computed && CPL_IR_UseComputedValue) {
-					node->value = new NumberLiteral(node->expr->computedValue);
-					node->valType = Int32;
-				} else {
-					node->expr->accept(*this);
-					node->value = node->expr->value;
-					node->valType = node->expr->valType;
+				node->expr->accept(*this);
+				node->value = node->expr->value;
+				node->valType = node->expr->valType;
+			}
+			if (initValDim.size() == 0) {
+				appendInst(new StoreInst(node->valType, node->value, curReg));
+			} else {
+				Value *addr = new Value(node->valType);
+				GetPtrInst *inst = new GetPtrInst(curReg->type, addr, curReg);
+				int index = 0;
+				for (int i = 0; i < initValDim.size(); i++) {
+					inst->appendValue(new NumberLiteral(initValDim[i]));
+					index = index * curReg->type[i] + initValDim[i];
 				}
-				if (initValDim.size() == 0) {
-					appendInst(new StoreInst(node->valType, node->value, curReg));
-				} else {
-					Value *addr = new Value(node->valType);
-					GetPtrInst *inst = new GetPtrInst(curReg->type, addr, curReg);
-					for (int dim : initValDim) {
-						inst->appendValue(new NumberLiteral(dim));
-					}
-					appendInst(inst);
-					appendInst(new StoreInst(node->valType, node->value, addr));
+				if (index < initCovered.size()) {
+					initCovered[index] = true;
 				}
+				appendInst(inst);
+				appendInst(new StoreInst(node->valType, node->value, addr));
 			}
 		}
 	}
@@ -180,6 +314,7 @@ public:
 		Function *func = new Function(defFunc);
 		module->appendFunc(func);
 		curFunc = func;
+		curDefFunc = defFunc;
 		curBlock = nullptr;
 		if (node->params) {
 			node->params->accept(*this);
@@ -208,13 +343,15 @@ public:
 	void visitFuncFParam(FuncFParam *node) {
 		node->symType.toIRType();
 		Value *param = new Value(node->symType);
-		Scp::Variable *var = curFunc->func->scope->getVar(node->ident);
+		Scp::Variable *var = curDefFunc->scope->getVar(node->ident);
 		var->irValue = param;
 		curFunc->appendParam(param);
 		if (!node->symType.isPointer) {
 			Value *reg = new Value(node->symType);
 			var->irValue = reg;
-			appendInst(new AllocaInst(node->symType, reg, var));
+			VarInfo *info = new VarInfo(var->symType);
+			info->irValue = reg;
+			appendInst(new AllocaInst(node->symType, reg, info));
 			appendInst(new StoreInst(node->symType, param, reg));
 		}
 	}
@@ -457,7 +594,7 @@ public:
 		node->valType.toIRType();
 		if (node->funcCall) {
 			CallInst *inst = nullptr;
-			Scp::Function *func = node->scope->getFunc(node->ident);
+			Scp::Function *func = node->func;
 			if (node->valType != Void) {
 				node->value = new Value(node->valType);
 				inst = new CallInst(node->valType, node->value, func->irFunc);
@@ -41,6 +41,22 @@ public:
 		}
 	}
 
+	// the element of var addressed by the constant indices of gep
+	VarInfo *element(VarInfo *var, Inst *gep) {
+		SymType type = var->symType;
+		int index = 0;
+		for (int i = 3; i < gep->values.size(); i++) {
+			index = index * type[0] + (*gep)[i]->getConstValue();
+			type.pop();
+		}
+		VarInfo *res = new VarInfo(type);
+		int value = var->get(index);
+		if (value != 0) {
+			res->inits.emplace_back(0, value);
+		}
+		return res;
+	}
+
 	void visitGlobalVar(GlobalVar *node) {
 		if (!node->type.isArray) {
 			return;
@@ -95,18 +111,12 @@ public:
 			}
 			Inst *inst = (Inst *)use->user;
 			if (inst->instType() == TGetPtrInst) {
-				Scp::Variable *var = node->var;
-				for (int i = 3; i < inst->values.size(); i++) {
-					var = (*var)[(*inst)[i]->getConstValue()];
-				}
-				Scp::Variable *newVar = new Scp::Variable(var->ident, var->symType);
-				newVar->init = var->init;
-				newVar->initVal = var->initVal;
+				VarInfo *newVar = element(node->var, inst);
 				Value *reg = (*inst)[0];
-				reg->type = var->symType;
+				reg->type = newVar->symType;
 				reg->type.toIRType();
 				inst->insertBefore(new AllocaInst(reg->type, reg, newVar));
-				inst->insertAfter(new StoreInst(reg->type, new NumberLiteral(var->initVal), reg));
+				inst->insertAfter(new StoreInst(reg->type, new NumberLiteral(newVar->get()), reg));
 				newVar->irValue = reg;
 				removeInsts.emplace_back(inst);
 			}
@@ -170,18 +180,12 @@ public:
 		for (Use *use : addr->uses) {
 			Inst *inst = (Inst *)use->user;
 			if (inst->instType() == TGetPtrInst) {
-				Scp::Variable *var = node->var;
-				for (int i = 3; i < inst->values.size(); i++) {
-					var = (*var)[(*inst)[i]->getConstValue()];
-				}
-				Scp::Variable *newVar = new Scp::Variable(var->ident, var->symType);
-				newVar->init = var->init;
-				newVar->initVal = var->initVal;
+				VarInfo *newVar = element(node->var, inst);
 				Value *reg = (*inst)[0];
-				reg->type = var->symType;
+				reg->type = newVar->symType;
 				reg->type.toIRType();
 				inst->insertBefore(new AllocaInst(reg->type, reg, newVar));
-				inst->insertAfter(new StoreInst(reg->type, new NumberLiteral(var->initVal), reg));
+				inst->insertAfter(new StoreInst(reg->type, new NumberLiteral(newVar->get()), reg));
 				newVar->irValue = reg;
 				removeInsts.emplace_back(inst);
 			}
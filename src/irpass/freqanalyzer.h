@@ -0,0 +1,296 @@
+/*
+# frequency analyzer
+====================
+
+this pass estimates branch probabilities and block frequencies without a
+profile, following ball and larus's static heuristics
+
+every two-way branch starts at 1/2 and is refined by each heuristic that
+applies, the estimates being combined as independent evidence:
+
+- loop branch: the edge that stays inside the loop is taken (0.88)
+- return: the successor that leads straight to a return is not taken (0.72)
+- opcode: an equality test against a constant and a sign test against
+  zero are expected to fail (0.84)
+
+block frequencies are then propagated in reverse post order, relative to
+an entry frequency of 1, processing inner loops first (wu and larus): the
+probability of coming back to a loop header scales the frequency of the
+whole loop by 1 / (1 - p)
+*/
+
+#ifndef __CPL_FREQ_ANALYZER_H__
+#define __CPL_FREQ_ANALYZER_H__
+
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+
+#include "../ir.h"
+#include "loopanalyzer.h"
+
+
+namespace IR {
+
+namespace Passes {
+
+using namespace std;
+using namespace IR;
+
+
+class FreqAnalyzer : public Pass {
+public:
+	LoopAnalyzer loopAnalyzer;
+
+	Module *module;
+
+	static map <pair <BasicBlock *, BasicBlock *>, double> edgeProb;
+
+	const double probLoopBranch = 0.88;
+	const double probReturn = 0.72;
+	const double probOpcode = 0.84;
+	// keeps the frequency of a loop finite
+	const double maxCyclicProb = 1 - 1.0 / 1024;
+
+	map <BasicBlock *, int> rpoIndex;
+	vector <BasicBlock *> rpo;
+	// the union of all loops sharing a header
+	map <BasicBlock *, set <BasicBlock *>> loopBody;
+	map <BasicBlock *, double> cyclicProb;
+
+	double combine(double p, double q) {
+		return p * q / (p * q + (1 - p) * (1 - q));
+	}
+
+	bool isBackEdge(BasicBlock *from, BasicBlock *to) {
+		auto it = loopBody.find(to);
+		return it != loopBody.end() && it->second.count(from);
+	}
+
+	bool leavesLoop(BasicBlock *from, BasicBlock *to) {
+		for (auto &loop : loopBody) {
+			if (loop.second.count(from) && !loop.second.count(to)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool isReturn(BasicBlock *block) {
+		Inst *last = block->insts.last();
+		return last != nullptr && last->instType() == TRetInst;
+	}
+
+	bool leadsToReturn(BasicBlock *block) {
+		if (isReturn(block)) {
+			return true;
+		}
+		// an empty block forwarding to the return block
+		return block->insts.size() == 1 && block->jumpTo.size() == 1 && isReturn(block->jumpTo[0]);
+	}
+
+	Inst *getDefInst(BasicBlock *block, Value *value) {
+		for (Inst *inst : block->insts) {
+			if (!inst->noDef && !inst->terminate && (*inst)[0] == value) {
+				return inst;
+			}
+		}
+		return nullptr;
+	}
+
+	// finds the comparison deciding a branch, looking through the
+	// icmp ne 0, (zext i1 cond) produced for conditions before optimization
+	IcmpInst *getCond(BasicBlock *block, Value *cond) {
+		Inst *inst = getDefInst(block, cond);
+		if (inst == nullptr || inst->instType() != TIcmpInst) {
+			return nullptr;
+		}
+		IcmpInst *icmp = (IcmpInst *)inst;
+		Value *op1 = (*icmp)[1], *op2 = (*icmp)[2];
+		if (icmp->cond == CondNe && op1->isConst() && op1->getConstValue() == 0) {
+			Inst *zext = getDefInst(block, op2);
+			if (zext != nullptr && zext->instType() == TZextInst) {
+				Inst *inner = getDefInst(block, (*zext)[1]);
+				if (inner != nullptr && inner->instType() == TIcmpInst) {
+					return (IcmpInst *)inner;
+				}
+			}
+		}
+		return icmp;
+	}
+
+	// the probability that the branch at the end of block goes to its true target
+	double branchProb(BasicBlock *block, BrInst *br) {
+		BasicBlock *trueBranch = (BasicBlock *)(*br)[1];
+		BasicBlock *falseBranch = (BasicBlock *)(*br)[2];
+		double prob = 0.5;
+
+		bool trueLeaves = leavesLoop(block, trueBranch);
+		bool falseLeaves = leavesLoop(block, falseBranch);
+		if (trueLeaves != falseLeaves) {
+			prob = combine(prob, trueLeaves ? 1 - probLoopBranch : probLoopBranch);
+		}
+
+		bool trueReturns = leadsToReturn(trueBranch);
+		bool falseReturns = leadsToReturn(falseBranch);
+		if (trueReturns != falseReturns) {
+			prob = combine(prob, trueReturns ? 1 - probReturn : probReturn);
+		}
+
+		IcmpInst *icmp = getCond(block, (*br)[0]);
+		if (icmp != nullptr) {
+			Value *op1 = (*icmp)[1], *op2 = (*icmp)[2];
+			bool hasConst = op1->isConst() || op2->isConst();
+			bool zeroRhs = op2->isConst() && op2->getConstValue() == 0;
+			if (hasConst && icmp->cond == CondEq) {
+				prob = combine(prob, 1 - probOpcode);
+			} else if (hasConst && icmp->cond == CondNe) {
+				prob = combine(prob, probOpcode);
+			} else if (zeroRhs && (icmp->cond == CondSlt || icmp->cond == CondSle)) {
+				prob = combine(prob, 1 - probOpcode);
+			} else if (zeroRhs && (icmp->cond == CondSgt || icmp->cond == CondSge)) {
+				prob = combine(prob, probOpcode);
+			}
+		}
+		return prob;
+	}
+
+	void calcEdgeProb(BasicBlock *block) {
+		if (block->jumpTo.size() == 1) {
+			edgeProb[{block, block->jumpTo[0]}] = 1;
+			return;
+		}
+		Inst *last = block->insts.last();
+		if (block->jumpTo.size() != 2 || last == nullptr || last->instType() != TBrInst || !((BrInst *)last)->hasCond) {
+			for (BasicBlock *to : block->jumpTo) {
+				edgeProb[{block, to}] = 1.0 / block->jumpTo.size();
+			}
+			return;
+		}
+		BrInst *br = (BrInst *)last;
+		double prob = br->profProb;
+		if (prob < 0) {
+			prob = branchProb(block, br);
+		}
+		edgeProb[{block, (BasicBlock *)(*br)[1]}] = prob;
+		edgeProb[{block, (BasicBlock *)(*br)[2]}] = 1 - prob;
+	}
+
+	void calcRPO(BasicBlock *block, set <BasicBlock *> &visited) {
+		visited.insert(block);
+		for (BasicBlock *to : block->jumpTo) {
+			if (!visited.count(to)) {
+				calcRPO(to, visited);
+			}
+		}
+		rpo.emplace_back(block);
+	}
+
+	// propagates frequencies through the region headed by head, in which the
+	// frequency of head is 1, ignoring the edges coming from outside
+	void propagate(BasicBlock *head, const vector <BasicBlock *> &region, map <BasicBlock *, double> &freq) {
+		set <BasicBlock *> inRegion(region.begin(), region.end());
+		for (BasicBlock *block : region) {
+			double cur = 0;
+			if (block == head) {
+				cur = 1;
+			} else {
+				for (BasicBlock *from : block->jumpFrom) {
+					if (!inRegion.count(from) || isBackEdge(from, block)) {
+						continue;
+					}
+					cur += freq[from] * edgeProb[{from, block}];
+				}
+				if (cyclicProb.count(block)) {
+					cur /= 1 - cyclicProb[block];
+				}
+			}
+			freq[block] = cur;
+		}
+		if (loopBody.count(head)) {
+			double prob = 0;
+			for (BasicBlock *from : head->jumpFrom) {
+				if (inRegion.count(from) && isBackEdge(from, head)) {
+					prob += freq[from] * edgeProb[{from, head}];
+				}
+			}
+			cyclicProb[head] = min(prob, maxCyclicProb);
+		}
+	}
+
+	vector <BasicBlock *> sortRegion(const set <BasicBlock *> &blocks) {
+		vector <BasicBlock *> region;
+		for (BasicBlock *block : blocks) {
+			if (rpoIndex.count(block)) {
+				region.emplace_back(block);
+			}
+		}
+		sort(region.begin(), region.end(), [&](BasicBlock *u, BasicBlock *v) {
+			return rpoIndex[u] < rpoIndex[v];
+		});
+		return region;
+	}
+
+	void visitFunction(Function *node) {
+		rpo.clear();
+		rpoIndex.clear();
+		loopBody.clear();
+		cyclicProb.clear();
+
+		set <BasicBlock *> visited;
+		calcRPO(node->blocks.first(), visited);
+		reverse(rpo.begin(), rpo.end());
+		for (int i = 0; i < rpo.size(); i++) {
+			rpoIndex[rpo[i]] = i;
+		}
+
+		vector <BasicBlock *> headers;
+		for (BasicBlock *block : node->blocks) {
+			block->freq = 0;
+			if (loopAnalyzer.loopAsHeader[block].empty()) {
+				continue;
+			}
+			headers.emplace_back(block);
+			for (Loop *loop : loopAnalyzer.loopAsHeader[block]) {
+				loopBody[block].insert(loop->body.begin(), loop->body.end());
+			}
+		}
+		for (BasicBlock *block : rpo) {
+			calcEdgeProb(block);
+		}
+
+		// inner loops first
+		sort(headers.begin(), headers.end(), [&](BasicBlock *u, BasicBlock *v) {
+			return loopBody[u].size() < loopBody[v].size();
+		});
+		for (BasicBlock *header : headers) {
+			map <BasicBlock *, double> freq;
+			propagate(header, sortRegion(loopBody[header]), freq);
+		}
+		map <BasicBlock *, double> freq;
+		propagate(rpo[0], rpo, freq);
+		for (auto &it : freq) {
+			it.first->freq = it.second;
+		}
+	}
+
+	void visitModule(Module *node) {
+		node->accept(loopAnalyzer);
+
+		module = node;
+
+		edgeProb.clear();
+		for (Function *func : node->funcs) {
+			func->accept(*this);
+		}
+	}
+};
+
+map <pair <BasicBlock *, BasicBlock *>, double> FreqAnalyzer::edgeProb;
+
+}
+
+}
+
+#endif
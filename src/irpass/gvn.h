@@ -30,37 +30,15 @@ public:
 	Module *module;
 
 
-	HashItem *R(Value *value) {
+	long long R(Value *value) {
 		if (value->isConst()) {
-			return new HashConst(value->getConstValue());
+			return ExprKey::constant(value->getConstValue());
 		}
-		return new HashReg(value->id);
+		return ExprKey::reg(value->id);
 	}
 
-	HashItem *S(const vector <HashItem *> &items) {
-		HashSet *hSet = new HashSet();
-		for (HashItem *item : items) {
-			hSet->items.emplace_back(item);
-		}
-		hSet->calcHashValue();
-		return hSet;
-	}
 
-	HashItem *A(const vector <HashItem *> &items) {
-		HashArray *hArray = new HashArray();
-		for (HashItem *item : items) {
-			hArray->items.emplace_back(item);
-		}
-		hArray->calcHashValue();
-		return hArray;
-	}
-
-	HashItem *T(const Type &type) {
-		return new HashConst(type.id);
-	}
-
-
-	map <int, vector <pair <HashItem *, Value *>>> hashs;
+	ExprTable <Value *> hashs;
 
 	void replaceReg(Value *oldReg, Value *newReg) {
 		for (Use *use : oldReg->uses) {
@@ -68,22 +46,15 @@ public:
 		}
 	}
 
-	void setHash(vector <HashItem *> items, Value *node, Inst *inst) {
-		for (HashItem *item : items) {
-			if (hashs.count(item->hashValue)) {
-				for (auto pair : hashs[item->hashValue]) {
-					if (item->equals(pair.first)) {
-						replaceReg(node, pair.second);
-						inst->remove();
-						module->changed = true;
-						return;
-					}
-				}
-			}
-		}
-		for (HashItem *item : items) {
-			hashs[item->hashValue].emplace_back(make_pair(item, node));
+	void setHash(const ExprKey &key, Value *node, Inst *inst) {
+		Value **value = hashs.find(key);
+		if (value != nullptr) {
+			replaceReg(node, *value);
+			inst->remove();
+			module->changed = true;
+			return;
 		}
+		hashs.insert(key, node);
 	}
 
 
@@ -95,83 +66,62 @@ public:
 
 	void visitFunction(Function *node) {
 		hashs.clear();
-		HashSet::clear();
-		HashArray::clear();
-		HashConst::clear();
-		HashReg::clear();
 		for (BasicBlock *block : node->blocks) {
 			block->accept(*this);
 		}
 	}
 
 	void visitAddInst(AddInst *node) {
-		setHash({
-			A({ T(TAddInst), S({ R((*node)[1]), R((*node)[2]) }) })
-		}, (*node)[0], node);
+		setHash(S(TAddInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
 	}
 
 	void visitSubInst(SubInst *node) {
-		setHash({
-			A({ T(TSubInst), R((*node)[1]), R((*node)[2]) })
-		}, (*node)[0], node);
+		setHash(A(TSubInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
 	}
 
 	void visitMulInst(MulInst *node) {
-		setHash({
-			A({ T(TMulInst), S({ R((*node)[1]), R((*node)[2]) }) })
-		}, (*node)[0], node);
+		setHash(S(TMulInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
 	}
 
 	void visitSdivInst(SdivInst *node) {
-		setHash({
-			A({ T(TSdivInst), R((*node)[1]), R((*node)[2]) })
-		}, (*node)[0], node);
+		setHash(A(TSdivInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
 	}
 
 	void visitSremInst(SremInst *node) {
-		setHash({
-			A({ T(TSremInst), R((*node)[1]), R((*node)[2]) })
-		}, (*node)[0], node);
+		setHash(A(TSremInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
 	}
 
 	void visitIcmpInst(IcmpInst *node) {
-		setHash({
-			A({ T(TIcmpInst), T(node->cond), R((*node)[1]), R((*node)[2]) })
-		}, (*node)[0], node);
+		setHash(A(TIcmpInst, { T(node->cond), R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
 	}
 
 	void visitGetPtrInst(GetPtrInst *node) {
-		vector <HashItem *> items;
+		ExprKey key(TGetPtrInst.id);
 		for (int i = 1; i < node->values.size(); i++) {
-			items.emplace_back(R((*node)[i]));
+			key.add(R((*node)[i]));
 		}
-		setHash({
-			A({ T(TGetPtrInst), A(items) })
-		}, (*node)[0], node);
+		setHash(key, (*node)[0], node);
 	}
 
 	void visitPhiInst(PhiInst *node) {
-		vector <HashItem *> items;
+		// incoming (value, block) pairs in any order
+		ExprKey key(TPhiInst.id);
 		for (int i = 1; i < node->values.size(); i += 2) {
-			items.emplace_back(A({ R((*node)[i]), R((*node)[i + 1]) }));
+			key.add(R((*node)[i]));
+			key.add(R((*node)[i + 1]));
 		}
-		setHash({
-			A({ T(TPhiInst), S(items) })
-		}, (*node)[0], node);
+		key.sortGroups(2);
+		setHash(key, (*node)[0], node);
 	}
 
 	void visitZextInst(ZextInst *node) {
 		// assume i1 to i32
-		setHash({
-			A({ T(TZextInst), R((*node)[1]) })
-		}, (*node)[0], node);
+		setHash(A(TZextInst, { R((*node)[1]) }), (*node)[0], node);
 	}
 
 	void visitTruncInst(TruncInst *node) {
 		// assume i32 to i1
-		setHash({
-			A({ T(TTruncInst), R((*node)[1]) })
-		}, (*node)[0], node);
+		setHash(A(TTruncInst, { R((*node)[1]) }), (*node)[0], node);
 	}
 
 	void visitModule(Module *node) {
@@ -4,6 +4,9 @@
 
 this pass finds the functions with no recursive calls and inline them
 
+with a profile, a call that was never executed is left as it is unless
+the callee is small, since inlining it only grows the code
+
 the return value is saved in the phi instruction
 note that this phi instruction has no corresponding variable in the scope
 */
@@ -32,6 +35,7 @@ public:
 	Module *module;
 	Function *curFunc = nullptr;
 
+	const int maxColdInstCnt = 16;
 
 	map <Value *, Value *> mapping;
 
@@ -157,6 +161,15 @@ public:
 				return;
 			}
 		}
+		if (node->profCount == 0) {
+			int instCnt = 0;
+			for (BasicBlock *block : func->blocks) {
+				instCnt += block->insts.size();
+			}
+			if (instCnt > maxColdInstCnt) {
+				return;
+			}
+		}
 		inlineFunc(node, func);
 	}
 
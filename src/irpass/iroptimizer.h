@@ -46,7 +46,32 @@ public:
 	LoopUnroll loopUnroll;
 	Array2Var array2var;
 
+	// single pass pipeline for huge inputs, no fixpoint iteration, and no
+	// loop unrolling or compile time evaluation of calls
+	void fastCompile(Module *node) {
+		if (CPL_Opt_EnableSSA) {
+			node->accept(mem2reg);
+		}
+		if (CPL_Opt_IROptimizer) {
+			node->accept(constOptimizer);
+			node->accept(inlineFunc);
+			node->accept(dce);
+			node->accept(aggressiveDce);
+			node->accept(gvLocalizer);
+			node->accept(array2var);
+			node->accept(lvn);
+			node->accept(gvn);
+			node->accept(gcm);
+		}
+		node->accept(cfgBuilder);
+		node->accept(regLabeller);
+	}
+
 	void visitModule(Module *node) {
+		if (CPL_Opt_FastCompile) {
+			fastCompile(node);
+			return;
+		}
 		do {
 			node->changed = false;
 			if (CPL_Opt_EnableSSA) {
@@ -15,6 +15,7 @@ this pass unrolls simple loops
 #include "../ir.h"
 #include "domanalyzer.h"
 #include "loopanalyzer.h"
+#include "freqanalyzer.h"
 #include "reglabeller.h"
 
 
@@ -30,6 +31,7 @@ class LoopUnroll : public Pass {
 public:
 	DomAnalyzer domAnalyzer;
 	LoopAnalyzer loopAnalyzer;
+	FreqAnalyzer freqAnalyzer;
 	RegLabeller regLabeller;
 
 	Module *module;
@@ -37,6 +39,9 @@ public:
 
 	const int maxInstCnt = 1 << 14;
 	const int maxBlockCnt = 1 << 11;
+	// loops entered less often than this are unrolled with a smaller budget
+	const double coldFreq = 1.0 / 32;
+	const int maxColdInstCnt = 1 << 10;
 
 	vector <map <Value *, Value *>> mapping;
 
@@ -191,6 +196,9 @@ public:
 		if (loopCnt > maxInstCnt / instCnt) {
 			return;
 		}
+		if (preheader->freq < coldFreq && loopCnt > maxColdInstCnt / instCnt) {
+			return;
+		}
 
 		// copy loop body
 		vector <BasicBlock *> body;
@@ -317,7 +325,8 @@ public:
 
 	void visitModule(Module *node) {
 		node->accept(regLabeller);
-		node->accept(loopAnalyzer);
+		// runs the loop analyzer as well
+		node->accept(freqAnalyzer);
 
 		module = node;
 		for (Function *func : node->funcs) {
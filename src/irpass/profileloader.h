@@ -0,0 +1,92 @@
+/*
+# profile loader
+================
+
+this pass reads the counts written by the profiler back and attaches them
+to the module before it is optimized, so the module must be generated
+from the same source as the profiled one
+
+the probability of each conditional branch is stored in the branch, the
+execution count of each call in the call, and both are kept by the copies
+made when inlining and unrolling
+
+a function whose block count does not match is left without a profile
+*/
+
+#ifndef __CPL_PROFILE_LOADER_H__
+#define __CPL_PROFILE_LOADER_H__
+
+#include <vector>
+#include <map>
+
+#include "../config.h"
+#include "../ir.h"
+
+
+namespace IR {
+
+namespace Passes {
+
+using namespace std;
+using namespace IR;
+
+
+class ProfileLoader : public Pass {
+public:
+	Module *module;
+
+	map <string, vector <pair <long long, long long>>> counts;
+
+	void load(istream &in) {
+		string name;
+		int blockCnt;
+		while (in >> name >> blockCnt) {
+			vector <pair <long long, long long>> &cur = counts[name];
+			cur.resize(blockCnt);
+			for (int i = 0; i < blockCnt; i++) {
+				in >> cur[i].first >> cur[i].second;
+			}
+		}
+	}
+
+	void visitFunction(Function *node) {
+		if (counts.count(node->name) == 0) {
+			return;
+		}
+		vector <pair <long long, long long>> &cur = counts[node->name];
+		if (cur.size() != node->blocks.size()) {
+			return;
+		}
+		int index = 0;
+		for (BasicBlock *block : node->blocks) {
+			long long execCnt = cur[index].first;
+			long long trueCnt = cur[index].second;
+			index++;
+			for (Inst *inst : block->insts) {
+				if (inst->instType() == TCallInst) {
+					((CallInst *)inst)->profCount = execCnt;
+				}
+			}
+			Inst *last = block->insts.last();
+			if (last != nullptr && last->instType() == TBrInst && ((BrInst *)last)->hasCond && execCnt > 0) {
+				((BrInst *)last)->profProb = 1.0 * trueCnt / execCnt;
+			}
+		}
+	}
+
+	void visitModule(Module *node) {
+		module = node;
+
+		ifstream in(CPL_Opt_ProfileFileName, ios::in);
+		load(in);
+		for (Function *func : node->funcs) {
+			func->accept(*this);
+		}
+	}
+};
+
+}
+
+}
+
+#endif
@@ -0,0 +1,335 @@
+/*
+# profiler
+==========
+
+this pass runs the module in a small interpreter before it is optimized
+and records how many times each basic block is executed and how many
+times each conditional branch goes to its true target
+
+the input of the program is read from CPL_Opt_ProfileInputFileName, its
+output is discarded, and the counts are written to CPL_Opt_ProfileFileName,
+one line per function followed by one line per basic block in order:
+
+	<function name> <block count>
+	<execution count> <true branch count>
+
+the interpreter stops early at a division by zero or after maxSteps
+instructions, the counts collected so far are still written
+*/
+
+#ifndef __CPL_PROFILER_H__
+#define __CPL_PROFILER_H__
+
+#include <vector>
+#include <unordered_map>
+#include <cstring>
+#include <climits>
+
+#include "../config.h"
+#include "../ir.h"
+
+
+namespace IR {
+
+namespace Passes {
+
+using namespace std;
+using namespace IR;
+
+
+class Profiler : public Pass {
+public:
+	struct Frame {
+		Function *func = nullptr;
+		BasicBlock *block = nullptr;
+		BasicBlock *prevBlock = nullptr;
+		Inst *inst = nullptr;
+		int stackBase = 0;
+		unordered_map <Value *, int> values;
+		unordered_map <Inst *, int> allocas;
+	};
+
+	const long long maxSteps = 1ll << 28;
+
+	Module *module;
+
+	unordered_map <BasicBlock *, long long> blockCount;
+	unordered_map <BasicBlock *, long long> trueCount;
+
+	vector <unsigned char> memory;
+	unordered_map <Value *, int> globalAddr;
+	vector <Frame> frames;
+	long long steps = 0;
+	bool halted = false;
+
+	istream *input = nullptr;
+
+
+	int load(int addr) {
+		int value = 0;
+		if (addr >= 0 && addr + 4 <= memory.size()) {
+			memcpy(&value, &memory[addr], 4);
+		}
+		return value;
+	}
+
+	void store(int addr, int value) {
+		if (addr >= 0 && addr + 4 <= memory.size()) {
+			memcpy(&memory[addr], &value, 4);
+		}
+	}
+
+	int alloc(int size) {
+		int addr = memory.size();
+		memory.resize(addr + (size + 3) / 4 * 4);
+		return addr;
+	}
+
+	// the memory is zero filled, only the nonzero elements are stored
+	void initGlobal(VarInfo *var, int addr) {
+		for (auto &init : var->inits) {
+			store(addr + init.first * 4, init.second);
+		}
+	}
+
+	int getValue(Frame &frame, Value *value) {
+		if (value->isConst()) {
+			return value->getConstValue();
+		}
+		auto it = frame.values.find(value);
+		if (it != frame.values.end()) {
+			return it->second;
+		}
+		auto global = globalAddr.find(value);
+		if (global != globalAddr.end()) {
+			return global->second;
+		}
+		return 0;
+	}
+
+	void enterBlock(Frame &frame, BasicBlock *block) {
+		frame.prevBlock = frame.block;
+		frame.block = block;
+		frame.inst = block->insts.first();
+		blockCount[block]++;
+		// phis read their operands simultaneously
+		vector <pair <Value *, int>> phiValues;
+		while (frame.inst != nullptr && frame.inst->instType() == TPhiInst) {
+			Inst *phi = frame.inst;
+			for (int i = 1; i < phi->values.size(); i += 2) {
+				if ((*phi)[i + 1] == frame.prevBlock) {
+					phiValues.emplace_back((*phi)[0], getValue(frame, (*phi)[i]));
+					break;
+				}
+			}
+			frame.inst = (Inst *)phi->__ll_next;
+		}
+		for (auto &it : phiValues) {
+			frame.values[it.first] = it.second;
+		}
+	}
+
+	void callFunc(Function *func, const vector <int> &args) {
+		frames.emplace_back();
+		Frame &frame = frames.back();
+		frame.func = func;
+		frame.stackBase = memory.size();
+		for (int i = 0; i < func->params.size() && i < args.size(); i++) {
+			frame.values[func->params[i]] = args[i];
+		}
+		enterBlock(frame, func->blocks.first());
+	}
+
+	void returnFunc(int ret) {
+		int stackBase = frames.back().stackBase;
+		frames.pop_back();
+		memory.resize(stackBase);
+		if (frames.empty()) {
+			return;
+		}
+		Frame &frame = frames.back();
+		Inst *call = frame.inst;
+		if (!call->noDef) {
+			frame.values[(*call)[0]] = ret;
+		}
+		frame.inst = (Inst *)call->__ll_next;
+	}
+
+	// returns false if the call is to a user function and a new frame is pushed
+	bool callInst(Frame &frame, Inst *inst) {
+		int index = inst->noDef ? 0 : 1;
+		Function *func = (Function *)(*inst)[index];
+		vector <int> args;
+		for (int i = index + 1; i < inst->values.size(); i++) {
+			args.emplace_back(getValue(frame, (*inst)[i]));
+		}
+		int ret = 0;
+		if (func == module->getint) {
+			if (!(*input >> ret)) {
+				ret = 0;
+			}
+		} else if (func->reserved) {
+			// output is discarded
+		} else {
+			callFunc(func, args);
+			return false;
+		}
+		if (!inst->noDef) {
+			frame.values[(*inst)[0]] = ret;
+		}
+		return true;
+	}
+
+	int compare(const Type &cond, int a, int b) {
+		if (cond == CondEq) {
+			return a == b;
+		}
+		if (cond == CondNe) {
+			return a != b;
+		}
+		if (cond == CondSgt) {
+			return a > b;
+		}
+		if (cond == CondSge) {
+			return a >= b;
+		}
+		if (cond == CondSlt) {
+			return a < b;
+		}
+		return a <= b;
+	}
+
+	void step() {
+		Frame &frame = frames.back();
+		Inst *inst = frame.inst;
+		Type type = inst->instType();
+		Inst *next = (Inst *)inst->__ll_next;
+		steps++;
+
+		if (type == TBrInst) {
+			BrInst *br = (BrInst *)inst;
+			if (!br->hasCond) {
+				enterBlock(frame, (BasicBlock *)(*br)[0]);
+				return;
+			}
+			if (getValue(frame, (*br)[0])) {
+				trueCount[frame.block]++;
+				enterBlock(frame, (BasicBlock *)(*br)[1]);
+			} else {
+				enterBlock(frame, (BasicBlock *)(*br)[2]);
+			}
+			return;
+		}
+		if (type == TRetInst) {
+			int ret = 0;
+			if (inst->values.size() > 0) {
+				ret = getValue(frame, (*inst)[0]);
+			}
+			returnFunc(ret);
+			return;
+		}
+		if (type == TCallInst) {
+			if (callInst(frame, inst)) {
+				frame.inst = next;
+			}
+			return;
+		}
+
+		unsigned a = 0, b = 0;
+		if (inst->values.size() > 1) {
+			a = getValue(frame, (*inst)[1]);
+		}
+		if (inst->values.size() > 2) {
+			b = getValue(frame, (*inst)[2]);
+		}
+		int res = 0;
+		if (type == TAddInst) {
+			res = a + b;
+		} else if (type == TSubInst) {
+			res = a - b;
+		} else if (type == TMulInst) {
+			res = a * b;
+		} else if (type == TSdivInst || type == TSremInst) {
+			if (b == 0 || ((int)a == INT_MIN && (int)b == -1)) {
+				halted = true;
+				return;
+			}
+			res = type == TSdivInst ? (int)a / (int)b : (int)a % (int)b;
+		} else if (type == TIcmpInst) {
+			res = compare(((IcmpInst *)inst)->cond, a, b);
+		} else if (type == TZextInst) {
+			res = a;
+		} else if (type == TTruncInst) {
+			res = a & 1;
+		} else if (type == TAllocaInst) {
+			auto it = frame.allocas.find(inst);
+			if (it == frame.allocas.end()) {
+				it = frame.allocas.insert({inst, alloc(inst->type.getSize())}).first;
+			}
+			res = it->second;
+		} else if (type == TLoadInst) {
+			res = load(a);
+		} else if (type == TStoreInst) {
+			store(getValue(frame, (*inst)[1]), getValue(frame, (*inst)[0]));
+		} else if (type == TGetPtrInst) {
+			SymType elemType = inst->type;
+			res = a;
+			for (int i = 2; i < inst->values.size(); i++) {
+				res += getValue(frame, (*inst)[i]) * elemType.getSize();
+				elemType.pop();
+			}
+		}
+		if (!inst->noDef) {
+			frame.values[(*inst)[0]] = res;
+		}
+		frame.inst = next;
+	}
+
+	void save(ostream &out) {
+		for (Function *func : module->funcs) {
+			if (func->reserved) {
+				continue;
+			}
+			out << func->name << " " << func->blocks.size() << endl;
+			for (BasicBlock *block : func->blocks) {
+				out << blockCount[block] << " " << trueCount[block] << endl;
+			}
+		}
+	}
+
+	void visitModule(Module *node) {
+		module = node;
+
+		// address 0 is kept as null
+		memory.assign(4, 0);
+		for (GlobalVar *globalVar : node->globalVars) {
+			int addr = alloc(globalVar->type.getSize());
+			globalAddr[globalVar->reg] = addr;
+			if (globalVar->var == nullptr) {
+				Value *init = globalVar->values[0]->value;
+				if (init->type.baseType() == Int8) {
+					string str = ((StringLiteral *)init)->strVal;
+					memcpy(&memory[addr], str.c_str(), min((int)str.length(), globalVar->type.getSize()));
+				}
+			} else {
+				initGlobal(globalVar->var, addr);
+			}
+		}
+
+		ifstream in(CPL_Opt_ProfileInputFileName, ios::in);
+		input = &in;
+		callFunc(node->funcs.last(), vector <int>());
+		while (!frames.empty() && !halted && steps < maxSteps) {
+			step();
+		}
+
+		ofstream out(CPL_Opt_ProfileFileName, ios::out);
+		save(out);
+	}
+};
+
+}
+
+}
+
+#endif
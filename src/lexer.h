@@ -2,13 +2,14 @@
 #define __CPL_LEXER_H__
 
 #include <iostream>
-#include <map>
 #include <vector>
+#include <string_view>
 
 #include "config.h"
 #include "types.h"
 #include "location.h"
 #include "errors.h"
+#include "interner.h"
 
 
 namespace Lex {
@@ -17,6 +18,7 @@ using namespace std;
 using namespace Types;
 using namespace Loc;
 using namespace IO;
+using namespace Intern;
 
 
 const Type DEFAULT = Type();
@@ -80,87 +82,113 @@ static bool isAlpha(char c) {
 static bool isBlank(char c) {
 	return c <= 32;
 }
-static bool isSpace(char c) {
-	return c == ' ' || c == '\t';
-}
 
 
+// a token only records where it is in the source, its text is a slice of
+// the source buffer
 struct Token {
-	Location loc;
-	Type type;
-	string token;
-	int numVal;
-	string strVal;
+	const Type *type = &DEFAULT;
+	int offset = 0;
+	int length = 0;
+	union {
+		// the value of an INTCON
+		int numVal;
+		// the interned name of an IDENFR or a keyword
+		int symbol;
+	};
 
 	Token() {
-		this->type = DEFAULT;
+		numVal = 0;
 	}
 	Token(const Type &type) {
-		this->type = type;
+		this->type = &type;
+		numVal = 0;
 	}
-	Token(const Location &loc, const Type &type) {
-		this->loc = loc;
-		this->type = type;
+	Token(const Type &type, int offset, int length, int value = 0) {
+		this->type = &type;
+		this->offset = offset;
+		this->length = length;
+		numVal = value;
 	}
-	Token(const Location &loc, const Type &type, const string &token) {
-		this->loc = loc;
-		this->type = type;
-		this->token = token;
+
+	Location loc() const {
+		return Location(offset);
 	}
-	Token(const Location &loc, const Type &type, const string &token, int value) {
-		this->loc = loc;
-		this->type = type;
-		this->token = token;
-		this->numVal = value;
+
+	string_view text() const {
+		return source->slice(offset, length);
 	}
-	Token(const Location &loc, const Type &type, const string &token, const string &value) {
-		this->loc = loc;
-		this->type = type;
-		this->token = token;
-		this->strVal = value;
+
+	// the content of a STRCON without the quotes
+	string_view strVal() const {
+		string_view value = text().substr(1);
+		if (!value.empty() && value.back() == '"') {
+			value.remove_suffix(1);
+		}
+		return value;
+	}
+
+	const string &name() const {
+		return symbols.name(symbol);
 	}
 
 	friend ostream& operator << (ostream &out, const Token &token) {
-		out << token.type.name << " " << token.token;
+		out << token.type->name << " " << token.text();
 		return out;
 	}
 
 	friend bool operator == (const Token &a, const Type &b) {
-		return a.type == b;
+		return *a.type == b;
 	}
 	friend bool operator != (const Token &a, const Type &b) {
-		return a.type != b;
+		return *a.type != b;
 	}
 };
 
 
 class Lexer {
 public:
-	istream *in;
 	SourceCode src;
-	Location loc;
+	// offset of cur in the source
+	int index;
 	char cur;
 
-	map <string, Type> kwTable;
-	vector <string> kwPrefix;
-	vector <Token> tokens;
+	// keywords are kept in a perfect hash table, kwHash has no collisions
+	// among the keywords registered in initKeyword
+	static const int kwTableSize = 32;
+	const Type *kwTable[kwTableSize] = {nullptr};
 	Err::Log *errors;
 
+	// tokens are produced on demand, the ring buffer keeps the tokens with
+	// index in [first, last), it only grows when the parser looks further
+	// ahead than it can hold
+	vector <Token> ring;
+	int first = 0, last = 0;
+
 	Lexer(istream *in = &cin, Err::Log *errors = new Err::Log()) {
-		this->in = in;
+		src.load(*in);
+		init(errors);
+	}
+	Lexer(const char *fileName, Err::Log *errors = new Err::Log()) {
+		src.load(fileName);
+		init(errors);
+	}
+
+	void init(Err::Log *errors) {
+		index = -1;
 		cur = 0;
-		src = SourceCode();
-		loc = Location(&src);
+		source = &src;
 		this->errors = errors;
-		run();
+		ring.resize(8);
+		initKeyword();
+	}
+
+	static int kwHash(string_view token) {
+		return (token[0] + 5 * token.size()) & (kwTableSize - 1);
 	}
 
 	void registerKeyword(const Type &type) {
-		string keyword = string(type.value);
-		kwTable[keyword] = type;
-		for (int i = 1; i <= keyword.size(); i++) {
-			kwPrefix.emplace_back(keyword.substr(0, i));
-		}
+		kwTable[kwHash(type.value)] = &type;
 	}
 
 	void initKeyword() {
@@ -176,116 +204,127 @@ public:
 		registerKeyword(PRINTFTK);
 		registerKeyword(RETURNTK);
 		registerKeyword(VOIDTK);
+	}
 
-		registerKeyword(NOT);
-		registerKeyword(AND);
-		registerKeyword(OR);
-
-		registerKeyword(PLUS);
-		registerKeyword(MINU);
-		registerKeyword(MULT);
-		registerKeyword(DIV);
-		registerKeyword(MOD);
-
-		registerKeyword(LSS);
-		registerKeyword(LEQ);
-		registerKeyword(GRE);
-		registerKeyword(GEQ);
-		registerKeyword(EQL);
-		registerKeyword(NEQ);
-
-		registerKeyword(ASSIGN);
-		registerKeyword(SEMICN);
-		registerKeyword(COMMA);
-		registerKeyword(LPARENT);
-		registerKeyword(RPARENT);
-		registerKeyword(LBRACK);
-		registerKeyword(RBRACK);
-		registerKeyword(LBRACE);
-		registerKeyword(RBRACE);
-
-		registerKeyword(COMT);
-		registerKeyword(BLOCKCOMT);
+	const Type *getKeyword(string_view token) {
+		const Type *type = kwTable[kwHash(token)];
+		if (type != nullptr && token == type->value) {
+			return type;
+		}
+		return nullptr;
 	}
 
 	void read() {
-		cur = in->get();
-		if (cur == '\n') {
-			loc.newLine();
-			return;
-		}
-		if (isSpace(cur)) {
-			loc.append(' ');
-		} else if (!isBlank(cur)) {
-			loc.append(cur);
+		if (index < src.size) {
+			index++;
 		}
+		cur = index < src.size ? src.data[index] : EOF;
+	}
+
+	// the source from offset begin up to cur, excluding cur
+	string_view slice(int begin) {
+		return src.slice(begin, index - begin);
 	}
 
 	Token getNumberLiteral() {
 		int value = 0;
-		Location loc = this->loc;
-		string token = "";
+		int begin = index;
 		if (cur == '0') {
-			token = token + cur;
 			read();
-			return Token(loc, INTCON, token, value);
+			return Token(INTCON, begin, index - begin, value);
 		}
 		while (isDigit(cur)) {
 			value = value * 10 + (cur - '0');
-			token = token + cur;
 			read();
 		}
-		return Token(loc, INTCON, token, value);
+		return Token(INTCON, begin, index - begin, value);
 	}
 
 	Token getIdentifier() {
-		string token = "";
-		Location loc = this->loc;
+		int begin = index;
 		while (isAlpha(cur) || isDigit(cur) || cur == '_') {
-			token = token + cur;
 			read();
 		}
-		if (kwTable.count(token)) {
-			return Token(loc, kwTable[token], token);
-		}
-		return Token(loc, IDENFR, token);
+		string_view token = slice(begin);
+		const Type *type = getKeyword(token);
+		return Token(type != nullptr ? *type : IDENFR, begin, token.size(), symbols.intern(token));
 	}
 
 	Token getStringLiteral() {
-		string token = "";
-		string value = "";
-		Location loc = this->loc;
-		token = token + cur;
+		int begin = index;
 		read();
-		while (cur != '"') {
-			token = token + cur;
-			value = value + cur;
+		while (cur != '"' && cur != EOF) {
 			read();
 		}
-		token = token + cur;
 		read();
-		return Token(loc, STRCON, token, value);
+		return Token(STRCON, begin, index - begin);
 	}
 
-	Token getKeyword() {
-		string token = "";
-		Location loc = this->loc;
-		while (find(kwPrefix.begin(), kwPrefix.end(), token + cur) != kwPrefix.end()) {
-			token = token + cur;
+	// consumes cur, and the next char if it is second, the two chars make
+	// the token two, otherwise cur alone makes the token one
+	const Type *follow(char second, const Type &two, const Type *one) {
+		read();
+		if (cur == second) {
 			read();
+			return &two;
+		}
+		return one;
+	}
+
+	const Type *single(const Type &type) {
+		read();
+		return &type;
+	}
+
+	// the longest operator starting at cur, or nullptr if there is none
+	const Type *matchOperator() {
+		switch (cur) {
+			case '!': return follow('=', NEQ, &NOT);
+			case '&': return follow('&', AND, nullptr);
+			case '|': return follow('|', OR, nullptr);
+			case '<': return follow('=', LEQ, &LSS);
+			case '>': return follow('=', GEQ, &GRE);
+			case '=': return follow('=', EQL, &ASSIGN);
+			case '/':
+				read();
+				if (cur == '/') {
+					return single(COMT);
+				}
+				if (cur == '*') {
+					return single(BLOCKCOMT);
+				}
+				return &DIV;
+			case '+': return single(PLUS);
+			case '-': return single(MINU);
+			case '*': return single(MULT);
+			case '%': return single(MOD);
+			case ';': return single(SEMICN);
+			case ',': return single(COMMA);
+			case '(': return single(LPARENT);
+			case ')': return single(RPARENT);
+			case '[': return single(LBRACK);
+			case ']': return single(RBRACK);
+			case '{': return single(LBRACE);
+			case '}': return single(RBRACE);
 		}
-		if (!kwTable.count(token)) {
-			errors->raise(loc, Err::UnknownToken);
+		return nullptr;
+	}
+
+	Token getOperator() {
+		int begin = index;
+		const Type *type = matchOperator();
+		if (type == nullptr) {
+			errors->raise(Location(begin), Err::UnknownToken);
 			read();
 			return nextToken();
 		}
-		return Token(loc, kwTable[token], token);
+		return Token(*type, begin, index - begin);
 	}
 
 	Token nextToken() {
 		while (isBlank(cur)) {
 			if (cur == EOF) {
-				return Token(loc, ENDF);
+				return Token(ENDF, index, 0);
 			}
 			read();
 		}
@@ -298,20 +337,20 @@ public:
 		if (cur == '"') {
 			return getStringLiteral();
 		}
-		return getKeyword();
+		return getOperator();
 	}
 
 	Token next() {
 		Token token = nextToken();
-		while (token.type == COMT || token.type == BLOCKCOMT) {
-			if (token.type == COMT) {
+		while (token == COMT || token == BLOCKCOMT) {
+			if (token == COMT) {
 				while (cur != '\n' && cur != EOF) {
 					read();
 				}
 				token = nextToken();
 				continue;
 			}
-			if (token.type == BLOCKCOMT) {
+			if (token == BLOCKCOMT) {
 				while (cur != EOF) {
 					while (cur != '*' && cur != EOF) {
 						read();
@@ -332,19 +371,41 @@ public:
 		return token;
 	}
 
-	void run() {
-		initKeyword();
-		Token token = next();
-		while (token.type != ENDF) {
-			tokens.emplace_back(token);
-			token = next();
+	// the tokens and the source are no longer needed
+	void release() {
+		vector <Token>().swap(ring);
+		first = last = 0;
+		src.release();
+	}
+
+	void grow() {
+		vector <Token> larger(ring.size() * 2);
+		for (int i = first; i < last; i++) {
+			larger[i & (larger.size() - 1)] = ring[i & (ring.size() - 1)];
 		}
+		ring.swap(larger);
+	}
 
-		if (CPL_Lexer_PrintTokens) {
-			for (auto token : tokens) {
+	// the token with index i, counting from 0, the tokens before first are
+	// gone and all tokens after the end of input are ENDF
+	Token &peek(int i) {
+		while (last <= i) {
+			if (last - first == ring.size()) {
+				grow();
+			}
+			Token &token = ring[last & (ring.size() - 1)];
+			token = next();
+			if (CPL_Lexer_PrintTokens && token != ENDF) {
 				out << token << endl;
 			}
+			last++;
 		}
+		return ring[i & (ring.size() - 1)];
+	}
+
+	// the tokens before index i will not be looked at again
+	void release(int i) {
+		first = max(first, i);
 	}
 };
 
@@ -7,62 +7,170 @@
 #include <cstdlib>
 #include <cstring>
 #include <vector>
+#include <string_view>
+#include <algorithm>
 
 
 #include "config.h"
 
+#if CPL_IO_UseMmap
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
 
 namespace Loc {
 
 using namespace std;
 
 
+// the whole input is loaded into one buffer, tokens and source lines are
+// slices of it, so the buffer lives as long as the lexer
+//
+// the lines are only indexed when a location is first resolved, which only
+// happens when a diagnostic is printed
 struct SourceCode {
-	vector <string> src;
-	int line;
+	const char *data = nullptr;
+	int size = 0;
+	// offset of the first char of each line, lines are numbered from 1,
+	// empty until indexLines is called
+	vector <int> lineStart;
+
+	string buffer;
+#if CPL_IO_UseMmap
+	bool mapped = false;
+#endif
+
+	SourceCode() {}
+	SourceCode(const SourceCode &) = delete;
+	SourceCode &operator = (const SourceCode &) = delete;
+
+	~SourceCode() {
+		release();
+	}
+
+	void release() {
+#if CPL_IO_UseMmap
+		if (mapped) {
+			munmap((void *)data, size);
+			mapped = false;
+		}
+#endif
+		string().swap(buffer);
+		vector <int>().swap(lineStart);
+		data = nullptr;
+		size = 0;
+	}
+
+	void load(istream &in) {
+		const int chunk = 1 << 16;
+		for (int len = 0; in; ) {
+			buffer.resize(len + chunk);
+			in.read(&buffer[len], chunk);
+			len += in.gcount();
+			buffer.resize(len);
+		}
+		data = buffer.data();
+		size = buffer.size();
+	}
+
+	void load(const char *fileName) {
+#if CPL_IO_UseMmap
+		int fd = open(fileName, O_RDONLY);
+		struct stat st;
+		if (fd >= 0 && fstat(fd, &st) == 0 && st.st_size > 0) {
+			void *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (addr != MAP_FAILED) {
+				close(fd);
+				data = (const char *)addr;
+				size = st.st_size;
+				mapped = true;
+				return;
+			}
+		}
+		if (fd >= 0) {
+			close(fd);
+		}
+#endif
+		ifstream in(fileName, ios::in | ios::binary);
+		load(in);
+	}
+
+	void indexLines() {
+		if (!lineStart.empty()) {
+			return;
+		}
+		lineStart.emplace_back(0);
+		lineStart.emplace_back(0);
+		const char *end = data + size;
+		for (const char *pos = data; pos < end; pos++) {
+			pos = (const char *)memchr(pos, '\n', end - pos);
+			if (pos == nullptr) {
+				break;
+			}
+			lineStart.emplace_back(pos - data + 1);
+		}
+	}
 
-	SourceCode() {
-		line = 0;
-		src.emplace_back("");
-		newLine();
+	string_view getLine(int line) {
+		indexLines();
+		if (line >= lineStart.size()) {
+			return string_view();
+		}
+		int begin = lineStart[line];
+		int end = line + 1 < lineStart.size() ? lineStart[line + 1] - 1 : size;
+		return string_view(data + begin, max(end - begin, 0));
 	}
 
-	void append(char cur) {
-		src[line] = src[line] + cur;
+	string_view slice(int offset, int length) {
+		return string_view(data + offset, length);
 	}
 
-	void newLine() {
-		line++;
-		src.emplace_back("");
+	int lineOf(int offset) {
+		indexLines();
+		return upper_bound(lineStart.begin() + 1, lineStart.end(), offset) - lineStart.begin() - 1;
 	}
 
-	string getLine(int line) { return src[line]; }
+	// columns count the shown chars up to and including the one at offset,
+	// tabs are shown as spaces and other blank chars are not shown
+	int colOf(int offset) {
+		int col = 0;
+		for (int i = lineStart[lineOf(offset)]; i <= offset && i < size; i++) {
+			if (data[i] == ' ' || data[i] == '\t' || data[i] > 32) {
+				col++;
+			}
+		}
+		return col;
+	}
 };
 
 
+// the source being compiled, locations are resolved against it
+static SourceCode *source = nullptr;
+
+
+// a location is only an offset into the source, the line and the column
+// are worked out when a diagnostic is printed
 struct Location {
-	SourceCode *src;
-	int line, col;
+	int offset = 0;
 
 	Location() {}
-	Location(SourceCode *src, int line = 1, int col = 0) {
-		this->src = src;
-		this->line = line;
-		this->col = col;
+	Location(int offset) {
+		this->offset = offset;
 	}
 
-	void append(char cur) {
-		col++;
-		src->append(cur);
+	int line() const {
+		return source->lineOf(offset);
 	}
 
-	void newLine() {
-		line++;
-		col = 0;
-		src->newLine();
+	int col() const {
+		return source->colOf(offset);
 	}
 
 	void locate(ostream &out) {
+		int line = this->line(), col = this->col();
 		if (CPL_Err_ConsoleColor) {
 			out << "\033[01;30m";
 		}
@@ -74,7 +182,16 @@ struct Location {
 		if (CPL_Err_ConsoleColor) {
 			out << "\033[0m";
 		}
-		out << src->getLine(line) << endl;
+		// tabs are shown as spaces and other blank chars are dropped,
+		// the same way the lexer counts columns
+		for (char c : source->getLine(line)) {
+			if (c == '\t') {
+				out << ' ';
+			} else if (c == ' ' || c > 32) {
+				out << c;
+			}
+		}
+		out << endl;
 		if (CPL_Err_ConsoleColor) {
 			out << "\033[01;30m";
 		}
@@ -91,7 +208,7 @@ struct Location {
 	}
 
 	friend ostream& operator << (ostream &out, const Location &loc) {
-		out << loc.line << ":" << loc.col << ": ";
+		out << loc.line() << ":" << loc.col() << ": ";
 		return out;
 	}
 };
@@ -4,6 +4,8 @@
 #include "parser.h"
 #include "scopebuilder.h"
 #include "irgenerator.h"
+#include "irpass/profiler.h"
+#include "irpass/profileloader.h"
 #include "irpass/iroptimizer.h"
 #include "mipsgenerator.h"
 #include "mipspass/mipsoptimizer.h"
@@ -19,7 +21,11 @@ Err::Log errors;
 
 int main()
 {
+#if CPL_IO_UseStdin
 	Lex::Lexer tokens(&in, &errors);
+#else
+	Lex::Lexer tokens(CPL_IO_InputFileName, &errors);
+#endif
 	Parse::Parser ast(tokens, &errors);
 	if (ast.isError) {
 		errors.print();
@@ -35,9 +41,23 @@ int main()
 
 	IRGenerator irGenerator;
 	ast.accept(irGenerator);
+	// the ir holds everything later phases need, free the front end
+	ast.release();
+	scopeBuilder.release();
+	tokens.release();
+	Intern::symbols.release();
 
 	Module *irModule = irGenerator.module;
 
+	if (CPL_Opt_ProfileGen) {
+		Profiler profiler;
+		irModule->accept(profiler);
+	}
+	if (CPL_Opt_ProfileUse) {
+		ProfileLoader profileLoader;
+		irModule->accept(profileLoader);
+	}
+
 	IROptimizer irOptimizer;
 	irModule->accept(irOptimizer);
 
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <string>
+#include <set>
 
 #include "mipspass.h"
 #include "linkedlist.h"
@@ -103,7 +104,7 @@ public:
 class MGlobalWord : public MGlobalData {
 public:
 	IR::GlobalVar *globalVar = nullptr;
-	Scp::Variable *var = nullptr;
+	IR::VarInfo *var = nullptr;
 
 	MGlobalWord(Register *label, IR::GlobalVar *globalVar) {
 		this->label = label;
@@ -115,29 +116,76 @@ public:
 		visitor.visitMGlobalWord(this);
 	}
 
-	void printInitVal(ostream &out, Scp::Variable *var, int &cnt) const {
-		if (var->symType.isArray) {
-			for (int i = 0; i < var->symType[0]; i++) {
-				printInitVal(out, (*var)[i], cnt);
-			}
-		} else {
-			if (cnt > 0) {
+	// runs of at least minRun equal elements are not listed, zeros are
+	// skipped with .space and other values are repeated with value:count,
+	// which mars only accepts as the single operand of a .word
+	static const int minRun = 4;
+
+	// the label goes before the first directive
+	ostream &directive(ostream &out, bool &labelled) const {
+		if (!labelled) {
+			out << label << ": ";
+			labelled = true;
+		}
+		return out;
+	}
+
+	void printList(ostream &out, vector <int> &list, bool &labelled) const {
+		if (list.empty()) {
+			return;
+		}
+		directive(out, labelled) << ".word ";
+		for (int i = 0; i < list.size(); i++) {
+			if (i > 0) {
 				out << ", ";
 			}
-			out << var->get();
-			cnt++;
+			out << list[i];
 		}
+		out << endl;
+		list.clear();
 	}
 
 	void print(ostream &out) const {
-		if (var->isZeroInit || !var->init) {
+		if (var->isZero()) {
 			out << label << ": .space " << globalVar->type.getSize() << endl;
 			return;
 		}
-		out << label << ": .word ";
-		int cnt = 0;
-		printInitVal(out, var, cnt);
-		out << endl;
+		// (value, length) of the runs of equal elements
+		vector <pair <int, int>> runs;
+		auto append = [&](int value, int len) {
+			if (!runs.empty() && runs.back().first == value) {
+				runs.back().second += len;
+			} else {
+				runs.emplace_back(value, len);
+			}
+		};
+		int pos = 0;
+		for (auto &init : var->inits) {
+			if (init.first > pos) {
+				append(0, init.first - pos);
+			}
+			append(init.second, 1);
+			pos = init.first + 1;
+		}
+		if (pos < var->count()) {
+			append(0, var->count() - pos);
+		}
+
+		bool labelled = false;
+		vector <int> list;
+		for (auto &run : runs) {
+			if (run.second < minRun) {
+				list.insert(list.end(), run.second, run.first);
+				continue;
+			}
+			printList(out, list, labelled);
+			if (run.first == 0) {
+				directive(out, labelled) << ".space " << run.second * 4 << endl;
+			} else {
+				directive(out, labelled) << ".word " << run.first << ":" << run.second << endl;
+			}
+		}
+		printList(out, list, labelled);
 	}
 };
 
@@ -230,6 +278,7 @@ public:
 	LinkedList <MInst> insts;
 	Register *label = nullptr;
 	int loopDepth = 0;
+	double freq = 1;
 
 	MBasicBlock() {}
 
@@ -272,6 +321,10 @@ public:
 	LinkedList <MBasicBlock> blocks;
 	MStack *stack = new MStack();
 	MAddress *retAddr = nullptr;
+	// caller-saved registers written by this function and its callees,
+	// valid once the function is allocated
+	set <Register *> clobberRegs;
+	bool summarized = false;
 
 	MFunction() {}
 
@@ -9,6 +9,7 @@
 #include "mips.h"
 #include "symtypes.h"
 #include "irpass/loopanalyzer.h"
+#include "irpass/freqanalyzer.h"
 
 
 namespace IR {
@@ -31,6 +32,7 @@ public:
 	MBasicBlock *curBlock = nullptr;
 
 	LoopAnalyzer loopAnalyzer;
+	FreqAnalyzer freqAnalyzer;
 
 	// IR::Value -> register
 	map <int, Register *> valueMapping;
@@ -166,6 +168,7 @@ public:
 		curBlock = curFunc->allocBasicBlock();
 		curBlock->label = getReg(node);
 		curBlock->loopDepth = loopAnalyzer.loopDepth[node];
+		curBlock->freq = node->freq;
 		for (Inst *inst : node->insts) {
 			inst->accept(*this);
 		}
@@ -185,9 +188,13 @@ public:
 			}
 		}
 
+		// params after the 4th are passed on stack at 4 * index, otherwise
+		// all params stay in $a0-$a3 and need no frame
 		int cnt = 0;
 		for (Value *param : node->params) {
-			setAddress(param, curFunc->stack->alloc(4));
+			if (node->params.size() > 4) {
+				setAddress(param, curFunc->stack->alloc(4));
+			}
 			if (cnt < 4) {
 				static Register *paramReg[4] = {A0, A1, A2, A3};
 				setReg(param, paramReg[cnt]);
@@ -421,7 +428,9 @@ public:
 				type.pop();
 				continue;
 			}
-			if (reg == nullptr) {
+			if (reg == nullptr && addr->reg->isVirtual() && addr->offset == 0) {
+				reg = addr->reg;
+			} else if (reg == nullptr) {
 				reg = new Register();
 				appendInst(new LaInst(reg, addr));
 			}
@@ -436,9 +445,10 @@ public:
 			addr = new MAddress(reg, 0);
 		}
 
-		// load addr into reg
+		// load addr into reg, a stack address only pays off with the graph
+		// coloring allocator, under fast compile it only adds spills
 		if (CPL_Opt_EnableAddrToReg) {
-			if (addr->reg->type == RLabel) {
+			if (addr->reg->type == RLabel || (addr->reg == FP && !CPL_Opt_FastCompile)) {
 				Value *def = (*node)[0];
 				int instCount = 0;
 				for (Use *use : def->uses) {
@@ -446,8 +456,16 @@ public:
 					if (!inst->noDef && use->index == 0) {
 						continue;
 					}
+					// a gep with constant indices only adds to the offset,
+					// any other loads the address again
 					if (inst->instType() == TGetPtrInst) {
-						continue;
+						bool isConstIndex = true;
+						for (int i = 2; i < inst->values.size(); i++) {
+							isConstIndex &= (*inst)[i]->isConst();
+						}
+						if (isConstIndex) {
+							continue;
+						}
 					}
 					instCount += 1 << (2 * min(5, loopAnalyzer.loopDepth[inst->block] - loopAnalyzer.loopDepth[node->block]));
 				}
@@ -506,6 +524,7 @@ public:
 	void visitModule(Module *node) {
 		irModule = node;
 		irMain = node->funcs.last();
+		node->accept(freqAnalyzer);
 		for (GlobalVar *globalVar : node->globalVars) {
 			globalVar->accept(*this);
 		}
@@ -177,7 +177,7 @@ public:
 			MBasicBlock *jumpTar = label2block[(*jump)[0]->label];
 			if (condJump->instType() == TBeqInst) {
 				MBasicBlock *condJumpTar = label2block[(*condJump)[2]->label];
-				if (jumpTar->loopDepth > condJumpTar->loopDepth) {
+				if (jumpTar->freq > condJumpTar->freq) {
 					condJump->replaceWith(new BneInst((*condJump)[0], (*condJump)[1], jumpTar->label));
 					jump->replaceWith(new JInst(condJumpTar->label));
 				}
@@ -185,7 +185,7 @@ public:
 			}
 			if (condJump->instType() == TBneInst) {
 				MBasicBlock *condJumpTar = label2block[(*condJump)[2]->label];
-				if (jumpTar->loopDepth > condJumpTar->loopDepth) {
+				if (jumpTar->freq > condJumpTar->freq) {
 					condJump->replaceWith(new BeqInst((*condJump)[0], (*condJump)[1], jumpTar->label));
 					jump->replaceWith(new JInst(condJumpTar->label));
 				}
@@ -195,7 +195,7 @@ public:
 	}
 
 	map <int, vector <int>> children;
-	map <int, int> maxLength;
+	map <int, double> maxLength;
 	map <int, int> arrangeNext;
 	map <int, int> parent;
 	map <int, int> belong;
@@ -209,11 +209,9 @@ public:
 				heavyChild = i;
 			}
 		}
-		int loopDepth = 0;
 		if (id2block.count(u)) {
-			loopDepth = id2block[u]->loopDepth;
+			maxLength[u] += id2block[u]->freq;
 		}
-		maxLength[u] += 1 << min(10, 2 * loopDepth);
 		if (heavyChild >= 0 && u >= 0) {
 			arrangeNext[heavyChild] = u;
 		}
@@ -238,8 +236,8 @@ public:
 			blocks.emplace_back(block);
 		}
 		sort(blocks.begin(), blocks.end(), [&](MBasicBlock *u, MBasicBlock *v) {
-			if (u->loopDepth != v->loopDepth) {
-				return u->loopDepth < v->loopDepth;
+			if (u->freq != v->freq) {
+				return u->freq < v->freq;
 			}
 			return outEdge[u->id].size() < outEdge[v->id].size();
 		});
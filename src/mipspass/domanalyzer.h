@@ -0,0 +1,166 @@
+/*
+# dominance analyzer
+====================
+
+this pass builds the control flow graph of a mips function from the
+targets of its terminating jumps and computes the dominator tree with the
+iterative algorithm of cooper, harvey and kennedy
+
+only the blocks reachable from the entry are kept, indexed in reverse
+post order, so the entry is always block 0
+*/
+
+#ifndef __CPL_MIPS_DOM_ANALYZER_H__
+#define __CPL_MIPS_DOM_ANALYZER_H__
+
+#include <vector>
+#include <map>
+
+#include "../mips.h"
+
+
+namespace MIPS {
+
+namespace Passes {
+
+using namespace std;
+using namespace MIPS;
+
+
+class DomAnalyzer : public Pass {
+public:
+	MFunction *curFunc = nullptr;
+
+	vector <MBasicBlock *> blocks;
+	map <MBasicBlock *, int> index;
+	vector <vector <int>> succs, preds;
+	vector <int> domParent;
+	vector <vector <int>> domChildren;
+
+
+	vector <MBasicBlock *> getSuccs(MBasicBlock *block, map <string, MBasicBlock *> &label2block) {
+		vector <MBasicBlock *> res;
+		for (auto it = block->insts.rbegin(); it != block->insts.rend(); --it) {
+			MInst *inst = *it;
+			if (!inst->terminate) {
+				break;
+			}
+			if (inst->instType() == TJrInst) {
+				continue;
+			}
+			MBasicBlock *to = label2block[inst->operands.back()->label];
+			if (to != nullptr) {
+				res.emplace_back(to);
+			}
+		}
+		return res;
+	}
+
+	int intersect(int u, int v) {
+		while (u != v) {
+			while (u > v) {
+				u = domParent[u];
+			}
+			while (v > u) {
+				v = domParent[v];
+			}
+		}
+		return u;
+	}
+
+	bool dominates(MBasicBlock *u, MBasicBlock *v) {
+		if (index.count(u) == 0 || index.count(v) == 0) {
+			return false;
+		}
+		int target = index[u], cur = index[v];
+		while (cur > target) {
+			cur = domParent[cur];
+		}
+		return cur == target;
+	}
+
+	void visitMFunction(MFunction *node) {
+		curFunc = node;
+		blocks.clear();
+		index.clear();
+
+		map <string, MBasicBlock *> label2block;
+		for (MBasicBlock *block : node->blocks) {
+			label2block[block->label->label] = block;
+		}
+
+		// reverse post order from the entry
+		map <MBasicBlock *, vector <MBasicBlock *>> blockSuccs;
+		map <MBasicBlock *, bool> visited;
+		vector <MBasicBlock *> order;
+		vector <pair <MBasicBlock *, int>> stack;
+		MBasicBlock *entry = node->blocks.first();
+		if (entry == nullptr) {
+			return;
+		}
+		stack.emplace_back(entry, 0);
+		visited[entry] = true;
+		blockSuccs[entry] = getSuccs(entry, label2block);
+		while (!stack.empty()) {
+			MBasicBlock *block = stack.back().first;
+			int &next = stack.back().second;
+			if (next == blockSuccs[block].size()) {
+				order.emplace_back(block);
+				stack.pop_back();
+				continue;
+			}
+			MBasicBlock *to = blockSuccs[block][next++];
+			if (!visited[to]) {
+				visited[to] = true;
+				blockSuccs[to] = getSuccs(to, label2block);
+				stack.emplace_back(to, 0);
+			}
+		}
+		blocks.assign(order.rbegin(), order.rend());
+
+		int blockCnt = blocks.size();
+		for (int i = 0; i < blockCnt; i++) {
+			index[blocks[i]] = i;
+		}
+		succs.assign(blockCnt, vector <int>());
+		preds.assign(blockCnt, vector <int>());
+		for (int i = 0; i < blockCnt; i++) {
+			for (MBasicBlock *to : blockSuccs[blocks[i]]) {
+				succs[i].emplace_back(index[to]);
+				preds[index[to]].emplace_back(i);
+			}
+		}
+
+		// build dominator tree
+		domParent.assign(blockCnt, -1);
+		domParent[0] = 0;
+		bool changed = true;
+		while (changed) {
+			changed = false;
+			for (int i = 1; i < blockCnt; i++) {
+				int idom = -1;
+				for (int pred : preds[i]) {
+					if (domParent[pred] < 0) {
+						continue;
+					}
+					idom = idom < 0 ? pred : intersect(pred, idom);
+				}
+				if (idom != domParent[i]) {
+					domParent[i] = idom;
+					changed = true;
+				}
+			}
+		}
+
+		domChildren.assign(blockCnt, vector <int>());
+		for (int i = 1; i < blockCnt; i++) {
+			domChildren[domParent[i]].emplace_back(i);
+		}
+	}
+};
+
+}
+
+}
+
+#endif
@@ -7,6 +7,8 @@
 #include <algorithm>
 
 #include "../mips.h"
+#include "../bitmask.h"
+#include "regusage.h"
 
 
 namespace MIPS {
@@ -23,109 +25,146 @@ public:
 	int availRegCnt;
 	vector <Register *> availRegs;
 	vector <Register *> tempRegs;
+	vector <Register *> argRegs;
+	vector <Register *> physRegs;
+	vector <Register *> callerSaved;
+	vector <Register *> calleeSaved;
+
+	RegUsage regUsage;
 
 	MFunction *mainFunc = nullptr;
 	MFunction *curFunc = nullptr;
 
-	using RegSet = set <Register *, RegisterPtrComp>;
-
-	map <MInst *, RegSet> in, out;
-	map <MInst *, RegSet> def, use;
-
-	map <Register *, int, RegisterPtrComp> activeLength;
-	map <Register *, set <MInst *>, RegisterPtrComp> regDefs;
-	map <Register *, set <MInst *>, RegisterPtrComp> regUses;
-
-	RegSet initialRegs;
-	RegSet simplifyWorklist;
-	RegSet freezeWorklist;
-	RegSet spillWorklist;
-	RegSet spilledRegs;
-	RegSet coalescedRegs;
-	RegSet coloredRegs;
-	vector <Register *> selectedList;
-	RegSet selectedRegs;
-
-	set <MInst *> coalescedMoves;
-	set <MInst *> constrainedMoves;
-	set <MInst *> frozenMoves;
-	set <MInst *> worklistMoves;
-	set <MInst *> activeMoves;
-
-	map <Register *, RegSet, RegisterPtrComp> adjacent;
-	map <Register *, int, RegisterPtrComp> degree;
-	map <Register *, vector <MInst *>, RegisterPtrComp> moveList;
-	map <Register *, Register *, RegisterPtrComp> alias;
-	map <Register *, Register *, RegisterPtrComp> color;
+	// nodes of the interference graph are dense indices, physical registers
+	// come first and are precolored, virtual registers follow in the order
+	// of their ids, so a set of nodes iterates as a set of registers did
+	int physCnt = 0;
+	int nodeCnt = 0;
+	map <int, int> physIndex;
+	map <int, int> virtIndex;
+	vector <Register *> nodeReg;
+	vector <int> availIndex;
+
+	// moves are indexed in the order of their ids
+	vector <MInst *> moves;
+	map <MInst *, int> moveIndex;
+
+	vector <MBasicBlock *> blocks;
+	// live out of the first terminator of each block, where build starts
+	vector <Bitmask> buildLive;
+
+	vector <int> activeLength;
+	vector <vector <MInst *>> regDefs;
+	vector <vector <MInst *>> regUses;
+
+	set <int> simplifyWorklist;
+	set <int> freezeWorklist;
+	set <int> spillWorklist;
+	vector <int> selectedList;
+	vector <bool> selected;
+	vector <bool> coalesced;
+	vector <bool> colored;
+	vector <bool> spilled;
+
+	set <int> worklistMoves;
+	vector <bool> inWorklist;
+	vector <bool> activeMove;
+	vector <bool> coalescedMove;
+
+	// edges are kept twice, as a lower triangular bit matrix for membership
+	// tests and as adjacency lists of virtual nodes for iteration
+	Bitmask adjMatrix;
+	vector <vector <int>> adjList;
+	vector <int> degree;
+	// degrees are not reset when the graph is rebuilt after a spill
+	map <int, int> lastDegree;
+	vector <vector <int>> moveList;
+	vector <int> alias;
+	vector <bool> crossCall;
+	// physical registers clobbered by the calls a value lives across
+	vector <unsigned long long> crossClobber;
+	map <MInst *, vector <int>> callLive;
+	vector <Register *> color;
 
 
 	GCAllocator() {
 		availRegCnt = 18;
 		availRegs = {T0, T1, T2, T3, T4, T5, T6, T7, S0, S1, S2, S3, S4, S5, S6, S7, T8, T9};
 		tempRegs = {T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, A0, A1, A2, A3, V0, V1};
+		argRegs = {A0, A1, A2, A3, V0, V1};
+		callerSaved = {T0, T1, T2, T3, T4, T5, T6, T7, T8, T9};
+		calleeSaved = {S0, S1, S2, S3, S4, S5, S6, S7};
+		physRegs = {
+			ZERO, AT, V0, V1, A0, A1, A2, A3,
+			T0, T1, T2, T3, T4, T5, T6, T7,
+			S0, S1, S2, S3, S4, S5, S6, S7,
+			T8, T9, K0, K1, GP, SP, FP, RA
+		};
 	}
 
 
-	void insertInto(RegSet &s, Register *reg) {
-		if (reg->type != RVirtual) {
-			return;
-		}
-		s.insert(reg);
+	bool isNode(Register *reg) {
+		return reg->type != RImmediate && reg->type != RLabel;
 	}
 
-	void insertInto(RegSet &s, RegSet &t) {
-		for (Register *reg : t) {
-			s.insert(reg);
-		}
+	bool isVirtual(int node) {
+		return node >= physCnt;
 	}
 
-	void removeFrom(RegSet &s, Register *reg) {
-		s.erase(reg);
+	int getNode(Register *reg) {
+		if (reg->type != RVirtual) {
+			return physIndex[reg->type.id];
+		}
+		return virtIndex[reg->value->id];
 	}
 
-	void removeFrom(RegSet &s, RegSet &t) {
-		for (Register *reg : t) {
-			s.erase(reg);
+	void addTo(set <int> &worklist, int node) {
+		if (isVirtual(node)) {
+			worklist.insert(node);
 		}
 	}
 
 
-	bool hasEdge(Register *u, Register *v) {
-		if (u->type == RVirtual) {
-			return adjacent[u].count(v);
+	long long matrixIndex(int u, int v) {
+		if (u < v) {
+			swap(u, v);
 		}
-		if (v->type == RVirtual) {
-			return adjacent[v].count(u);
+		return 1ll * u * (u - 1) / 2 + v;
+	}
+
+	bool hasEdge(int u, int v) {
+		if (u == v) {
+			return false;
 		}
-		return false;
+		return adjMatrix.get(matrixIndex(u, v));
 	}
 
-	void addEdge(Register *u, Register *v) {
-		if (u->type == RImmediate || u->type == RLabel) {
+	void addEdge(int u, int v) {
+		if (u == v || (!isVirtual(u) && !isVirtual(v)) || hasEdge(u, v)) {
 			return;
 		}
-		if (v->type == RImmediate || v->type == RLabel) {
-			return;
+		adjMatrix.set(matrixIndex(u, v), 1);
+		if (isVirtual(u)) {
+			adjList[u].emplace_back(v);
+			degree[u]++;
 		}
-		if (u != v && !hasEdge(u, v)) {
-			if (u->type == RVirtual) {
-				adjacent[u].insert(v);
-				degree[u]++;
-			}
-			if (v->type == RVirtual) {
-				adjacent[v].insert(u);
-				degree[v]++;
-			}
+		if (isVirtual(v)) {
+			adjList[v].emplace_back(u);
+			degree[v]++;
 		}
 	}
 
+	bool isRemoved(int node) {
+		return selected[node] || coalesced[node];
+	}
+
 
-	Register *getAlias(Register *reg) {
-		if (alias.count(reg) == 0 || coalescedRegs.count(reg) == 0) {
-			return reg;
+	int getAlias(int node) {
+		if (!coalesced[node]) {
+			return node;
 		}
-		alias[reg] = getAlias(alias[reg]);
-		return alias[reg];
+		alias[node] = getAlias(alias[node]);
+		return alias[node];
 	}
 
 
@@ -141,407 +180,575 @@ public:
 		return false;
 	}
 
-	bool isMoveRelated(Register *reg) {
-		for (MInst *inst : moveList[reg]) {
-			if (activeMoves.count(inst) || worklistMoves.count(inst)) {
+	bool isMoveRelated(int node) {
+		for (int move : moveList[node]) {
+			if (activeMove[move] || inWorklist[move]) {
 				return true;
 			}
 		}
 		return false;
 	}
 
-	void enableMoves(Register *reg) {
-		for (MInst *inst : moveList[reg]) {
-			if (activeMoves.count(inst) == 0) {
+	void addMove(int move) {
+		inWorklist[move] = true;
+		worklistMoves.insert(move);
+	}
+
+	void enableMoves(int node) {
+		for (int move : moveList[node]) {
+			if (!activeMove[move]) {
 				continue;
 			}
-			activeMoves.erase(inst);
-			worklistMoves.insert(inst);
+			activeMove[move] = false;
+			addMove(move);
 		}
 	}
 
-	void getMoveInstOperands(MInst *inst, Register **x, Register **y) {
-		if (inst->instType() == TAddInst || inst->instType() == TAdduInst) {
-			*x = inst->operands[0];
-			if (inst->operands[1] == ZERO) {
-				*y = inst->operands[2];
-			} else {
-				*y = inst->operands[1];
-			}
-			return;
+	void getMoveInstOperands(MInst *inst, int *x, int *y) {
+		*x = getNode(inst->operands[0]);
+		if (inst->operands[1] == ZERO) {
+			*y = getNode(inst->operands[2]);
+		} else {
+			*y = getNode(inst->operands[1]);
 		}
 	}
 
-	void freezeMoves(Register *reg) {
-		for (MInst *inst : moveList[reg]) {
-			if (!activeMoves.count(inst) && !worklistMoves.count(inst)) {
+	// a frozen move stays in the worklist if it is there
+	void freezeMoves(int node) {
+		for (int move : moveList[node]) {
+			if (!activeMove[move] && !inWorklist[move]) {
 				continue;
 			}
-			activeMoves.erase(inst);
-			frozenMoves.insert(inst);
-			Register *x = nullptr, *y = nullptr;
-			getMoveInstOperands(inst, &x, &y);
-			Register *tar = nullptr;
-			if (getAlias(x) == getAlias(reg)) {
+			activeMove[move] = false;
+			int x, y;
+			getMoveInstOperands(moves[move], &x, &y);
+			int tar;
+			if (getAlias(x) == getAlias(node)) {
 				tar = getAlias(y);
 			} else {
 				tar = getAlias(x);
 			}
 			if (!isMoveRelated(tar) && degree[tar] < availRegCnt) {
-				removeFrom(freezeWorklist, tar);
-				insertInto(simplifyWorklist, tar);
+				freezeWorklist.erase(tar);
+				addTo(simplifyWorklist, tar);
 			}
 		}
 	}
 
 
-	void decDegree(Register *reg) {
-		degree[reg]--;
-		if (degree[reg] == availRegCnt) {
-			enableMoves(reg);
-			for (Register *adj : adjacent[reg]) {
-				if (selectedRegs.count(adj) || coalescedRegs.count(adj)) {
+	void decDegree(int node) {
+		degree[node]--;
+		if (degree[node] == availRegCnt) {
+			enableMoves(node);
+			for (int adj : adjList[node]) {
+				if (isRemoved(adj)) {
 					continue;
 				}
 				enableMoves(adj);
 			}
-			removeFrom(spillWorklist, reg);
-			if (isMoveRelated(reg)) {
-				insertInto(freezeWorklist, reg);
+			spillWorklist.erase(node);
+			if (isMoveRelated(node)) {
+				addTo(freezeWorklist, node);
 			} else {
-				insertInto(simplifyWorklist, reg);
+				addTo(simplifyWorklist, node);
 			}
 		}
 	}
 
-	void addWorkList(Register *reg) {
-		if (reg->type == RVirtual && !isMoveRelated(reg) && degree[reg] < availRegCnt) {
-			removeFrom(freezeWorklist, reg);
-			insertInto(simplifyWorklist, reg);
+	void addWorkList(int node) {
+		if (isVirtual(node) && !isMoveRelated(node) && degree[node] < availRegCnt) {
+			freezeWorklist.erase(node);
+			addTo(simplifyWorklist, node);
 		}
 	}
 
 
-	void analyse() {
-		def.clear();
-		use.clear();
-		in.clear();
-		out.clear();
-		activeLength.clear();
-		regDefs.clear();
-		regUses.clear();
-		initialRegs.clear();
-		map <Register *, MInst *> label2entry;
+	void initNodes() {
+		physIndex.clear();
+		virtIndex.clear();
+		nodeReg.clear();
+		availIndex.clear();
+		for (Register *reg : physRegs) {
+			physIndex[reg->type.id] = nodeReg.size();
+			nodeReg.emplace_back(reg);
+			availIndex.emplace_back(-1);
+		}
+		physCnt = nodeReg.size();
+		for (int i = 0; i < availRegCnt; i++) {
+			availIndex[getNode(availRegs[i])] = i;
+		}
+		map <int, Register *> virtRegs;
+		map <int, MInst *> moveInsts;
 		for (MBasicBlock *block : curFunc->blocks) {
-			label2entry[block->label] = block->insts.first();
 			for (MInst *inst : block->insts) {
+				for (Register *reg : inst->operands) {
+					if (reg->type == RVirtual) {
+						virtRegs.emplace(reg->value->id, reg);
+					}
+				}
+				if (isMoveInst(inst)) {
+					moveInsts[inst->id] = inst;
+				}
+			}
+		}
+		for (auto &it : virtRegs) {
+			virtIndex[it.first] = nodeReg.size();
+			nodeReg.emplace_back(it.second);
+		}
+		nodeCnt = nodeReg.size();
+		moves.clear();
+		moveIndex.clear();
+		for (auto &it : moveInsts) {
+			moveIndex[it.second] = moves.size();
+			moves.emplace_back(it.second);
+		}
+	}
+
+	// liveness is iterated per instruction in reverse order until no live
+	// set changes, the spill cost counts the instructions a register is
+	// live into over all the iterations
+	void analyse() {
+		blocks.clear();
+		map <string, int> label2block;
+		for (MBasicBlock *block : curFunc->blocks) {
+			label2block[block->label->label] = blocks.size();
+			blocks.emplace_back(block);
+		}
+		int blockCnt = blocks.size();
+		vector <Bitmask> liveIn(blockCnt, Bitmask(nodeCnt));
+		buildLive.assign(blockCnt, Bitmask(nodeCnt));
+		activeLength.assign(nodeCnt, 0);
+		regDefs.assign(nodeCnt, vector <MInst *>());
+		regUses.assign(nodeCnt, vector <MInst *>());
+
+		auto blockOf = [&](Register *label) {
+			auto it = label2block.find(label->label);
+			return it == label2block.end() || blocks[it->second]->insts.empty() ? -1 : it->second;
+		};
+		vector <vector <MInst *>> insts(blockCnt);
+		vector <int> buildFrom(blockCnt);
+		int instCnt = 0;
+		for (int b = 0; b < blockCnt; b++) {
+			for (MInst *inst : blocks[b]->insts) {
+				insts[b].emplace_back(inst);
 				int index = 0;
 				if (!inst->noDef) {
-					insertInto(def[inst], inst->operands[0]);
+					if (inst->operands[0]->type == RVirtual) {
+						regDefs[getNode(inst->operands[0])].emplace_back(inst);
+					}
 					index = 1;
 				}
 				for (int i = index; i < inst->operands.size(); i++) {
-					insertInto(use[inst], inst->operands[i]);
+					if (inst->operands[i]->type == RVirtual) {
+						regUses[getNode(inst->operands[i])].emplace_back(inst);
+					}
 				}
 			}
+			instCnt += insts[b].size();
+			int k = (int)insts[b].size() - 1;
+			while (k > 0 && insts[b][k - 1]->terminate) {
+				k--;
+			}
+			if (k >= 0 && !insts[b][k]->terminate) {
+				k = (int)insts[b].size() - 1;
+			}
+			buildFrom[b] = k;
+		}
+		auto byId = [](MInst *a, MInst *b) { return a->id < b->id; };
+		for (int node = physCnt; node < nodeCnt; node++) {
+			for (vector <MInst *> *list : {&regDefs[node], &regUses[node]}) {
+				sort(list->begin(), list->end(), byId);
+				list->erase(unique(list->begin(), list->end()), list->end());
+			}
 		}
+
+		vector <int> inSize(instCnt, 0), outSize(instCnt, 0);
+		Bitmask cur(nodeCnt), out(nodeCnt);
 		bool changed = true;
 		while (changed) {
 			changed = false;
-			auto blockIt = curFunc->blocks.rbegin();
-			while (blockIt != curFunc->blocks.rend()) {
-				MBasicBlock *block = *blockIt;
-				auto instIt = block->insts.rbegin();
-				MInst *nextInst = nullptr;
-				while (instIt != block->insts.rend()) {
-					MInst *inst = *instIt;
-					int sizeIn = in[inst].size();
-					int sizeOut = out[inst].size();
-
-					// out[inst] = union in[successors of inst]
-					out[inst].clear();
+			int pos = instCnt;
+			for (int b = blockCnt - 1; b >= 0; b--) {
+				cur.clear();
+				for (int k = (int)insts[b].size() - 1; k >= 0; k--) {
+					MInst *inst = insts[b][k];
+					pos--;
+					out.clear();
 					if (inst->terminate) {
 						if (inst->instType() == TJInst) {
-							insertInto(out[inst], in[label2entry[inst->operands[0]]]);
+							int to = blockOf(inst->operands[0]);
+							if (to >= 0) {
+								out.bitwiseOr(liveIn[to]);
+							}
 						} else if (inst->instType() != TJrInst) {
-							insertInto(out[inst], in[label2entry[inst->operands.back()]]);
-							insertInto(out[inst], in[nextInst]);
+							int to = blockOf(inst->operands.back());
+							if (to >= 0) {
+								out.bitwiseOr(liveIn[to]);
+							}
+							out.bitwiseOr(cur);
 						}
 					} else {
-						insertInto(out[inst], in[nextInst]);
+						out.bitwiseOr(cur);
 					}
-
-					// in[inst] = use[inst] union (out[inst] - def[inst])
-					in[inst].clear();
-					insertInto(in[inst], out[inst]);
-					if (!inst->noDef) {
-						removeFrom(in[inst], inst->operands[0]);
+					if (k == buildFrom[b]) {
+						buildLive[b] = out;
 					}
-					insertInto(in[inst], use[inst]);
 
-					// spill cost ~ activeLength
-					// spill cost ~ 1 / (regDefs count + regUses count)
-					for (Register *reg : in[inst]) {
-						activeLength[reg]++;
-					}
+					cur = out;
 					int index = 0;
 					if (!inst->noDef) {
 						if (inst->operands[0]->type == RVirtual) {
-							regDefs[inst->operands[0]].insert(inst);
+							cur.set(getNode(inst->operands[0]), 0);
 						}
 						index = 1;
 					}
 					for (int i = index; i < inst->operands.size(); i++) {
 						if (inst->operands[i]->type == RVirtual) {
-							regUses[inst->operands[i]].insert(inst);
+							cur.set(getNode(inst->operands[i]), 1);
 						}
 					}
 
-					for (Register *reg : inst->operands) {
-						insertInto(initialRegs, reg);
+					for (int w = 0; w < cur.bits.size(); w++) {
+						unsigned long long word = cur.bits[w];
+						while (word) {
+							activeLength[w * Bitmask::B + __builtin_ctzll(word)]++;
+							word &= word - 1;
+						}
 					}
-
-					if (in[inst].size() != sizeIn || out[inst].size() != sizeOut) {
+					int sizeIn = cur.count(), sizeOut = out.count();
+					if (sizeIn != inSize[pos] || sizeOut != outSize[pos]) {
+						inSize[pos] = sizeIn;
+						outSize[pos] = sizeOut;
 						changed = true;
 					}
-					nextInst = inst;
-					--instIt;
 				}
-				--blockIt;
+				if (!insts[b].empty()) {
+					liveIn[b] = cur;
+				}
 			}
 		}
 	}
 
 	void build() {
-		adjacent.clear();
-		moveList.clear();
-		coalescedRegs.clear();
-		coloredRegs.clear();
-		coalescedMoves.clear();
-		constrainedMoves.clear();
-		frozenMoves.clear();
+		simplifyWorklist.clear();
+		freezeWorklist.clear();
+		spillWorklist.clear();
+		selectedList.clear();
+		selected.assign(nodeCnt, false);
+		coalesced.assign(nodeCnt, false);
+		colored.assign(nodeCnt, false);
+		spilled.assign(nodeCnt, false);
 		worklistMoves.clear();
-		activeMoves.clear();
-		for (MBasicBlock *block : curFunc->blocks) {
-			auto instIt = block->insts.rbegin();
-			MInst *lastInst = block->insts.last();
-			while (instIt != block->insts.rend()) {
-				MInst *inst = *instIt;
-				if (!inst->terminate) {
-					break;
+		inWorklist.assign(moves.size(), false);
+		activeMove.assign(moves.size(), false);
+		coalescedMove.assign(moves.size(), false);
+		adjMatrix.resize(matrixIndex(nodeCnt, 0));
+		adjList.assign(nodeCnt, vector <int>());
+		degree.assign(nodeCnt, 0);
+		for (int node = physCnt; node < nodeCnt; node++) {
+			auto it = lastDegree.find(nodeReg[node]->value->id);
+			if (it != lastDegree.end()) {
+				degree[node] = it->second;
+			}
+		}
+		moveList.assign(nodeCnt, vector <int>());
+		alias.assign(nodeCnt, 0);
+		color.assign(nodeCnt, nullptr);
+		crossCall.assign(nodeCnt, false);
+		crossClobber.assign(nodeCnt, 0);
+		callLive.clear();
+
+		for (int b = 0; b < blocks.size(); b++) {
+			Bitmask live = buildLive[b];
+			for (auto it = blocks[b]->insts.rbegin(); it != blocks[b]->insts.rend(); --it) {
+				MInst *inst = *it;
+				int index = 0;
+				if (!inst->noDef) {
+					index = 1;
 				}
-				lastInst = inst;
-				--instIt;
-			}
-			RegSet live = out[lastInst];
-			instIt = block->insts.rbegin();
-			while (instIt != block->insts.rend()) {
-				MInst *inst = *instIt;
 				if (isMoveInst(inst)) {
-					removeFrom(live, use[inst]);
+					for (int i = index; i < inst->operands.size(); i++) {
+						if (inst->operands[i]->type == RVirtual) {
+							live.set(getNode(inst->operands[i]), 0);
+						}
+					}
+					int move = moveIndex[inst];
 					for (Register *reg : inst->operands) {
 						if (reg->type == RVirtual) {
-							moveList[reg].emplace_back(inst);
+							moveList[getNode(reg)].emplace_back(move);
 						}
 					}
-					worklistMoves.insert(inst);
+					addMove(move);
 				}
-				if (!inst->noDef) {
-					insertInto(live, inst->operands[0]);
-					for (Register *reg : live) {
-						addEdge(reg, inst->operands[0]);
+				if (!inst->noDef && isNode(inst->operands[0])) {
+					int def = getNode(inst->operands[0]);
+					if (isVirtual(def)) {
+						live.set(def, 1);
+					}
+					for (int w = 0; w < live.bits.size(); w++) {
+						unsigned long long word = live.bits[w];
+						while (word) {
+							addEdge(w * Bitmask::B + __builtin_ctzll(word), def);
+							word &= word - 1;
+						}
 					}
 				}
 
+				// values living across a call may still take $t registers,
+				// they are saved around this call only (see callerSavedRegs)
 				if (inst->instType() == TJalInst) {
-					for (Register *reg : live) {
-						for (Register *temp : tempRegs) {
-							addEdge(reg, temp);
+					vector <int> &across = callLive[inst];
+					set <Register *> clobber = regUsage.clobberedBy(inst);
+					unsigned long long clobberMask = 0;
+					for (Register *reg : clobber) {
+						clobberMask |= 1llu << getNode(reg);
+					}
+					for (int w = 0; w < live.bits.size(); w++) {
+						unsigned long long word = live.bits[w];
+						while (word) {
+							int node = w * Bitmask::B + __builtin_ctzll(word);
+							word &= word - 1;
+							across.emplace_back(node);
+							crossCall[node] = true;
+							crossClobber[node] |= clobberMask;
+							for (Register *arg : argRegs) {
+								if (clobber.count(arg)) {
+									addEdge(node, getNode(arg));
+								}
+							}
 						}
 					}
 				}
 
-				removeFrom(live, def[inst]);
-				insertInto(live, use[inst]);
-				--instIt;
+				if (!inst->noDef && inst->operands[0]->type == RVirtual) {
+					live.set(getNode(inst->operands[0]), 0);
+				}
+				for (int i = index; i < inst->operands.size(); i++) {
+					if (inst->operands[i]->type == RVirtual) {
+						live.set(getNode(inst->operands[i]), 1);
+					}
+				}
 			}
 		}
 
-		for (Register *reg : initialRegs) {
-			if (degree[reg] >= availRegCnt) {
-				insertInto(spillWorklist, reg);
-			} else if (isMoveRelated(reg)) {
-				insertInto(freezeWorklist, reg);
+		for (int node = physCnt; node < nodeCnt; node++) {
+			if (degree[node] >= availRegCnt) {
+				spillWorklist.insert(node);
+			} else if (isMoveRelated(node)) {
+				freezeWorklist.insert(node);
 			} else {
-				insertInto(simplifyWorklist, reg);
+				simplifyWorklist.insert(node);
 			}
 		}
-		initialRegs.clear();
 	}
 
 	void simplify() {
-		Register *reg = *simplifyWorklist.begin();
-		removeFrom(simplifyWorklist, reg);
-		selectedList.emplace_back(reg);
-		insertInto(selectedRegs, reg);
-		for (Register *adj : adjacent[reg]) {
-			if (selectedRegs.count(adj) || coalescedRegs.count(adj)) {
+		int node = *simplifyWorklist.begin();
+		simplifyWorklist.erase(node);
+		selectedList.emplace_back(node);
+		selected[node] = true;
+		for (int adj : adjList[node]) {
+			if (isRemoved(adj)) {
 				continue;
 			}
 			decDegree(adj);
 		}
 	}
 
-	void combine(Register *u, Register *v) {
-		removeFrom(freezeWorklist, v);
-		removeFrom(spillWorklist, v);
-		insertInto(coalescedRegs, v);
+	void combine(int u, int v) {
+		freezeWorklist.erase(v);
+		spillWorklist.erase(v);
+		coalesced[v] = true;
+		if (crossCall[v]) {
+			crossCall[u] = true;
+		}
+		crossClobber[u] |= crossClobber[v];
 		alias[v] = u;
-		for (MInst *inst : moveList[v]) {
-			moveList[u].emplace_back(inst);
+		for (int move : moveList[v]) {
+			moveList[u].emplace_back(move);
 		}
 		enableMoves(v);
-		for (Register *adj : adjacent[v]) {
-			if (selectedRegs.count(adj) || coalescedRegs.count(adj)) {
+		for (int adj : adjList[v]) {
+			if (isRemoved(adj)) {
 				continue;
 			}
 			addEdge(u, adj);
 			decDegree(adj);
 		}
 		if (degree[u] >= availRegCnt && freezeWorklist.count(u)) {
-			removeFrom(freezeWorklist, u);
-			insertInto(spillWorklist, u);
+			freezeWorklist.erase(u);
+			spillWorklist.insert(u);
 		}
 	}
 
 	void coalesce() {
-		MInst *inst = *worklistMoves.begin();
-		worklistMoves.erase(inst);
-		Register *x = nullptr, *y = nullptr;
-		getMoveInstOperands(inst, &x, &y);
+		int move = *worklistMoves.begin();
+		worklistMoves.erase(move);
+		inWorklist[move] = false;
+		int x, y;
+		getMoveInstOperands(moves[move], &x, &y);
 		x = getAlias(x);
 		y = getAlias(y);
-		if (y->type != RVirtual) {
+		if (!isVirtual(y)) {
 			swap(x, y);
 		}
 		if (x == y) {
-			coalescedMoves.insert(inst);
+			coalescedMove[move] = true;
 			addWorkList(x);
 			return;
 		}
-		if (y->type != RVirtual || hasEdge(x, y)) {
-			constrainedMoves.insert(inst);
+		if (!isVirtual(y) || hasEdge(x, y)) {
 			addWorkList(x);
 			addWorkList(y);
 			return;
 		}
-		if (x->type != RVirtual) {
+		if (!isVirtual(x)) {
 			bool valid = true;
-			for (Register *adj : adjacent[y]) {
-				if (selectedRegs.count(adj) || coalescedRegs.count(adj)) {
+			for (int adj : adjList[y]) {
+				if (isRemoved(adj)) {
 					continue;
 				}
-				if (degree[adj] < availRegCnt || adj->type != RVirtual || hasEdge(x, adj)) {
+				if (degree[adj] < availRegCnt || !isVirtual(adj) || hasEdge(x, adj)) {
 					continue;
 				}
 				valid = false;
 				break;
 			}
 			if (valid) {
-				coalescedMoves.insert(inst);
+				coalescedMove[move] = true;
 				combine(x, y);
 				addWorkList(x);
 				return;
 			}
 		}
-		if (x->type == RVirtual) {
-			RegSet adjacents;
-			insertInto(adjacents, adjacent[x]);
-			insertInto(adjacents, adjacent[y]);
+		if (isVirtual(x)) {
 			int count = 0;
-			for (Register *adj : adjacents) {
-				if (selectedRegs.count(adj) || coalescedRegs.count(adj)) {
-					continue;
+			for (int adj : adjList[x]) {
+				if (!isRemoved(adj) && degree[adj] >= availRegCnt) {
+					count++;
 				}
-				if (degree[adj] >= availRegCnt) {
+			}
+			for (int adj : adjList[y]) {
+				if (!isRemoved(adj) && degree[adj] >= availRegCnt && !hasEdge(x, adj)) {
 					count++;
 				}
 			}
 			if (count < availRegCnt) {
-				coalescedMoves.insert(inst);
+				coalescedMove[move] = true;
 				combine(x, y);
 				addWorkList(x);
 				return;
 			}
 		}
-		activeMoves.insert(inst);
+		activeMove[move] = true;
 	}
 
 	void freeze() {
-		Register *reg = *freezeWorklist.begin();
-		removeFrom(freezeWorklist, reg);
-		insertInto(simplifyWorklist, reg);
-		freezeMoves(reg);
+		int node = *freezeWorklist.begin();
+		freezeWorklist.erase(node);
+		simplifyWorklist.insert(node);
+		freezeMoves(node);
 	}
 
 	void selectSpill() {
-		Register *reg = nullptr;
+		int result = -1;
 		double maxCost = 0;
-		for (Register *r : spillWorklist) {
-			// useCount ~ the instructions to be inserted
-			int useCount = regDefs[r].size() + regUses[r].size();
-			double cost = 1.0 * (1 + activeLength[r]) / (1 + useCount);
+		for (int node : spillWorklist) {
+			// useCount ~ the instructions to be inserted, weighted by how
+			// often they are expected to run
+			double useCount = 0;
+			for (MInst *inst : regDefs[node]) {
+				useCount += inst->block->freq;
+			}
+			for (MInst *inst : regUses[node]) {
+				useCount += inst->block->freq;
+			}
+			double cost = (1 + activeLength[node]) / (1 + useCount);
 			if (cost > maxCost) {
 				maxCost = cost;
-				reg = r;
+				result = node;
 			}
 		}
-		removeFrom(spillWorklist, reg);
-		insertInto(simplifyWorklist, reg);
-		freezeMoves(reg);
+		spillWorklist.erase(result);
+		simplifyWorklist.insert(result);
+		freezeMoves(result);
 	}
 
-	void assignColors() {
+	bool assignColors() {
+		bool hasSpilled = false;
+		vector <bool> candidates(availRegCnt);
 		while (!selectedList.empty()) {
-			Register *reg = selectedList.back();
+			int node = selectedList.back();
 			selectedList.pop_back();
-			RegSet candidates;
-			for (Register *availReg : availRegs) {
-				candidates.insert(availReg);
+			fill(candidates.begin(), candidates.end(), true);
+			for (int adj : adjList[node]) {
+				int target = getAlias(adj);
+				if (!isVirtual(target)) {
+					if (availIndex[target] >= 0) {
+						candidates[availIndex[target]] = false;
+					}
+				} else if (colored[target]) {
+					candidates[availIndex[getNode(color[target])]] = false;
+				}
+			}
+			// $t untouched by the callees is free, $s costs a save per function,
+			// and a clobbered $t costs a save per call it lives across
+			vector <Register *> order;
+			for (Register *avail : callerSaved) {
+				if (!(crossClobber[node] >> getNode(avail) & 1)) {
+					order.emplace_back(avail);
+				}
 			}
-			for (Register *adj : adjacent[reg]) {
-				Register *alias = getAlias(adj);
-				if (alias->type != RVirtual) {
-					candidates.erase(alias);
+			if (crossCall[node]) {
+				order.insert(order.end(), calleeSaved.begin(), calleeSaved.end());
+			}
+			for (Register *avail : callerSaved) {
+				if (crossClobber[node] >> getNode(avail) & 1) {
+					order.emplace_back(avail);
 				}
-				if (coloredRegs.count(alias)) {
-					candidates.erase(color[alias]);
+			}
+			if (!crossCall[node]) {
+				order.insert(order.end(), calleeSaved.begin(), calleeSaved.end());
+			}
+			Register *reg = nullptr;
+			for (Register *avail : order) {
+				if (candidates[availIndex[getNode(avail)]]) {
+					reg = avail;
+					break;
 				}
 			}
-			if (candidates.empty()) {
-				spilledRegs.insert(reg);
+			if (!reg) {
+				spilled[node] = true;
+				hasSpilled = true;
 			} else {
-				coloredRegs.insert(reg);
-				color[reg] = *candidates.begin();
+				colored[node] = true;
+				color[node] = reg;
 			}
 		}
-		selectedList.clear();
-		selectedRegs.clear();
-		for (Register *reg : coalescedRegs) {
-			Register *alias = getAlias(reg);
-			if (alias->type != RVirtual) {
-				color[reg] = alias;
+		fill(selected.begin(), selected.end(), false);
+		for (int node = physCnt; node < nodeCnt; node++) {
+			if (!coalesced[node]) {
+				continue;
+			}
+			int target = getAlias(node);
+			if (!isVirtual(target)) {
+				color[node] = nodeReg[target];
 			} else {
-				color[reg] = color[alias];
+				color[node] = color[target];
 			}
 		}
+		return hasSpilled;
 	}
 
 	void rewrite() {
-		for (Register *reg : spilledRegs) {
+		for (int node = physCnt; node < nodeCnt; node++) {
+			if (!spilled[node]) {
+				continue;
+			}
+			Register *reg = nodeReg[node];
 			if (CPL_Opt_EnableAddrToReg) {
-				if (regDefs[reg].size() == 1) {
-					MInst *defInst = *(regDefs[reg].begin());
+				if (regDefs[node].size() == 1) {
+					MInst *defInst = regDefs[node].front();
 					if (defInst->instType() == TLaInst
 						|| defInst->instType() == TLiInst) {
 						bool noRVirtualUse = true;
@@ -552,7 +759,7 @@ public:
 							}
 						}
 						if (noRVirtualUse) {
-							for (MInst *inst : regUses[reg]) {
+							for (MInst *inst : regUses[node]) {
 								if (defInst->instType() == TLaInst
 									&& (inst->instType() == TLwInst
 										|| inst->instType() == TSwInst
@@ -576,7 +783,7 @@ public:
 								}
 								inst->insertBefore(instCopy);
 								for (int i = index; i < inst->operands.size(); i++) {
-									if (inst->operands[i] == reg) {
+									if (*inst->operands[i] == *reg) {
 										inst->operands[i] = newReg;
 									}
 								}
@@ -589,12 +796,12 @@ public:
 			}
 
 			MAddress *addr = curFunc->stack->alloc(4);
-			for (MInst *inst : regDefs[reg]) {
+			for (MInst *inst : regDefs[node]) {
 				Register *newReg = new Register();
 				inst->operands[0] = newReg;
 				inst->insertAfter(new SwInst(newReg, addr));
 			}
-			for (MInst *inst : regUses[reg]) {
+			for (MInst *inst : regUses[node]) {
 				Register *newReg = new Register();
 				int index = 0;
 				if (!inst->noDef) {
@@ -602,44 +809,46 @@ public:
 				}
 				inst->insertBefore(new LwInst(newReg, addr));
 				for (int i = index; i < inst->operands.size(); i++) {
-					if (inst->operands[i] == reg) {
+					if (*inst->operands[i] == *reg) {
 						inst->operands[i] = newReg;
 					}
 				}
 			}
 		}
-		spilledRegs.clear();
-		coloredRegs.clear();
-		coalescedRegs.clear();
+		for (int node = physCnt; node < nodeCnt; node++) {
+			lastDegree[nodeReg[node]->value->id] = degree[node];
+		}
 	}
 
 
 	void allocateRegs() {
-		analyse();
-		build();
 		while (true) {
-			if (!simplifyWorklist.empty()) {
-				simplify();
-				continue;
-			}
-			if (!worklistMoves.empty()) {
-				coalesce();
-				continue;
-			}
-			if (!freezeWorklist.empty()) {
-				freeze();
-				continue;
+			initNodes();
+			analyse();
+			build();
+			while (true) {
+				if (!simplifyWorklist.empty()) {
+					simplify();
+					continue;
+				}
+				if (!worklistMoves.empty()) {
+					coalesce();
+					continue;
+				}
+				if (!freezeWorklist.empty()) {
+					freeze();
+					continue;
+				}
+				if (!spillWorklist.empty()) {
+					selectSpill();
+					continue;
+				}
+				break;
 			}
-			if (!spillWorklist.empty()) {
-				selectSpill();
-				continue;
+			if (!assignColors()) {
+				break;
 			}
-			break;
-		}
-		assignColors();
-		if (!spilledRegs.empty()) {
 			rewrite();
-			allocateRegs();
 		}
 	}
 
@@ -651,32 +860,74 @@ public:
 					if (inst->operands[i]->type != RVirtual) {
 						continue;
 					}
-					inst->operands[i] = color[inst->operands[i]];
+					inst->operands[i] = color[getNode(inst->operands[i])];
 				}
 			}
 		}
-		for (MInst *inst : coalescedMoves) {
-			inst->remove();
+		for (int move = 0; move < moves.size(); move++) {
+			if (coalescedMove[move]) {
+				moves[move]->remove();
+			}
 		}
 	}
 
-	void calleeSavedRegs() {
-		RegSet savedRegs;
-		for (Register *reg : coloredRegs) {
-			savedRegs.insert(color[reg]);
+	void callerSavedRegs() {
+		map <Register *, MAddress *> savedAddr;
+		for (auto &it : callLive) {
+			MInst *jal = it.first;
+			set <Register *> clobber = regUsage.clobberedBy(jal);
+			set <Register *> savedRegs;
+			for (int node : it.second) {
+				Register *reg = color[node];
+				if (clobber.count(reg)) {
+					savedRegs.insert(reg);
+				}
+			}
+			if (savedRegs.empty()) {
+				continue;
+			}
+			// restore after $fp is reset to the caller frame
+			MInst *restorePos = jal;
+			bool afterCall = false;
+			for (MInst *inst : jal->block->insts) {
+				if (inst == jal) {
+					afterCall = true;
+				} else if (afterCall && !inst->noDef && inst->operands[0] == FP) {
+					restorePos = inst;
+					break;
+				}
+			}
+			for (Register *reg : tempRegs) {
+				if (!savedRegs.count(reg)) {
+					continue;
+				}
+				if (!savedAddr.count(reg)) {
+					savedAddr[reg] = curFunc->stack->alloc(4);
+				}
+				jal->insertBefore(new SwInst(reg, savedAddr[reg]));
+				restorePos->insertAfter(new LwInst(reg, savedAddr[reg]));
+			}
 		}
+	}
+
+	void calleeSavedRegs() {
+		set <Register *> savedRegs;
 		if (curFunc != mainFunc) {
-			for (Register *reg : tempRegs) {
-				savedRegs.erase(reg);
+			for (int node = physCnt; node < nodeCnt; node++) {
+				if (colored[node]) {
+					savedRegs.insert(color[node]);
+				}
 			}
-		} else {
-			for (Register *reg : availRegs) {
+			for (Register *reg : tempRegs) {
 				savedRegs.erase(reg);
 			}
 		}
 		MInst *firstInst = curFunc->blocks.first()->insts.first();
 		map <Register *, MAddress *> savedAddr;
-		for (Register *reg : savedRegs) {
+		for (Register *reg : availRegs) {
+			if (!savedRegs.count(reg)) {
+				continue;
+			}
 			MAddress *addr = curFunc->stack->alloc(4);
 			savedAddr[reg] = addr;
 			firstInst->insertAfter(new SwInst(reg, addr));
@@ -686,8 +937,10 @@ public:
 				if (inst->instType() != TJrInst) {
 					continue;
 				}
-				for (Register *reg : savedRegs) {
-					inst->insertBefore(new LwInst(reg, savedAddr[reg]));
+				for (Register *reg : availRegs) {
+					if (savedRegs.count(reg)) {
+						inst->insertBefore(new LwInst(reg, savedAddr[reg]));
+					}
 				}
 			}
 		}
@@ -698,13 +951,15 @@ public:
 		curFunc = node;
 		allocateRegs();
 		replaceRegs();
+		callerSavedRegs();
 		calleeSavedRegs();
 	}
 
 	void visitMModule(MModule *node) {
 		mainFunc = node->funcs.last();
-		for (MFunction *func : node->funcs) {
+		for (MFunction *func : regUsage.bottomUp(node)) {
 			func->accept(*this);
+			regUsage.summarize(func);
 		}
 	}
 };
@@ -713,4 +968,4 @@ public:
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,189 @@
+/*
+# global value numbering
+========================
+
+this pass combines def instructions with same operands along the dominator
+tree of each function, an instruction is replaced by a move from the
+register holding the same value in a dominating block
+
+it runs before register allocation, when the code is almost in ssa form,
+so only virtual registers with a single def are numbered, together with
+immediates, labels and $fp, which is never changed inside a function
+*/
+
+#ifndef __CPL_MIPS_GVN_H__
+#define __CPL_MIPS_GVN_H__
+
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "../mips.h"
+#include "../exprhash.h"
+#include "domanalyzer.h"
+
+
+namespace MIPS {
+
+namespace Passes {
+
+using namespace std;
+using namespace MIPS;
+using namespace ExprHash;
+
+
+class GVN : public Pass {
+public:
+	DomAnalyzer domAnalyzer;
+
+	MModule *module;
+
+	map <Register *, int, RegisterPtrComp> defCnt;
+	map <string, int> labelIds;
+
+
+	bool isStable(Register *reg) {
+		if (reg->type == RVirtual) {
+			return defCnt[reg] == 1;
+		}
+		return reg->type == RImmediate || reg->type == RLabel || reg == ZERO || reg == FP;
+	}
+
+	bool isStable(MInst *inst) {
+		for (Register *reg : inst->operands) {
+			if (!isStable(reg)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	long long R(Register *reg) {
+		if (reg->type == RImmediate) {
+			return ExprKey::constant(reg->immediate);
+		}
+		if (reg->type == RVirtual) {
+			return ExprKey::reg(reg->value->id);
+		}
+		if (reg->type == RLabel) {
+			if (labelIds.count(reg->label) == 0) {
+				int id = labelIds.size();
+				labelIds[reg->label] = id;
+			}
+			return ExprKey::operand(ExprKey::TagLabel, labelIds[reg->label]);
+		}
+		return ExprKey::operand(ExprKey::TagPhysReg, reg->type.id);
+	}
+
+
+	ExprTable <Register *> hashs;
+	// keys added in each scope of the dominator tree
+	vector <ExprKey> scopeLog;
+
+	void setHash(const ExprKey &key, Register *node, MInst *inst) {
+		Register **reg = hashs.find(key);
+		if (reg != nullptr) {
+			inst->replaceWith(new AddInst(node, ZERO, *reg));
+			module->changed = true;
+			return;
+		}
+		hashs.insert(key, node);
+		scopeLog.emplace_back(key);
+	}
+
+
+	void visitDomTree(int index) {
+		int scope = scopeLog.size();
+		vector <MInst *> insts;
+		for (MInst *inst : domAnalyzer.blocks[index]->insts) {
+			insts.emplace_back(inst);
+		}
+		for (MInst *inst : insts) {
+			if (!inst->noDef && isStable(inst)) {
+				inst->accept(*this);
+			}
+		}
+		for (int child : domAnalyzer.domChildren[index]) {
+			visitDomTree(child);
+		}
+		while (scopeLog.size() > scope) {
+			hashs.erase(scopeLog.back());
+			scopeLog.pop_back();
+		}
+	}
+
+	void visitMFunction(MFunction *node) {
+		node->accept(domAnalyzer);
+		if (domAnalyzer.blocks.empty()) {
+			return;
+		}
+		defCnt.clear();
+		for (MBasicBlock *block : node->blocks) {
+			for (MInst *inst : block->insts) {
+				if (!inst->noDef && (*inst)[0]->type == RVirtual) {
+					defCnt[(*inst)[0]]++;
+				}
+			}
+		}
+		hashs.clear();
+		scopeLog.clear();
+		visitDomTree(0);
+	}
+
+	void visitAdduInst(AdduInst *node) {
+		setHash(S(TAdduInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
+	}
+
+	void visitAddiuInst(AddiuInst *node) {
+		setHash(S(TAdduInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
+	}
+
+	void visitSubuInst(SubuInst *node) {
+		setHash(A(TSubuInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
+	}
+
+	void visitMulInst(MulInst *node) {
+		setHash(S(TMulInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
+	}
+
+	void visitDivInst(DivInst *node) {
+		setHash(A(TDivInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
+	}
+
+	void visitRemInst(RemInst *node) {
+		setHash(A(TRemInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
+	}
+
+	void visitSllInst(SllInst *node) {
+		setHash(A(TSllInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
+	}
+
+	void visitSraInst(SraInst *node) {
+		setHash(A(TSraInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
+	}
+
+	void visitSrlInst(SrlInst *node) {
+		setHash(A(TSrlInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
+	}
+
+	void visitLaInst(LaInst *node) {
+		setHash(A(TLaInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
+	}
+
+	void visitLiInst(LiInst *node) {
+		setHash(A(TLiInst, { R((*node)[1]) }), (*node)[0], node);
+	}
+
+	void visitMModule(MModule *node) {
+		module = node;
+		for (MFunction *func : node->funcs) {
+			func->accept(*this);
+		}
+	}
+};
+
+}
+
+}
+
+#endif
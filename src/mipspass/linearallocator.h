@@ -1,7 +1,33 @@
+/*
+# linear scan register allocator
+================================
+
+this allocator trades code quality for allocation time, it is used when
+compiling huge inputs where graph coloring becomes too slow
+
+instructions are numbered in block order, an instruction at position id
+reads its operands at the gap id - 1 and writes its result at id
+lifetime intervals are built from block liveness as sorted ranges with
+holes, and are split at gap positions when a register is only available
+for part of the lifetime, the parts on stack are served by $k0 / $k1
+intervals with a single definition (values coming from SSA form) are
+stored to their spill slot once after the definition, so moving such an
+interval from a register to stack needs no store
+*/
+
 #ifndef __CPL_LINEAR_ALLOCATOR_H__
 #define __CPL_LINEAR_ALLOCATOR_H__
 
+#include <vector>
 #include <map>
+#include <set>
+#include <queue>
+#include <algorithm>
+#include <climits>
+
+#include "../mips.h"
+#include "../bitmask.h"
+#include "regusage.h"
 
 
 namespace MIPS {
@@ -10,263 +36,920 @@ namespace Allocator {
 
 using namespace std;
 using namespace MIPS::Passes;
+using namespace Bits;
+
+
+struct LiveRange {
+	int from, to;
+
+	LiveRange(int from, int to) {
+		this->from = from;
+		this->to = to;
+	}
+};
+
+
+struct Interval {
+	int vreg = -1;
+	// ranges and use positions are sorted ascending
+	vector <LiveRange> ranges;
+	vector <int> usePos;
+	Register *reg = nullptr;
+	bool spilled = false;
+	Interval *parent = nullptr;
+	vector <Interval *> children;
+	Interval *hint = nullptr;
+	int hintPos = 0;
+
+	int start() const { return ranges.front().from; }
+	int end() const { return ranges.back().to; }
+
+	int findRange(int pos) const {
+		int l = 0, r = ranges.size();
+		while (l < r) {
+			int mid = (l + r) / 2;
+			if (ranges[mid].to <= pos) {
+				l = mid + 1;
+			} else {
+				r = mid;
+			}
+		}
+		return l;
+	}
+
+	bool covers(int pos) const {
+		int index = findRange(pos);
+		return index < ranges.size() && ranges[index].from <= pos;
+	}
+
+	// first position >= pos covered by both intervals
+	int nextIntersection(const Interval *other, int pos) const {
+		int i = findRange(pos);
+		int j = other->findRange(pos);
+		while (i < ranges.size() && j < other->ranges.size()) {
+			int from = max(max(ranges[i].from, other->ranges[j].from), pos);
+			int to = min(ranges[i].to, other->ranges[j].to);
+			if (from < to) {
+				return from;
+			}
+			if (ranges[i].to < other->ranges[j].to) {
+				i++;
+			} else {
+				j++;
+			}
+		}
+		return INT_MAX;
+	}
+
+	int nextUse(int pos) const {
+		auto it = lower_bound(usePos.begin(), usePos.end(), pos);
+		if (it == usePos.end()) {
+			return INT_MAX;
+		}
+		return *it;
+	}
+
+	// the part of the interval from pos on is moved into a new child
+	Interval *split(int pos) {
+		Interval *child = new Interval();
+		child->vreg = vreg;
+		child->parent = parent;
+		child->hint = hint;
+		int index = findRange(pos);
+		if (index < ranges.size() && ranges[index].from < pos) {
+			child->ranges.emplace_back(LiveRange(pos, ranges[index].to));
+			ranges[index].to = pos;
+			index++;
+		}
+		child->ranges.insert(child->ranges.end(), ranges.begin() + index, ranges.end());
+		ranges.erase(ranges.begin() + index, ranges.end());
+		auto it = lower_bound(usePos.begin(), usePos.end(), pos);
+		child->usePos.assign(it, usePos.end());
+		usePos.erase(it, usePos.end());
+		vector <Interval *> &siblings = parent->children;
+		siblings.insert(find(siblings.begin(), siblings.end(), this) + 1, child);
+		return child;
+	}
+
+	Interval *childAt(int pos) {
+		Interval *result = children.front();
+		for (Interval *child : children) {
+			if (child->ranges.empty() || child->start() > pos) {
+				break;
+			}
+			result = child;
+		}
+		return result;
+	}
+};
+
+
+struct IntervalComp {
+	bool operator () (Interval *a, Interval *b) const {
+		return a->start() > b->start();
+	}
+};
 
 
 class LinearAllocator : public Pass {
 public:
 	int regCnt;
 	vector <Register *> regs;
+	vector <Register *> tempRegs;
+	vector <Register *> scratchRegs;
 
-	MFunction *curFunc = nullptr;
-	MBasicBlock *curBlock = nullptr;
-	MInst *curInst = nullptr;
+	RegUsage regUsage;
 
-	vector <Register *> active;
-	vector <int> modified;
-	vector <int> counter;
-	vector <MAddress *> spillAddr;
-	vector <int> spillUsed;
-	map <int, int> allocated;
-	map <int, int> spillIndex;
+	MFunction *mainFunc = nullptr;
+	MFunction *curFunc = nullptr;
 
-	map <int, MInst *> firstUse;
-	map <int, MInst *> lastUse;
+	// numbering
+	vector <MInst *> insts;
+	vector <MBasicBlock *> blocks;
+	map <MInst *, int> instPos;
+	map <MBasicBlock *, int> blockIndex;
+	map <string, MBasicBlock *> label2block;
+	vector <int> blockFrom, blockTo;
+	vector <vector <int>> succs, preds;
+	vector <char> boundary;
+	vector <char> splittable;
+
+	// liveness
+	map <int, int> vregIndex;
+	vector <Register *> vregs;
+	vector <Bitmask> liveIn;
+
+	// intervals
+	vector <Interval *> intervals;
+	vector <Interval *> fixed;
+	vector <int> defCount;
+	vector <int> defPos;
+	vector <MAddress *> spillSlot;
+	priority_queue <Interval *, vector <Interval *>, IntervalComp> unhandled;
+	vector <Interval *> active, inactive;
 
 
 	LinearAllocator() {
 		regCnt = 18;
 		regs = {T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, S0, S1, S2, S3, S4, S5, S6, S7};
+		tempRegs = {T0, T1, T2, T3, T4, T5, T6, T7, T8, T9};
+		scratchRegs = {K0, K1};
 	}
 
 
-	void appendInst(MInst *inst) {
-		curBlock->append(inst);
-		inst->block = curBlock;
+	bool isMoveInst(MInst *inst) {
+		if (inst->instType() == TAddInst || inst->instType() == TAdduInst) {
+			if (inst->operands[1] == ZERO && inst->operands[2]->type == RVirtual) {
+				return true;
+			}
+		}
+		return false;
 	}
 
-	void insertBefore(MInst *inst) {
-		if (curInst != nullptr) {
-			curInst->insertBefore(inst);
-			return;
+	int getIndex(Register *reg) {
+		auto it = vregIndex.find(reg->value->id);
+		if (it != vregIndex.end()) {
+			return it->second;
 		}
-		appendInst(inst);
+		int index = vregs.size();
+		vregIndex[reg->value->id] = index;
+		vregs.emplace_back(reg);
+		return index;
+	}
+
+	int regIndex(Register *reg) {
+		for (int i = 0; i < regCnt; i++) {
+			if (regs[i] == reg) {
+				return i;
+			}
+		}
+		return -1;
 	}
 
 
-	MAddress *allocSpillAddr(Register *reg) {
-		spillAddr.emplace_back(curFunc->stack->alloc(4));
-		spillUsed.emplace_back(true);
-		spillIndex[reg->value->id] = spillAddr.size() - 1;
-		return spillAddr[spillIndex[reg->value->id]];
+	void numberInsts() {
+		insts.clear();
+		blocks.clear();
+		instPos.clear();
+		blockIndex.clear();
+		label2block.clear();
+		blockFrom.clear();
+		blockTo.clear();
+		vregIndex.clear();
+		vregs.clear();
+		// position 0 is never used, instructions start at 2
+		insts.emplace_back(nullptr);
+		for (MBasicBlock *block : curFunc->blocks) {
+			blockIndex[block] = blocks.size();
+			blocks.emplace_back(block);
+			label2block[block->label->label] = block;
+			blockFrom.emplace_back(insts.size() * 2 - 1);
+			for (MInst *inst : block->insts) {
+				instPos[inst] = insts.size() * 2;
+				insts.emplace_back(inst);
+				for (Register *reg : inst->operands) {
+					if (reg->type == RVirtual) {
+						getIndex(reg);
+					}
+				}
+			}
+			blockTo.emplace_back(insts.size() * 2 - 1);
+		}
+		int maxPos = insts.size() * 2 + 1;
+		boundary.assign(maxPos, false);
+		splittable.assign(maxPos, true);
+		for (int i = 0; i < blocks.size(); i++) {
+			boundary[blockFrom[i]] = true;
+			boundary[blockTo[i]] = true;
+			// moves cannot be placed between two terminators
+			bool firstTerminator = true;
+			for (MInst *inst : blocks[i]->insts) {
+				if (!inst->terminate) {
+					continue;
+				}
+				if (!firstTerminator) {
+					splittable[instPos[inst] - 1] = false;
+				}
+				firstTerminator = false;
+			}
+		}
 	}
 
-	void spillReg(int index = -1) {
-		if (index < 0) {
-			int maxCntIndex = 0;
-			for (int i = 0; i < regCnt; i++) {
-				if (active[i] == nullptr) {
+	void buildCFG() {
+		succs.assign(blocks.size(), vector <int>());
+		preds.assign(blocks.size(), vector <int>());
+		for (int i = 0; i < blocks.size(); i++) {
+			for (auto it = blocks[i]->insts.rbegin(); it != blocks[i]->insts.rend(); --it) {
+				MInst *inst = *it;
+				if (!inst->terminate) {
+					break;
+				}
+				if (inst->instType() == TJrInst) {
 					continue;
 				}
-				if (counter[i] < counter[maxCntIndex]) {
-					maxCntIndex = i;
+				int to = blockIndex[label2block[inst->operands.back()->label]];
+				if (find(succs[i].begin(), succs[i].end(), to) == succs[i].end()) {
+					succs[i].emplace_back(to);
+					preds[to].emplace_back(i);
 				}
 			}
-			index = maxCntIndex;
 		}
-		Register *reg = active[index];
-		active[index] = nullptr;
-		if (reg == nullptr) {
-			return;
+	}
+
+	void analyseLiveness() {
+		int n = vregs.size();
+		vector <Bitmask> gen(blocks.size()), kill(blocks.size());
+		liveIn.assign(blocks.size(), Bitmask(n));
+		for (int i = 0; i < blocks.size(); i++) {
+			gen[i].resize(n);
+			kill[i].resize(n);
+			for (MInst *inst : blocks[i]->insts) {
+				int index = inst->noDef ? 0 : 1;
+				for (int j = index; j < inst->operands.size(); j++) {
+					Register *reg = inst->operands[j];
+					if (reg->type == RVirtual && !kill[i].get(getIndex(reg))) {
+						gen[i].set(getIndex(reg), 1);
+					}
+				}
+				if (!inst->noDef && inst->operands[0]->type == RVirtual) {
+					kill[i].set(getIndex(inst->operands[0]), 1);
+				}
+			}
 		}
-		allocated.erase(reg->value->id);
-		if (!modified[index]) {
+		bool changed = true;
+		while (changed) {
+			changed = false;
+			for (int i = blocks.size() - 1; i >= 0; i--) {
+				Bitmask live(n);
+				for (int to : succs[i]) {
+					live.bitwiseOr(liveIn[to]);
+				}
+				live.bitwiseDiff(kill[i]);
+				live.bitwiseOr(gen[i]);
+				if (live.bits != liveIn[i].bits) {
+					liveIn[i] = live;
+					changed = true;
+				}
+			}
+		}
+	}
+
+
+	void addRange(Interval *interval, int from, int to) {
+		// ranges are built backwards, the last one is the earliest
+		vector <LiveRange> &ranges = interval->ranges;
+		if (!ranges.empty() && ranges.back().from <= to) {
+			ranges.back().from = min(ranges.back().from, from);
+			ranges.back().to = max(ranges.back().to, to);
 			return;
 		}
-		if (spillIndex.count(reg->value->id)) {
-			insertBefore(new SwInst(regs[index], spillAddr[spillIndex[reg->value->id]]));
+		ranges.emplace_back(LiveRange(from, to));
+	}
+
+	void setFrom(Interval *interval, int pos) {
+		vector <LiveRange> &ranges = interval->ranges;
+		if (!ranges.empty() && ranges.back().from <= pos && pos < ranges.back().to) {
+			ranges.back().from = pos;
 			return;
 		}
-		insertBefore(new SwInst(regs[index], allocSpillAddr(reg)));
+		// the definition is never used
+		ranges.emplace_back(LiveRange(pos, pos + 1));
 	}
 
-	Register *allocReg(Register *reg) {
-		static int lastIndex = -1;
-		for (int i = 0; i < regCnt; i++) {
-			counter[i]++;
+	void buildIntervals() {
+		int n = vregs.size();
+		intervals.assign(n, nullptr);
+		defCount.assign(n, 0);
+		defPos.assign(n, 0);
+		spillSlot.assign(n, nullptr);
+		for (int i = 0; i < n; i++) {
+			intervals[i] = new Interval();
+			intervals[i]->vreg = i;
+			intervals[i]->parent = intervals[i];
+			intervals[i]->children.emplace_back(intervals[i]);
 		}
-		int index = -1;
+		fixed.assign(regCnt, nullptr);
 		for (int i = 0; i < regCnt; i++) {
-			if (active[i] == nullptr) {
-				if (i == lastIndex) {
-					continue;
+			fixed[i] = new Interval();
+		}
+		for (int i = blocks.size() - 1; i >= 0; i--) {
+			Bitmask live(n);
+			for (int to : succs[i]) {
+				live.bitwiseOr(liveIn[to]);
+			}
+			for (int w = 0; w < live.bits.size(); w++) {
+				unsigned long long word = live.bits[w];
+				while (word) {
+					int index = w * Bitmask::B + __builtin_ctzll(word);
+					word &= word - 1;
+					addRange(intervals[index], blockFrom[i], blockTo[i]);
+				}
+			}
+			for (auto it = blocks[i]->insts.rbegin(); it != blocks[i]->insts.rend(); --it) {
+				MInst *inst = *it;
+				int pos = instPos[inst];
+				if (inst->instType() == TJalInst) {
+					set <Register *> clobber = regUsage.clobberedBy(inst);
+					for (Register *reg : tempRegs) {
+						if (clobber.count(reg)) {
+							addRange(fixed[regIndex(reg)], pos, pos + 1);
+						}
+					}
 				}
-				if (index < 0) {
-					index = i;
-				} else if (counter[i] > counter[index]) {
-					index = i;
+				if (!inst->noDef && inst->operands[0]->type == RVirtual) {
+					int index = getIndex(inst->operands[0]);
+					setFrom(intervals[index], pos);
+					intervals[index]->usePos.emplace_back(pos);
+					defCount[index]++;
+					defPos[index] = pos;
+				}
+				int index = inst->noDef ? 0 : 1;
+				for (int j = index; j < inst->operands.size(); j++) {
+					Register *reg = inst->operands[j];
+					if (reg->type != RVirtual) {
+						continue;
+					}
+					Interval *interval = intervals[getIndex(reg)];
+					addRange(interval, blockFrom[i], pos);
+					if (interval->usePos.empty() || interval->usePos.back() != pos - 1) {
+						interval->usePos.emplace_back(pos - 1);
+					}
+				}
+				if (isMoveInst(inst) && inst->operands[0]->type == RVirtual) {
+					Interval *dest = intervals[getIndex(inst->operands[0])];
+					Interval *src = intervals[getIndex(inst->operands[2])];
+					dest->hint = src;
+					dest->hintPos = pos - 1;
 				}
-			} else if (active[i] == reg) {
-				return regs[i];
 			}
 		}
-		if (index >= 0) {
-			lastIndex = index;
-			active[index] = reg;
-			allocated[reg->value->id] = index;
-			counter[index] = 0;
-			modified[index] = false;
-			return regs[index];
+		for (Interval *interval : intervals) {
+			reverse(interval->ranges.begin(), interval->ranges.end());
+			reverse(interval->usePos.begin(), interval->usePos.end());
+		}
+		for (Interval *interval : fixed) {
+			reverse(interval->ranges.begin(), interval->ranges.end());
+		}
+	}
+
+
+	// the latest position where a move can be placed, not after pos
+	int splitPosBefore(int pos) {
+		if (pos % 2 == 0) {
+			pos--;
+		}
+		while (pos > 0 && !splittable[pos]) {
+			pos -= 2;
+		}
+		return pos;
+	}
+
+	void spillAfterFirstUse(Interval *interval) {
+		interval->spilled = true;
+		interval->reg = nullptr;
+		// give the uses after the first one another chance for a register
+		int first = interval->nextUse(interval->start());
+		if (first == INT_MAX) {
+			return;
+		}
+		int second = interval->nextUse(first + 1);
+		if (second == INT_MAX) {
+			return;
+		}
+		int pos = splitPosBefore(second);
+		if (pos <= first || pos <= interval->start()) {
+			return;
+		}
+		unhandled.push(interval->split(pos));
+	}
+
+	void splitAndSpill(Interval *interval, int pos) {
+		pos = splitPosBefore(pos);
+		if (pos <= interval->start()) {
+			spillAfterFirstUse(interval);
+			return;
+		}
+		Interval *child = interval->split(pos);
+		if (child->ranges.empty()) {
+			return;
 		}
-		spillReg();
-		return allocReg(reg);
+		spillAfterFirstUse(child);
 	}
 
-	Register *getReg(Register *reg) {
-		if (reg->type != RVirtual) {
-			return reg;
+	bool tryAllocateFreeReg(Interval *current) {
+		vector <int> freeUntil(regCnt, INT_MAX);
+		for (Interval *interval : active) {
+			freeUntil[regIndex(interval->reg)] = 0;
+		}
+		for (Interval *interval : inactive) {
+			int index = regIndex(interval->reg);
+			freeUntil[index] = min(freeUntil[index], interval->nextIntersection(current, current->start()));
+		}
+		for (int i = 0; i < regCnt; i++) {
+			freeUntil[i] = min(freeUntil[i], fixed[i]->nextIntersection(current, current->start()));
+		}
+
+		int best = -1;
+		if (current->hint) {
+			Interval *hint = current->hint->childAt(current->hintPos);
+			if (hint->reg && freeUntil[regIndex(hint->reg)] >= current->end()) {
+				best = regIndex(hint->reg);
+			}
 		}
-		if (allocated.count(reg->value->id)) {
-			int index = allocated[reg->value->id];
-			if (active[index] != nullptr && active[index] == reg) {
-				for (int i = 0; i < regCnt; i++) {
-					counter[i]++;
+		if (best < 0) {
+			for (int i = 0; i < regCnt; i++) {
+				if (freeUntil[i] >= current->end()) {
+					best = i;
+					break;
 				}
-				counter[index] = 0;
-				return regs[index];
 			}
 		}
-		if (!spillIndex.count(reg->value->id)) {
-			allocSpillAddr(reg);
+		if (best < 0) {
+			best = 0;
+			for (int i = 1; i < regCnt; i++) {
+				if (freeUntil[i] > freeUntil[best]) {
+					best = i;
+				}
+			}
+		}
+
+		if (freeUntil[best] >= current->end()) {
+			current->reg = regs[best];
+			return true;
+		}
+		int pos = splitPosBefore(freeUntil[best]);
+		if (pos <= current->start()) {
+			return false;
+		}
+		current->reg = regs[best];
+		unhandled.push(current->split(pos));
+		return true;
+	}
+
+	void allocateBlockedReg(Interval *current) {
+		vector <int> nextUse(regCnt, INT_MAX);
+		vector <int> blockPos(regCnt, INT_MAX);
+		int start = current->start();
+		for (Interval *interval : active) {
+			int index = regIndex(interval->reg);
+			nextUse[index] = min(nextUse[index], interval->nextUse(start));
+		}
+		for (Interval *interval : inactive) {
+			if (interval->nextIntersection(current, start) == INT_MAX) {
+				continue;
+			}
+			int index = regIndex(interval->reg);
+			nextUse[index] = min(nextUse[index], interval->nextUse(start));
+		}
+		for (int i = 0; i < regCnt; i++) {
+			blockPos[i] = fixed[i]->nextIntersection(current, start);
+			nextUse[i] = min(nextUse[i], blockPos[i]);
+		}
+
+		int best = 0;
+		for (int i = 1; i < regCnt; i++) {
+			if (nextUse[i] > nextUse[best]) {
+				best = i;
+			}
+		}
+		int firstUse = current->nextUse(start);
+		int pos = blockPos[best] < current->end() ? splitPosBefore(blockPos[best]) : INT_MAX;
+		if (nextUse[best] <= firstUse || pos <= start) {
+			spillAfterFirstUse(current);
+			return;
+		}
+
+		current->reg = regs[best];
+		if (pos != INT_MAX) {
+			unhandled.push(current->split(pos));
+		}
+		for (int i = 0; i < active.size(); i++) {
+			Interval *interval = active[i];
+			if (interval->reg != regs[best]) {
+				continue;
+			}
+			splitAndSpill(interval, start);
+			if (interval->spilled) {
+				active.erase(active.begin() + i);
+				i--;
+			}
+		}
+		for (int i = 0; i < inactive.size(); i++) {
+			Interval *interval = inactive[i];
+			if (interval->reg != regs[best]) {
+				continue;
+			}
+			if (interval->nextIntersection(current, start) == INT_MAX) {
+				continue;
+			}
+			splitAndSpill(interval, start);
+			if (interval->spilled) {
+				inactive.erase(inactive.begin() + i);
+				i--;
+			}
 		}
-		Register *tar = allocReg(reg);
-		insertBefore(new LwInst(tar, spillAddr[spillIndex[reg->value->id]]));
-		return tar;
 	}
 
-	void releaseReg(Register *reg) {
-		if (allocated.count(reg->value->id)) {
-			if (spillIndex.count(reg->value->id)
-				&& modified[allocated[reg->value->id]]) {
-				curInst->insertAfter(new SwInst(regs[allocated[reg->value->id]], spillAddr[spillIndex[reg->value->id]]));
+	void linearScan() {
+		active.clear();
+		inactive.clear();
+		for (Interval *interval : intervals) {
+			if (!interval->ranges.empty()) {
+				unhandled.push(interval);
+			}
+		}
+		while (!unhandled.empty()) {
+			Interval *current = unhandled.top();
+			unhandled.pop();
+			int pos = current->start();
+			vector <Interval *> stillActive, stillInactive;
+			for (Interval *interval : active) {
+				if (interval->end() <= pos) {
+					continue;
+				}
+				if (interval->covers(pos)) {
+					stillActive.emplace_back(interval);
+				} else {
+					stillInactive.emplace_back(interval);
+				}
+			}
+			for (Interval *interval : inactive) {
+				if (interval->end() <= pos) {
+					continue;
+				}
+				if (interval->covers(pos)) {
+					stillActive.emplace_back(interval);
+				} else {
+					stillInactive.emplace_back(interval);
+				}
+			}
+			active.swap(stillActive);
+			inactive.swap(stillInactive);
+
+			if (!tryAllocateFreeReg(current)) {
+				allocateBlockedReg(current);
+			}
+			if (current->reg) {
+				active.emplace_back(current);
 			}
-			active[allocated[reg->value->id]] = nullptr;
-			allocated.erase(reg->value->id);
 		}
-		if (spillIndex.count(reg->value->id)) {
-			spillUsed[spillIndex[reg->value->id]] = false;
-			spillIndex.erase(reg->value->id);
+	}
+
+
+	struct Location {
+		Register *reg = nullptr;
+		MAddress *addr = nullptr;
+
+		bool operator == (const Location &o) const {
+			return reg == o.reg && addr == o.addr;
+		}
+		bool operator != (const Location &o) const {
+			return !(*this == o);
 		}
+	};
+
+	MAddress *getSpillSlot(int vreg) {
+		if (!spillSlot[vreg]) {
+			spillSlot[vreg] = curFunc->stack->alloc(4);
+		}
+		return spillSlot[vreg];
+	}
+
+	Location locationOf(Interval *interval) {
+		Location loc;
+		if (interval->reg) {
+			loc.reg = interval->reg;
+		} else {
+			loc.addr = getSpillSlot(interval->vreg);
+		}
+		return loc;
 	}
 
+	bool storedAtDef(int vreg) {
+		return defCount[vreg] == 1;
+	}
+
+	void appendMove(vector <pair <Location, Location>> &moves, int vreg, Location from, Location to) {
+		if (from == to) {
+			return;
+		}
+		// single definition values already live in their slot
+		if (to.addr && storedAtDef(vreg)) {
+			return;
+		}
+		moves.emplace_back(make_pair(from, to));
+	}
 
-	void visitMBasicBlock(MBasicBlock *node) {
-		curBlock = node;
-		for (MInst *inst : node->insts) {
-			inst->accept(*this);
-			visitMInst(inst);
+	MInst *moveInst(const Location &from, const Location &to) {
+		if (from.reg && to.reg) {
+			return new AddInst(to.reg, ZERO, from.reg);
 		}
-		if (node->insts.last()->instType() != TJInst
-			&& node->insts.last()->instType() != TJrInst) {
-			if (!curInst->terminate) {
-				curInst = nullptr;
+		if (from.reg) {
+			return new SwInst(from.reg, to.addr);
+		}
+		return new LwInst(to.reg, from.addr);
+	}
+
+	// emit a parallel copy as a sequence, cycles are broken with $k0
+	vector <MInst *> sequentialize(vector <pair <Location, Location>> moves) {
+		vector <MInst *> result;
+		while (!moves.empty()) {
+			bool progress = false;
+			for (int i = 0; i < moves.size(); i++) {
+				bool blocked = false;
+				for (int j = 0; j < moves.size(); j++) {
+					if (i != j && moves[j].first == moves[i].second) {
+						blocked = true;
+						break;
+					}
+				}
+				if (blocked) {
+					continue;
+				}
+				result.emplace_back(moveInst(moves[i].first, moves[i].second));
+				moves.erase(moves.begin() + i);
+				progress = true;
+				break;
 			}
-			for (int i = 0; i < regCnt; i++) {
-				if (active[i] != nullptr) {
-					spillReg(i);
+			if (progress) {
+				continue;
+			}
+			Location scratch;
+			scratch.reg = K0;
+			Location from = moves[0].first;
+			result.emplace_back(moveInst(from, scratch));
+			for (auto &move : moves) {
+				if (move.first == from) {
+					move.first = scratch;
 				}
 			}
 		}
+		return result;
 	}
 
-	void visitMFunction(MFunction *node) {
-		curFunc = node;
-		spillAddr.clear();
-		spillUsed.clear();
-		active.clear();
-		active.resize(regCnt);
-		modified.clear();
-		modified.resize(regCnt);
-		counter.clear();
-		counter.resize(regCnt);
-		for (MBasicBlock *block : node->blocks) {
-			for (MInst *inst : block->insts) {
-				for (Register *reg : inst->operands) {
-					if (reg->type == RVirtual) {
-						if (firstUse.count(reg->value->id) == 0) {
-							firstUse[reg->value->id] = inst;
-						}
-						lastUse[reg->value->id] = inst;
-					}
+	void insertSplitMoves() {
+		map <int, vector <pair <Location, Location>>> gapMoves;
+		for (Interval *parent : intervals) {
+			for (int i = 0; i + 1 < parent->children.size(); i++) {
+				Interval *prev = parent->children[i];
+				Interval *next = parent->children[i + 1];
+				if (prev->ranges.empty() || next->ranges.empty()) {
+					continue;
 				}
+				if (prev->end() != next->start() || boundary[next->start()]) {
+					continue;
+				}
+				appendMove(gapMoves[next->start()], parent->vreg, locationOf(prev), locationOf(next));
 			}
 		}
-		for (MBasicBlock *block : node->blocks) {
-			block->accept(*this);
+		for (auto &gap : gapMoves) {
+			MInst *inst = insts[(gap.first + 1) / 2];
+			for (MInst *move : sequentialize(gap.second)) {
+				inst->insertBefore(move);
+			}
 		}
 	}
 
-	void visitMInst(MInst *node) {
-		curInst = node;
-		int index = 0;
-		vector <Register *> releaseRegs;
-		if (!node->noDef) {
-			Register *def = (*node)[0];
-			if (def->type == RVirtual) {
-				if (lastUse[def->value->id] == node) {
-					releaseRegs.emplace_back(def);
+	Location locationAt(int vreg, int pos) {
+		return locationOf(intervals[vreg]->childAt(pos));
+	}
+
+	void resolveDataFlow() {
+		int blockCnt = blocks.size();
+		for (int to = 0; to < blockCnt; to++) {
+			for (int from : preds[to]) {
+				vector <pair <Location, Location>> moves;
+				Bitmask &live = liveIn[to];
+				for (int w = 0; w < live.bits.size(); w++) {
+					unsigned long long word = live.bits[w];
+					while (word) {
+						int index = w * Bitmask::B + __builtin_ctzll(word);
+						word &= word - 1;
+						appendMove(moves, index, locationAt(index, blockTo[from] - 1), locationAt(index, blockFrom[to]));
+					}
+				}
+				if (moves.empty()) {
+					continue;
 				}
-				Register *reg = allocReg(def);
-				node->operands[0] = reg;
-				modified[allocated[def->value->id]] = true;
+				insertEdgeMoves(blocks[from], blocks[to], sequentialize(moves), preds[to].size() == 1);
 			}
-			index = 1;
 		}
-		for (int i = index; i < node->operands.size(); i++) {
-			Register *op = (*node)[i];
-			if (op->type == RVirtual) {
-				if (lastUse[op->value->id] == node) {
-					releaseRegs.emplace_back(op);
-				}
-				node->operands[i] = getReg(op);
+	}
+
+	void insertEdgeMoves(MBasicBlock *from, MBasicBlock *to, const vector <MInst *> &moves, bool singlePred) {
+		MInst *last = from->insts.last();
+		MInst *prev = (MInst *)last->__ll_prev;
+		bool singleJump = last->instType() == TJInst
+			&& (from->insts.first() == last || !prev->terminate);
+		if (singleJump) {
+			for (MInst *move : moves) {
+				last->insertBefore(move);
+			}
+			return;
+		}
+		if (singlePred) {
+			MInst *first = to->insts.first();
+			for (MInst *move : moves) {
+				first->insertBefore(move);
 			}
+			return;
 		}
-		for (Register *reg : releaseRegs) {
-			releaseReg(reg);
+		// critical edge
+		MBasicBlock *jump = curFunc->allocBasicBlock();
+		jump->label = new Register(curFunc->name.substr(1) + "_split_" + to_string(from->id) + "_" + to_string(to->id));
+		jump->loopDepth = from->loopDepth;
+		jump->freq = min(from->freq, to->freq);
+		for (MInst *move : moves) {
+			move->block = jump;
+			jump->append(move);
+		}
+		MInst *jumpInst = new JInst(to->label);
+		jumpInst->block = jump;
+		jump->append(jumpInst);
+		for (auto it = from->insts.rbegin(); it != from->insts.rend(); --it) {
+			MInst *inst = *it;
+			if (!inst->terminate) {
+				break;
+			}
+			if (inst->instType() == TJrInst) {
+				continue;
+			}
+			if (inst->operands.back()->label == to->label->label) {
+				inst->operands.back() = jump->label;
+			}
 		}
 	}
 
-	void visitJalInst(JalInst *node) {
-		curInst = node;
-		for (int i = 0; i < regCnt; i++) {
-			if (active[i] != nullptr) {
-				spillReg(i);
+	void insertDefStores() {
+		for (int i = 0; i < intervals.size(); i++) {
+			if (!storedAtDef(i)) {
+				continue;
+			}
+			bool hasSpilled = false;
+			for (Interval *child : intervals[i]->children) {
+				if (!child->ranges.empty() && child->reg == nullptr) {
+					hasSpilled = true;
+					break;
+				}
+			}
+			if (!hasSpilled) {
+				continue;
+			}
+			Interval *def = intervals[i]->childAt(defPos[i]);
+			// a definition on stack is stored by rewriteOperands
+			if (def->reg) {
+				insts[defPos[i] / 2]->insertAfter(new SwInst(def->reg, getSpillSlot(i)));
 			}
 		}
 	}
 
-	void visitJrInst(JrInst *node) {
-		for (int i = 0; i < regCnt; i++) {
-			if (active[i] != nullptr) {
-				allocated.erase(active[i]->value->id);
-				active[i] = nullptr;
+	void rewriteOperands() {
+		for (int i = 1; i < insts.size(); i++) {
+			MInst *inst = insts[i];
+			int pos = i * 2;
+			int index = inst->noDef ? 0 : 1;
+			int scratchCnt = 0;
+			map <int, Register *> reloaded;
+			for (int j = index; j < inst->operands.size(); j++) {
+				Register *reg = inst->operands[j];
+				if (reg->type != RVirtual) {
+					continue;
+				}
+				int vreg = getIndex(reg);
+				Location loc = locationAt(vreg, pos - 1);
+				if (loc.reg) {
+					inst->operands[j] = loc.reg;
+					continue;
+				}
+				if (!reloaded.count(vreg)) {
+					Register *scratch = scratchRegs[scratchCnt++];
+					inst->insertBefore(new LwInst(scratch, loc.addr));
+					reloaded[vreg] = scratch;
+				}
+				inst->operands[j] = reloaded[vreg];
+			}
+			if (!inst->noDef && inst->operands[0]->type == RVirtual) {
+				int vreg = getIndex(inst->operands[0]);
+				Location loc = locationAt(vreg, pos);
+				if (loc.reg) {
+					inst->operands[0] = loc.reg;
+				} else {
+					inst->operands[0] = K0;
+					inst->insertAfter(new SwInst(K0, loc.addr));
+				}
+			}
+			if (isMoveInst(inst) || (inst->instType() == TAddInst && inst->operands[1] == ZERO)) {
+				if (inst->operands[0] == inst->operands[2]) {
+					inst->remove();
+				}
 			}
 		}
 	}
 
-	void visitJInst(JInst *node) {
-		if (!curInst->terminate) {
-			curInst = node;
+	void calleeSavedRegs() {
+		if (curFunc == mainFunc) {
+			return;
 		}
-		for (int i = 0; i < regCnt; i++) {
-			if (active[i] != nullptr) {
-				spillReg(i);
+		set <Register *> savedRegs;
+		for (Interval *parent : intervals) {
+			for (Interval *child : parent->children) {
+				if (child->reg && find(tempRegs.begin(), tempRegs.end(), child->reg) == tempRegs.end()) {
+					savedRegs.insert(child->reg);
+				}
+			}
+		}
+		MInst *firstInst = curFunc->blocks.first()->insts.first();
+		map <Register *, MAddress *> savedAddr;
+		for (Register *reg : regs) {
+			if (!savedRegs.count(reg)) {
+				continue;
+			}
+			MAddress *addr = curFunc->stack->alloc(4);
+			savedAddr[reg] = addr;
+			firstInst->insertAfter(new SwInst(reg, addr));
+		}
+		for (MBasicBlock *block : curFunc->blocks) {
+			for (MInst *inst : block->insts) {
+				if (inst->instType() != TJrInst) {
+					continue;
+				}
+				for (auto it : savedAddr) {
+					inst->insertBefore(new LwInst(it.first, it.second));
+				}
 			}
 		}
 	}
 
+
+	void visitMFunction(MFunction *node) {
+		curFunc = node;
+		numberInsts();
+		buildCFG();
+		analyseLiveness();
+		buildIntervals();
+		linearScan();
+		insertSplitMoves();
+		resolveDataFlow();
+		insertDefStores();
+		rewriteOperands();
+		calleeSavedRegs();
+		for (Interval *parent : intervals) {
+			vector <Interval *> children;
+			children.swap(parent->children);
+			for (Interval *child : children) {
+				delete child;
+			}
+		}
+		for (Interval *interval : fixed) {
+			delete interval;
+		}
+	}
+
 	void visitMModule(MModule *node) {
-		for (MFunction *func : node->funcs) {
+		mainFunc = node->funcs.last();
+		for (MFunction *func : regUsage.bottomUp(node)) {
 			func->accept(*this);
+			regUsage.summarize(func);
 		}
 	}
 };
@@ -275,4 +958,4 @@ public:
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -23,65 +23,32 @@ public:
 	MModule *module;
 
 
-	HashItem *R(Register *reg) {
+	long long R(Register *reg) {
 		if (reg->type == RImmediate) {
-			return new HashConst(reg->immediate);
+			return ExprKey::constant(reg->immediate);
 		}
 		if (reg->type == RVirtual) {
-			return new HashReg(reg->value->id);
+			return ExprKey::reg(reg->value->id);
 		}
-		return new HashReg(-reg->type.id);
+		return ExprKey::operand(ExprKey::TagPhysReg, reg->type.id);
 	}
 
-	HashItem *S(const vector <HashItem *> &items) {
-		HashSet *hSet = new HashSet();
-		for (HashItem *item : items) {
-			hSet->items.emplace_back(item);
-		}
-		hSet->calcHashValue();
-		return hSet;
-	}
-
-	HashItem *A(const vector <HashItem *> &items) {
-		HashArray *hArray = new HashArray();
-		for (HashItem *item : items) {
-			hArray->items.emplace_back(item);
-		}
-		hArray->calcHashValue();
-		return hArray;
-	}
 
-	HashItem *T(const Type &type) {
-		return new HashConst(type.id);
-	}
-
-
-	map <int, vector <pair <HashItem *, Register *>>> hashs;
+	ExprTable <Register *> hashs;
 
-	void setHash(vector <HashItem *> items, Register *node, MInst *inst) {
-		for (HashItem *item : items) {
-			if (hashs.count(item->hashValue)) {
-				for (auto pair : hashs[item->hashValue]) {
-					if (item->equals(pair.first)) {
-						inst->replaceWith(new AddInst(node, ZERO, pair.second));
-						module->changed = true;
-						return;
-					}
-				}
-			}
-		}
-		for (HashItem *item : items) {
-			hashs[item->hashValue].emplace_back(make_pair(item, node));
+	void setHash(const ExprKey &key, Register *node, MInst *inst) {
+		Register **reg = hashs.find(key);
+		if (reg != nullptr) {
+			inst->replaceWith(new AddInst(node, ZERO, *reg));
+			module->changed = true;
+			return;
 		}
+		hashs.insert(key, node);
 	}
 
 
 	void visitMBasicBlock(MBasicBlock *node) {
 		hashs.clear();
-		HashSet::clear();
-		HashArray::clear();
-		HashConst::clear();
-		HashReg::clear();
 		for (MInst *inst : node->insts) {
 			inst->accept(*this);
 		}
@@ -100,9 +67,7 @@ public:
 		if ((*node)[2]->type != RVirtual && (*node)[2]->type != RImmediate) {
 			return;
 		}
-		setHash({
-			A({ T(TAdduInst), S({ R((*node)[1]), R((*node)[2]) }) })
-		}, (*node)[0], node);
+		setHash(S(TAdduInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
 	}
 
 	void visitSubuInst(SubuInst *node) {
@@ -112,9 +77,7 @@ public:
 		if ((*node)[2]->type != RVirtual && (*node)[2]->type != RImmediate) {
 			return;
 		}
-		setHash({
-			A({ T(TSubuInst), R((*node)[1]), R((*node)[2]) })
-		}, (*node)[0], node);
+		setHash(A(TSubuInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
 	}
 
 	void visitMulInst(MulInst *node) {
@@ -124,9 +87,7 @@ public:
 		if ((*node)[2]->type != RVirtual && (*node)[2]->type != RImmediate) {
 			return;
 		}
-		setHash({
-			A({ T(TMulInst), S({ R((*node)[1]), R((*node)[2]) }) })
-		}, (*node)[0], node);
+		setHash(S(TMulInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
 	}
 
 	void visitDivInst(DivInst *node) {
@@ -136,9 +97,7 @@ public:
 		if ((*node)[2]->type != RVirtual && (*node)[2]->type != RImmediate) {
 			return;
 		}
-		setHash({
-			A({ T(TDivInst), R((*node)[1]), R((*node)[2]) })
-		}, (*node)[0], node);
+		setHash(A(TDivInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
 	}
 
 	void visitRemInst(RemInst *node) {
@@ -148,9 +107,7 @@ public:
 		if ((*node)[2]->type != RVirtual && (*node)[2]->type != RImmediate) {
 			return;
 		}
-		setHash({
-			A({ T(TRemInst), R((*node)[1]), R((*node)[2]) })
-		}, (*node)[0], node);
+		setHash(A(TRemInst, { R((*node)[1]), R((*node)[2]) }), (*node)[0], node);
 	}
 
 	void visitMModule(MModule *node) {
@@ -8,6 +8,7 @@
 #include "phielimination.h"
 #include "muldiv.h"
 #include "lvn.h"
+#include "gvn.h"
 #include "peephole.h"
 #include "dce.h"
 #include "removefp.h"
@@ -15,6 +16,7 @@
 #include "blockrearrange.h"
 #include "linearallocator.h"
 #include "gcallocator.h"
+#include "scheduler.h"
 
 
 namespace MIPS {
@@ -31,21 +33,45 @@ public:
 	PhiElimination phiElimination;
 	MulDiv mulDiv;
 	LVN lvn;
+	GVN gvn;
 	Peephole peephole;
 	DCE dce;
 	RemoveFp removeFp;
 	ReplaceDivRem replaceDivRem;
 	BlockRearrange blockRearrange;
 	GCAllocator gcAlloc;
+	LinearAllocator linearAlloc;
+	Scheduler scheduler;
+
+	// single pass pipeline for huge inputs, no fixpoint iteration
+	void fastCompile(MModule *node) {
+		if (CPL_Opt_MIPSOptimizer) {
+			node->accept(dce);
+			node->accept(mulDiv);
+		}
+		node->accept(linearAlloc);
+		if (CPL_Opt_MIPSOptimizer) {
+			node->accept(removeFp);
+			node->accept(replaceDivRem);
+			node->accept(blockRearrange);
+			node->accept(peephole);
+			node->accept(scheduler);
+		}
+	}
 
 	void visitMModule(MModule *node) {
 		if (CPL_Opt_EnableSSA) {
 			node->accept(phiElimination);
 		}
+		if (CPL_Opt_FastCompile) {
+			fastCompile(node);
+			return;
+		}
 		if (CPL_Opt_MIPSOptimizer) {
 			do {
 				node->changed = false;
 				node->accept(lvn);
+				node->accept(gvn);
 				node->accept(peephole);
 				node->accept(dce);
 				node->accept(mulDiv);
@@ -56,10 +82,9 @@ public:
 			node->accept(removeFp);
 			node->accept(replaceDivRem);
 			node->accept(blockRearrange);
-			do {
-				node->changed = false;
-				node->accept(peephole);
-			} while (node->changed);
+			node->accept(peephole);
+			// scheduled after allocation, so the register pressure is left unchanged
+			node->accept(scheduler);
 		}
 	}
 };
@@ -2,12 +2,28 @@
 # peephole optimization
 =======================
 
+this pass rewrites short windows of adjacent instructions in a basic block,
+the rules are kept in a table keyed by the opcodes of the window, from one
+to four instructions, and are tried in order at each instruction
+
+the pass runs a worklist over each function, after a rewrite only the
+instructions around it are examined again, so a single run reaches the
+fixed point of the rules
+
+an instruction whose result is no longer needed after a rewrite is only
+removed when its destination is dead, for virtual registers when no use is
+left in the function, for physical registers when it is redefined in the
+same block before any use
 */
 
 #ifndef __CPL_PEEPHOLE_H__
 #define __CPL_PEEPHOLE_H__
 
 #include <vector>
+#include <map>
+#include <set>
+#include <deque>
+#include <climits>
 
 #include "../mips.h"
 
@@ -22,33 +38,270 @@ using namespace MIPS;
 
 class Peephole : public Pass {
 public:
+	typedef bool (Peephole::*Rewrite)(const vector <MInst *> &window);
+
+	struct Rule {
+		vector <Type> pattern;
+		Rewrite rewrite;
+	};
+
+	// matches any instruction in a pattern
+	const Type TAnyInst = Type("any");
+
+	// the longest pattern is 4 instructions
+	const int maxWindow = 4;
+
 	MModule *module;
 	MFunction *curFunc = nullptr;
 
+	vector <Rule> rules;
+
+	map <Register *, int, RegisterPtrComp> useCnt;
+	set <MInst *> removed;
+	set <MInst *> queued;
+	deque <MInst *> worklist;
+
+	Peephole() {
+		rules = {
+			// single instructions
+			{{TAddInst}, &Peephole::simplifyAdd},
+			{{TAdduInst}, &Peephole::simplifyAddu},
+			{{TSubInst}, &Peephole::simplifySub},
+			{{TSubuInst}, &Peephole::simplifySub},
+			{{TSeqInst}, &Peephole::simplifySeq},
+			{{TSneInst}, &Peephole::simplifySne},
+			{{TSgtInst}, &Peephole::simplifySgt},
+			{{TSgeInst}, &Peephole::simplifySge},
+			{{TSltiInst}, &Peephole::simplifySlti},
+			{{TSleInst}, &Peephole::simplifySle},
+			{{TLaInst}, &Peephole::simplifyLa},
+
+			// memory accesses to the same address
+			{{TSwInst, TLwInst}, &Peephole::forwardStore},
+			{{TLwInst, TSwInst}, &Peephole::removeStoreBack},
+			{{TSwInst, TSwInst}, &Peephole::removeOverwrittenStore},
+
+			// address arithmetic
+			{{TLaInst, TSllInst, TAdduInst, TLwInst}, &Peephole::foldIndexedOffset},
+			{{TLaInst, TSllInst, TAdduInst, TSwInst}, &Peephole::foldIndexedOffset},
+			{{TLaInst, TAdduInst, TLwInst}, &Peephole::foldIndexedOffset},
+			{{TLaInst, TAdduInst, TSwInst}, &Peephole::foldIndexedOffset},
+			{{TLaInst, TLwInst}, &Peephole::foldOffset},
+			{{TLaInst, TSwInst}, &Peephole::foldOffset},
+			{{TAddiuInst, TLwInst}, &Peephole::foldOffset},
+			{{TAddiuInst, TSwInst}, &Peephole::foldOffset},
+			{{TAddiuInst, TAddiuInst}, &Peephole::foldAddiuChain},
+
+			// moves
+			{{TAddInst, TAddInst}, &Peephole::removeMoveBack},
+
+			// constants, loaded by li or by add $reg, $zero, immediate
+			{{TLiInst, TAdduInst}, &Peephole::foldConstant},
+			{{TLiInst, TAddInst}, &Peephole::foldConstant},
+			{{TLiInst, TSubuInst}, &Peephole::foldConstant},
+			{{TLiInst, TSltInst}, &Peephole::foldConstant},
+			{{TLiInst, TSllInst}, &Peephole::foldConstant},
+			{{TAddInst, TAdduInst}, &Peephole::foldConstant},
+			{{TAddInst, TAddInst}, &Peephole::foldConstant},
+			{{TAddInst, TSubuInst}, &Peephole::foldConstant},
+			{{TAddInst, TSltInst}, &Peephole::foldConstant},
+			{{TAddInst, TSllInst}, &Peephole::foldConstant},
+			{{TAddInst, TSwInst}, &Peephole::foldConstant},
+
+			// definitions overwritten by the next instruction
+			{{TAnyInst, TAnyInst}, &Peephole::removeOverwritten},
+		};
+	}
+
 	bool is16Bits(int value) {
 		return -32768 <= value && value < 32768;
 	}
 
-	void visitMBasicBlock(MBasicBlock *node) {
-		for (MInst *inst : node->insts) {
-			inst->accept(*this);
+	bool isImmediate(Register *reg) {
+		return reg->type == RImmediate;
+	}
+
+	bool isReg(Register *reg) {
+		return reg->type != RImmediate && reg->type != RLabel;
+	}
+
+	// checks if inst loads a constant into its destination
+	bool isConstant(MInst *inst) {
+		if (inst->instType() == TLiInst) {
+			return isImmediate((*inst)[1]);
 		}
+		return inst->instType() == TAddInst && (*inst)[1] == ZERO && isImmediate((*inst)[2]);
 	}
 
-	void visitMFunction(MFunction *node) {
-		curFunc = node;
-		for (MBasicBlock *block : node->blocks) {
-			block->accept(*this);
+	bool isMove(MInst *inst) {
+		return inst->instType() == TAddInst && (*inst)[1] == ZERO && isReg((*inst)[2]);
+	}
+
+	// the two operand div reads both of its operands
+	bool hasDef(MInst *inst) {
+		return !inst->noDef && inst->instType() != TExDivInst;
+	}
+
+	bool defines(MInst *inst, Register *reg) {
+		return hasDef(inst) && *(*inst)[0] == *reg;
+	}
+
+	bool reads(MInst *inst, Register *reg) {
+		for (int i = hasDef(inst) ? 1 : 0; i < inst->operands.size(); i++) {
+			if (isReg((*inst)[i]) && *(*inst)[i] == *reg) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool sameAddress(MInst *a, MInst *b) {
+		return (*a)[1]->immediate == (*b)[1]->immediate && *(*a)[2] == *(*b)[2];
+	}
+
+	MInst *prevInst(MInst *inst) {
+		if (inst->__ll_prev == inst->block->insts.head) {
+			return nullptr;
 		}
+		return (MInst *)inst->__ll_prev;
 	}
 
-	void visitAddInst(AddInst *node) {
+	MInst *nextInst(MInst *inst) {
+		if (inst->__ll_next == inst->block->insts.tail) {
+			return nullptr;
+		}
+		return (MInst *)inst->__ll_next;
+	}
+
+	// checks if the value of reg defined before inst is dead after inst
+	bool deadAfter(MInst *inst, Register *reg) {
+		if (reg->type == RVirtual) {
+			return useCnt[reg] == 0;
+		}
+		for (MInst *cur = nextInst(inst); cur != nullptr; cur = nextInst(cur)) {
+			if (reads(cur, reg)) {
+				return false;
+			}
+			if (defines(cur, reg)) {
+				return true;
+			}
+			if (cur->terminate || cur->instType() == TJalInst || cur->instType() == TSysCallInst) {
+				return false;
+			}
+		}
+		return false;
+	}
+
+
+	// rewriting helpers, keeping the use counts and the worklist up to date
+
+	void push(MInst *inst) {
+		if (inst != nullptr && queued.count(inst) == 0) {
+			queued.insert(inst);
+			worklist.emplace_back(inst);
+		}
+	}
+
+	// every window containing inst starts at most maxWindow - 1 instructions before it
+	void touch(MInst *inst) {
+		push(nextInst(inst));
+		for (int i = 0; i < maxWindow && inst != nullptr; i++) {
+			push(inst);
+			inst = prevInst(inst);
+		}
+	}
+
+	void count(MInst *inst, int delta) {
+		for (int i = hasDef(inst) ? 1 : 0; i < inst->operands.size(); i++) {
+			if ((*inst)[i]->type == RVirtual) {
+				useCnt[(*inst)[i]] += delta;
+			}
+		}
+	}
+
+	void remove(MInst *inst) {
+		touch(inst);
+		count(inst, -1);
+		removed.insert(inst);
+		inst->remove();
+		module->changed = true;
+	}
+
+	void replace(MInst *inst, MInst *with) {
+		count(inst, -1);
+		count(with, 1);
+		removed.insert(inst);
+		inst->replaceWith(with);
+		touch(with);
+		module->changed = true;
+	}
+
+	void insertBefore(MInst *pos, MInst *inst) {
+		count(inst, 1);
+		pos->insertBefore(inst);
+		touch(inst);
+		module->changed = true;
+	}
+
+	void setOperand(MInst *inst, int index, Register *reg) {
+		count(inst, -1);
+		inst->setOperand(index, reg);
+		count(inst, 1);
+		touch(inst);
+		module->changed = true;
+	}
+
+	bool removeIfDead(MInst *inst) {
+		if (removed.count(inst) || !hasDef(inst) || !deadAfter(inst, (*inst)[0])) {
+			return false;
+		}
+		remove(inst);
+		return true;
+	}
+
+	// replaces the conditional branches on dest in the function
+	template <typename F>
+	bool replaceBranches(Register *dest, F makeBranch) {
+		bool changed = false;
+		for (MBasicBlock *block : curFunc->blocks) {
+			for (auto it = block->insts.rbegin(); it != block->insts.rend(); --it) {
+				MInst *inst = *it;
+				if (!inst->terminate) {
+					break;
+				}
+				MInst *branch = makeBranch(inst);
+				if (branch != nullptr) {
+					replace(inst, branch);
+					changed = true;
+				}
+			}
+		}
+		return changed;
+	}
+
+	bool isBeqZero(MInst *inst, Register *dest) {
+		return inst->instType() == TBeqInst
+			&& dest == (*inst)[0]
+			&& (*inst)[1] == ZERO;
+	}
+
+
+	// single instructions
+
+	bool simplifyAdd(const vector <MInst *> &window) {
+		MInst *node = window[0];
 		// add $same, $same, $zero
 		// -> remove
 		if ((*node)[0] == (*node)[1] && (*node)[2] == ZERO) {
-			node->remove();
-			module->changed = true;
-			return;
+			remove(node);
+			return true;
+		}
+
+		// add $same, $zero, $same
+		// -> remove
+		if (isMove(node) && *(*node)[0] == *(*node)[2]) {
+			remove(node);
+			return true;
 		}
 
 		// add $same, $same, 0
@@ -56,28 +309,27 @@ public:
 		if ((*node)[0] == (*node)[1]
 			&& (*node)[2]->type == RImmediate
 			&& (*node)[2]->immediate == 0) {
-			node->remove();
-			module->changed = true;
-			return;
+			remove(node);
+			return true;
 		}
+		return false;
 	}
 
-	void visitAdduInst(AdduInst *node) {
+	bool simplifyAddu(const vector <MInst *> &window) {
+		MInst *node = window[0];
 		// addu $same, $same, $zero
 		// -> remove
 		if ((*node)[0] == (*node)[1] && (*node)[2] == ZERO) {
-			node->remove();
-			module->changed = true;
-			return;
+			remove(node);
+			return true;
 		}
 
 		// addu $reg, $reg, 0
 		// -> addu $reg, $reg, $zero
 		if ((*node)[2]->type == RImmediate
 			&& (*node)[2]->immediate == 0) {
-			node->operands[2] = ZERO;
-			module->changed = true;
-			return;
+			setOperand(node, 2, ZERO);
+			return true;
 		}
 
 		// addu $reg, $reg, immediate
@@ -85,195 +337,149 @@ public:
 		if ((*node)[0]->type != RVirtual
 			&& (*node)[1]->type != RVirtual
 			&& (*node)[2]->type == RImmediate) {
-			node->replaceWith(new AddiuInst((*node)[0], (*node)[1], (*node)[2]));
-			module->changed = true;
-			return;
+			replace(node, new AddiuInst((*node)[0], (*node)[1], (*node)[2]));
+			return true;
 		}
+		return false;
 	}
 
-	void visitSubInst(SubInst *node) {
+	bool simplifySub(const vector <MInst *> &window) {
+		MInst *node = window[0];
 		// sub $same, $same, $zero
-		// -> remove
-		if ((*node)[0] == (*node)[1] && (*node)[2] == ZERO) {
-			node->remove();
-			module->changed = true;
-			return;
-		}
-	}
-
-	void visitSubuInst(SubuInst *node) {
 		// subu $same, $same, $zero
 		// -> remove
 		if ((*node)[0] == (*node)[1] && (*node)[2] == ZERO) {
-			node->remove();
-			module->changed = true;
-			return;
+			remove(node);
+			return true;
 		}
+		return false;
 	}
 
-	void visitSeqInst(SeqInst *node) {
+	bool simplifySeq(const vector <MInst *> &window) {
+		MInst *node = window[0];
 		// seq $virtual, $op1, $op2
 		// beq $virtual, $zero, target
 		// -> bne $op1, $op2, target
 		if ((*node)[0]->type != RVirtual) {
-			return;
+			return false;
 		}
-		for (MBasicBlock *block : curFunc->blocks) {
-			for (auto it = block->insts.rbegin(); it != block->insts.rend(); --it) {
-				MInst *inst = *it;
-				if (!inst->terminate) {
-					break;
-				}
-				if (inst->instType() == TBeqInst
-					&& (*node)[0] == (*inst)[0]
-					&& (*inst)[1] == ZERO) {
-					inst->replaceWith(new BneInst((*node)[1], (*node)[2], (*inst)[2]));
-					module->changed = true;
-				}
+		return replaceBranches((*node)[0], [&](MInst *inst) -> MInst * {
+			if (isBeqZero(inst, (*node)[0])) {
+				return new BneInst((*node)[1], (*node)[2], (*inst)[2]);
 			}
-		}
+			return nullptr;
+		});
 	}
 
-	void visitSneInst(SneInst *node) {
+	bool simplifySne(const vector <MInst *> &window) {
+		MInst *node = window[0];
 		// sne $virtual, $op1, $op2
 		// beq $virtual, $zero, target
 		// -> beq $op1, $op2, target
 		if ((*node)[0]->type != RVirtual) {
-			return;
+			return false;
 		}
-		for (MBasicBlock *block : curFunc->blocks) {
-			for (auto it = block->insts.rbegin(); it != block->insts.rend(); --it) {
-				MInst *inst = *it;
-				if (!inst->terminate) {
-					break;
-				}
-				if (inst->instType() == TBeqInst
-					&& (*node)[0] == (*inst)[0]
-					&& (*inst)[1] == ZERO) {
-					inst->replaceWith(new BeqInst((*node)[1], (*node)[2], (*inst)[2]));
-					module->changed = true;
-				}
+		return replaceBranches((*node)[0], [&](MInst *inst) -> MInst * {
+			if (isBeqZero(inst, (*node)[0])) {
+				return new BeqInst((*node)[1], (*node)[2], (*inst)[2]);
 			}
-		}
+			return nullptr;
+		});
 	}
 
-	void visitSgtInst(SgtInst *node) {
+	bool isZero(Register *reg) {
+		return (reg->type == RImmediate && reg->immediate == 0) || reg == ZERO;
+	}
+
+	bool simplifySgt(const vector <MInst *> &window) {
+		MInst *node = window[0];
+		bool changed = false;
 		// sgt $virtual, $op, 0
 		// beq $virtual, $zero, target
 		// -> blez $op, target
 		if ((*node)[0]->type != RVirtual) {
-			return;
-		}
-		if (((*node)[2]->type == RImmediate && (*node)[2]->immediate == 0)
-			|| (*node)[2] == ZERO) {
-			for (MBasicBlock *block : curFunc->blocks) {
-				for (auto it = block->insts.rbegin(); it != block->insts.rend(); --it) {
-					MInst *inst = *it;
-					if (!inst->terminate) {
-						break;
-					}
-					if (inst->instType() == TBeqInst
-						&& (*node)[0] == (*inst)[0]
-						&& (*inst)[1] == ZERO) {
-						inst->replaceWith(new BlezInst((*node)[1], (*inst)[2]));
-						module->changed = true;
-					}
+			return false;
+		}
+		if (isZero((*node)[2])) {
+			changed = replaceBranches((*node)[0], [&](MInst *inst) -> MInst * {
+				if (isBeqZero(inst, (*node)[0])) {
+					return new BlezInst((*node)[1], (*inst)[2]);
 				}
-			}
+				return nullptr;
+			});
 		}
 
 		// sgt $virtual, $op1, $op2
 		// -> slt $virtual, $op2, $op1
 		if ((*node)[2]->type == RVirtual) {
-			node->replaceWith(new SltInst((*node)[0], (*node)[2], (*node)[1]));
-			module->changed = true;
-			return;
+			replace(node, new SltInst((*node)[0], (*node)[2], (*node)[1]));
+			return true;
 		}
+		return changed;
 	}
 
-	void visitSgeInst(SgeInst *node) {
+	bool simplifySge(const vector <MInst *> &window) {
+		MInst *node = window[0];
+		bool changed = false;
 		// sge $virtual, $op, 0
 		// beq $virtual, $zero, target
 		// -> bltz $op, target
 		if ((*node)[0]->type != RVirtual) {
-			return;
-		}
-		if (((*node)[2]->type == RImmediate && (*node)[2]->immediate == 0)
-			|| (*node)[2] == ZERO) {
-			for (MBasicBlock *block : curFunc->blocks) {
-				for (auto it = block->insts.rbegin(); it != block->insts.rend(); --it) {
-					MInst *inst = *it;
-					if (!inst->terminate) {
-						break;
-					}
-					if (inst->instType() == TBeqInst
-						&& (*node)[0] == (*inst)[0]
-						&& (*inst)[1] == ZERO) {
-						inst->replaceWith(new BltzInst((*node)[1], (*inst)[2]));
-						module->changed = true;
-					}
+			return false;
+		}
+		if (isZero((*node)[2])) {
+			changed = replaceBranches((*node)[0], [&](MInst *inst) -> MInst * {
+				if (isBeqZero(inst, (*node)[0])) {
+					return new BltzInst((*node)[1], (*inst)[2]);
 				}
-			}
+				return nullptr;
+			});
 		}
 
 		// sge $virtual, $op1, $op2
 		// -> sle $virtual, $op2, $op1
 		if ((*node)[2]->type == RVirtual) {
-			node->replaceWith(new SleInst((*node)[0], (*node)[2], (*node)[1]));
-			module->changed = true;
-			return;
+			replace(node, new SleInst((*node)[0], (*node)[2], (*node)[1]));
+			return true;
 		}
+		return changed;
 	}
 
-	void visitSltiInst(SltiInst *node) {
+	bool simplifySlti(const vector <MInst *> &window) {
+		MInst *node = window[0];
 		// slti $virtual, $op, 0
 		// beq $virtual, $zero, target
 		// -> bgez $op, target
 		if ((*node)[0]->type != RVirtual) {
-			return;
-		}
-		if (((*node)[2]->type == RImmediate && (*node)[2]->immediate == 0)
-			|| (*node)[2] == ZERO) {
-			for (MBasicBlock *block : curFunc->blocks) {
-				for (auto it = block->insts.rbegin(); it != block->insts.rend(); --it) {
-					MInst *inst = *it;
-					if (!inst->terminate) {
-						break;
-					}
-					if (inst->instType() == TBeqInst
-						&& (*node)[0] == (*inst)[0]
-						&& (*inst)[1] == ZERO) {
-						inst->replaceWith(new BgezInst((*node)[1], (*inst)[2]));
-						module->changed = true;
-					}
+			return false;
+		}
+		if (isZero((*node)[2])) {
+			return replaceBranches((*node)[0], [&](MInst *inst) -> MInst * {
+				if (isBeqZero(inst, (*node)[0])) {
+					return new BgezInst((*node)[1], (*inst)[2]);
 				}
-			}
+				return nullptr;
+			});
 		}
+		return false;
 	}
 
-	void visitSleInst(SleInst *node) {
+	bool simplifySle(const vector <MInst *> &window) {
+		MInst *node = window[0];
+		bool changed = false;
 		// sle $virtual, $op, 0
 		// beq $virtual, $zero, target
 		// -> bgtz $op, target
 		if ((*node)[0]->type != RVirtual) {
-			return;
-		}
-		if (((*node)[2]->type == RImmediate && (*node)[2]->immediate == 0)
-			|| (*node)[2] == ZERO) {
-			for (MBasicBlock *block : curFunc->blocks) {
-				for (auto it = block->insts.rbegin(); it != block->insts.rend(); --it) {
-					MInst *inst = *it;
-					if (!inst->terminate) {
-						break;
-					}
-					if (inst->instType() == TBeqInst
-						&& (*node)[0] == (*inst)[0]
-						&& (*inst)[1] == ZERO) {
-						inst->replaceWith(new BgtzInst((*node)[1], (*inst)[2]));
-						module->changed = true;
-					}
+			return false;
+		}
+		if (isZero((*node)[2])) {
+			changed = replaceBranches((*node)[0], [&](MInst *inst) -> MInst * {
+				if (isBeqZero(inst, (*node)[0])) {
+					return new BgtzInst((*node)[1], (*inst)[2]);
 				}
-			}
+				return nullptr;
+			});
 		}
 
 		// sle $virtual, $op1, $op2
@@ -284,38 +490,30 @@ public:
 		if ((*node)[2]->type == RVirtual) {
 			Register *dest = (*node)[0];
 			Register *sltDest = new Register();
-			node->insertAfter(new XoriInst(dest, sltDest, new Register(1)));
-			node->replaceWith(new SltInst(sltDest, (*node)[2], (*node)[1]));
-			module->changed = true;
-			for (MBasicBlock *block : curFunc->blocks) {
-				for (auto it = block->insts.rbegin(); it != block->insts.rend(); --it) {
-					MInst *inst = *it;
-					if (!inst->terminate) {
-						break;
-					}
-					if (inst->instType() == TBeqInst
-						&& (*inst)[0] == dest
-						&& (*inst)[1] == ZERO) {
-						inst->replaceWith(new BneInst(sltDest, ZERO, (*inst)[2]));
-						module->changed = true;
-					} else if (inst->instType() == TBneInst
-						&& (*inst)[0] == dest
-						&& (*inst)[1] == ZERO) {
-						inst->replaceWith(new BeqInst(sltDest, ZERO, (*inst)[2]));
-						module->changed = true;
-					}
+			MInst *xori = new XoriInst(dest, sltDest, new Register(1));
+			count(xori, 1);
+			node->insertAfter(xori);
+			replace(node, new SltInst(sltDest, (*node)[2], (*node)[1]));
+			replaceBranches(dest, [&](MInst *inst) -> MInst * {
+				if (isBeqZero(inst, dest)) {
+					return new BneInst(sltDest, ZERO, (*inst)[2]);
 				}
-			}
-			return;
+				if (inst->instType() == TBneInst
+					&& (*inst)[0] == dest
+					&& (*inst)[1] == ZERO) {
+					return new BeqInst(sltDest, ZERO, (*inst)[2]);
+				}
+				return nullptr;
+			});
+			return true;
 		}
 
 		// sle $virtual, $op, 2147483647
 		// -> addiu $virtual, $zero, 1
 		if ((*node)[2]->type == RImmediate
 			&& (*node)[2]->immediate == 2147483647) {
-			node->replaceWith(new AddiuInst((*node)[0], ZERO, new Register(1)));
-			module->changed = true;
-			return;
+			replace(node, new AddiuInst((*node)[0], ZERO, new Register(1)));
+			return true;
 		}
 
 		// sle $virtual, $op, immediate
@@ -328,23 +526,325 @@ public:
 			Register *reg = new Register(immediate);
 			if (!is16Bits(immediate)) {
 				Register *liDest = new Register();
-				node->insertBefore(new LiInst(liDest, reg));
-				node->replaceWith(new SltInst((*node)[0], (*node)[1], liDest));
+				insertBefore(node, new LiInst(liDest, reg));
+				replace(node, new SltInst((*node)[0], (*node)[1], liDest));
 			} else {
-				node->replaceWith(new SltiInst((*node)[0], (*node)[1], reg));
+				replace(node, new SltiInst((*node)[0], (*node)[1], reg));
 			}
-			module->changed = true;
-			return;
+			return true;
 		}
+		return changed;
 	}
 
-	void visitLaInst(LaInst *node) {
+	bool simplifyLa(const vector <MInst *> &window) {
+		MInst *node = window[0];
 		// la $dest, immediate($virtual)
 		// -> addiu $dest, $virtual, immediate
 		if ((*node)[1]->type == RImmediate && (*node)[2]->type == RVirtual) {
-			node->replaceWith(new AddiuInst((*node)[0], (*node)[2], (*node)[1]));
-			module->changed = true;
-			return;
+			replace(node, new AddiuInst((*node)[0], (*node)[2], (*node)[1]));
+			return true;
+		}
+		return false;
+	}
+
+
+	// memory accesses to the same address
+
+	bool forwardStore(const vector <MInst *> &window) {
+		MInst *store = window[0], *load = window[1];
+		// sw $op, address
+		// lw $dest, address
+		// -> sw $op, address
+		//    move $dest, $op
+		if (!sameAddress(store, load)) {
+			return false;
+		}
+		if (*(*load)[0] == *(*store)[0]) {
+			remove(load);
+		} else {
+			replace(load, new AddInst((*load)[0], ZERO, (*store)[0]));
+		}
+		return true;
+	}
+
+	bool removeStoreBack(const vector <MInst *> &window) {
+		MInst *load = window[0], *store = window[1];
+		// lw $op, address
+		// sw $op, address
+		// -> lw $op, address
+		if (!sameAddress(load, store)
+			|| !(*(*load)[0] == *(*store)[0])
+			|| *(*load)[0] == *(*load)[2]) {
+			return false;
+		}
+		remove(store);
+		return true;
+	}
+
+	bool removeOverwrittenStore(const vector <MInst *> &window) {
+		// sw $op1, address
+		// sw $op2, address
+		// -> sw $op2, address
+		if (!sameAddress(window[0], window[1])) {
+			return false;
+		}
+		remove(window[0]);
+		return true;
+	}
+
+
+	// address arithmetic
+
+	bool foldOffset(const vector <MInst *> &window) {
+		MInst *def = window[0], *mem = window[1];
+		// la $reg, offset1($base)
+		// lw $dest, offset2($reg)
+		// -> lw $dest, (offset1 + offset2)($base)
+		// same for addiu and for sw
+		Register *reg = (*def)[0];
+		Register *base = def->instType() == TLaInst ? (*def)[2] : (*def)[1];
+		Register *offset = def->instType() == TLaInst ? (*def)[1] : (*def)[2];
+		if (!isImmediate(offset) || !isReg((*mem)[2]) || !(*(*mem)[2] == *reg)) {
+			return false;
+		}
+		if (isReg(base) && *base == *reg) {
+			return false;
+		}
+		int immediate = offset->immediate + (*mem)[1]->immediate;
+		if (base->type != RLabel && !is16Bits(immediate)) {
+			return false;
+		}
+		// an access to a label takes two instructions, only worth it if $reg dies
+		if (base->type == RLabel) {
+			if (reg->type == RVirtual ? useCnt[reg] != 1 : !deadAfter(mem, reg) && !defines(mem, reg)) {
+				return false;
+			}
+			if (mem->instType() == TSwInst && *(*mem)[0] == *reg) {
+				return false;
+			}
+		}
+		setOperand(mem, 1, new Register(immediate));
+		setOperand(mem, 2, base);
+		removeIfDead(def);
+		return true;
+	}
+
+	bool foldIndexedOffset(const vector <MInst *> &window) {
+		MInst *la = window[0], *addu = window[window.size() - 2], *mem = window.back();
+		// la $reg, offset1($base)
+		// sll $index, $op, shift
+		// addu $addr, $reg, $index
+		// lw $dest, offset2($addr)
+		// -> sll $index, $op, shift
+		//    addu $addr, $base, $index
+		//    lw $dest, (offset1 + offset2)($addr)
+		// same for sw and without sll, $addr must have no other use
+		//
+		// $fp is kept in la, remove fp only rewrites it in la, lw and sw
+		Register *reg = (*la)[0], *base = (*la)[2], *addr = (*addu)[0];
+		if (!isReg(base) || base == FP || *base == *reg || !isImmediate((*la)[1])) {
+			return false;
+		}
+		if (window.size() == 4 && (defines(window[1], reg) || defines(window[1], base))) {
+			return false;
+		}
+		int regIndex = 1;
+		if (!(*(*addu)[1] == *reg)) {
+			regIndex = 2;
+		}
+		Register *index = (*addu)[3 - regIndex];
+		if (!(*(*addu)[regIndex] == *reg) || !isReg(index) || *index == *reg) {
+			return false;
+		}
+		if (!isReg((*mem)[2]) || !(*(*mem)[2] == *addr) || *addr == *base) {
+			return false;
+		}
+		int immediate = (*la)[1]->immediate + (*mem)[1]->immediate;
+		if (!is16Bits(immediate)) {
+			return false;
+		}
+		if (addr->type == RVirtual) {
+			if (useCnt[addr] != 1) {
+				return false;
+			}
+		} else if (mem->instType() == TSwInst) {
+			if (*(*mem)[0] == *addr || !deadAfter(mem, addr)) {
+				return false;
+			}
+		} else if (!(*(*mem)[0] == *addr) && !deadAfter(mem, addr)) {
+			return false;
+		}
+		setOperand(addu, regIndex, base);
+		setOperand(mem, 1, new Register(immediate));
+		removeIfDead(la);
+		return true;
+	}
+
+	bool foldAddiuChain(const vector <MInst *> &window) {
+		MInst *first = window[0], *second = window[1];
+		// addiu $reg, $op, immediate1
+		// addiu $dest, $reg, immediate2
+		// -> addiu $dest, $op, (immediate1 + immediate2)
+		Register *reg = (*first)[0], *op = (*first)[1];
+		if (!isImmediate((*first)[2]) || !isImmediate((*second)[2])) {
+			return false;
+		}
+		if (!(*(*second)[1] == *reg) || *op == *reg) {
+			return false;
+		}
+		int immediate = (*first)[2]->immediate + (*second)[2]->immediate;
+		if (!is16Bits(immediate)) {
+			return false;
+		}
+		replace(second, new AddiuInst((*second)[0], op, new Register(immediate)));
+		removeIfDead(first);
+		return true;
+	}
+
+
+	// constants
+
+	bool foldConstant(const vector <MInst *> &window) {
+		MInst *li = window[0], *node = window[1];
+		// li $reg, immediate
+		// addu $dest, $op, $reg
+		// -> addu $dest, $op, immediate
+		// similarly subu and slt take the immediate as the second operand,
+		// sll of a constant is computed and a stored zero is taken from $zero
+		Register *reg = (*li)[0];
+		if (!isConstant(li) || *reg == *ZERO) {
+			return false;
+		}
+		int immediate = li->operands.back()->immediate;
+		Type type = node->instType();
+		Register *op1 = (*node)[1], *op2 = (*node)[2];
+		if (type == TSwInst) {
+			// sw $reg, address
+			// -> sw $zero, address
+			if (immediate != 0 || !(*(*node)[0] == *reg)) {
+				return false;
+			}
+			setOperand(node, 0, ZERO);
+			removeIfDead(li);
+			return true;
+		}
+		if (type == TSllInst) {
+			// sll $dest, $reg, shift
+			// -> li $dest, (immediate << shift)
+			if (!(*op1 == *reg) || !isImmediate(op2)) {
+				return false;
+			}
+			replace(node, new LiInst((*node)[0], new Register((int)((unsigned)immediate << (op2->immediate & 31)))));
+			removeIfDead(li);
+			return true;
+		}
+		if (!isReg(op2)) {
+			return false;
+		}
+		if ((type == TAdduInst || type == TAddInst) && *op1 == *reg) {
+			swap(op1, op2);
+		}
+		if (!(*op2 == *reg) || *op1 == *reg) {
+			return false;
+		}
+		if (type == TSubuInst) {
+			if (immediate == INT_MIN || !is16Bits(-immediate)) {
+				return false;
+			}
+			replace(node, new AdduInst((*node)[0], op1, new Register(-immediate)));
+		} else if (type == TSltInst) {
+			if (!is16Bits(immediate)) {
+				return false;
+			}
+			replace(node, new SltiInst((*node)[0], op1, new Register(immediate)));
+		} else {
+			if (!is16Bits(immediate)) {
+				return false;
+			}
+			replace(node, new AdduInst((*node)[0], op1, new Register(immediate)));
+		}
+		removeIfDead(li);
+		return true;
+	}
+
+
+	// moves
+
+	bool removeMoveBack(const vector <MInst *> &window) {
+		MInst *first = window[0], *second = window[1];
+		// move $op1, $op2
+		// move $op2, $op1
+		// -> move $op1, $op2
+		if (!isMove(first) || !isMove(second)) {
+			return false;
+		}
+		if (*(*first)[0] == *(*second)[2] && *(*first)[2] == *(*second)[0]) {
+			remove(second);
+			return true;
+		}
+		return false;
+	}
+
+
+	// definitions overwritten by the next instruction
+
+	bool removeOverwritten(const vector <MInst *> &window) {
+		MInst *first = window[0], *second = window[1];
+		// op1 $reg, ...
+		// op2 $reg, ... (not reading $reg)
+		// -> op2 $reg, ...
+		if (!hasDef(first) || first->terminate || (*first)[0] == ZERO) {
+			return false;
+		}
+		Register *reg = (*first)[0];
+		if (!defines(second, reg) || reads(second, reg)) {
+			return false;
+		}
+		remove(first);
+		return true;
+	}
+
+
+	bool match(MInst *inst, const Rule &rule) {
+		vector <MInst *> window;
+		for (MInst *cur = inst; window.size() < rule.pattern.size(); cur = nextInst(cur)) {
+			if (cur == nullptr) {
+				return false;
+			}
+			const Type &type = rule.pattern[window.size()];
+			if (type != TAnyInst && cur->instType() != type) {
+				return false;
+			}
+			window.emplace_back(cur);
+		}
+		return (this->*rule.rewrite)(window);
+	}
+
+	void visitMFunction(MFunction *node) {
+		curFunc = node;
+		useCnt.clear();
+		removed.clear();
+		queued.clear();
+		worklist.clear();
+		for (MBasicBlock *block : node->blocks) {
+			for (MInst *inst : block->insts) {
+				inst->block = block;
+				count(inst, 1);
+				push(inst);
+			}
+		}
+		while (!worklist.empty()) {
+			MInst *inst = worklist.front();
+			worklist.pop_front();
+			queued.erase(inst);
+			if (removed.count(inst)) {
+				continue;
+			}
+			for (const Rule &rule : rules) {
+				if (match(inst, rule)) {
+					break;
+				}
+			}
 		}
 	}
 
@@ -360,4 +860,4 @@ public:
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -1,9 +1,25 @@
+/*
+# phi elimination
+=================
+
+phi operands are first coalesced into congruence classes, a register
+joins the class of a phi when no member of the two classes interferes,
+where two registers interfere if one is live right after the definition
+of the other and they hold different values, i.e. one is not a copy of
+the other
+each class is renamed to a single register, the remaining phi operands
+are lowered to parallel copies on the incoming edges and sequentialized
+*/
+
 #ifndef __CPL_PHI_ELIMINATION_H__
 #define __CPL_PHI_ELIMINATION_H__
 
 #include <map>
+#include <vector>
+#include <algorithm>
 
 #include "../mips.h"
+#include "../bitmask.h"
 
 
 namespace MIPS {
@@ -12,6 +28,7 @@ namespace Passes {
 
 using namespace std;
 using namespace MIPS;
+using namespace Bits;
 
 
 class PhiElimination : public Pass {
@@ -24,53 +41,347 @@ public:
 	map <int, vector <int>> outEdge;
 
 	void addEdge(int from, int to) {
+		if (find(outEdge[from].begin(), outEdge[from].end(), to) != outEdge[from].end()) {
+			return;
+		}
 		inEdge[to].emplace_back(from);
 		outEdge[from].emplace_back(to);
 	}
 
-	void splitCriticalEdge(MBasicBlock *node) {
-		if (node->insts.first()->instType() != TPhiInst) {
+	// registers appearing in phis, the only candidates for coalescing
+	map <int, int> phiRegIndex;
+	vector <Register *> phiRegs;
+	vector <int> defCount;
+	vector <MInst *> defInst;
+	vector <Bitmask> liveAfter;
+	vector <int> valueOf;
+	vector <int> congruence;
+
+	int getPhiReg(Register *reg) {
+		if (reg->type != RVirtual) {
+			return -1;
+		}
+		auto it = phiRegIndex.find(reg->value->id);
+		if (it != phiRegIndex.end()) {
+			return it->second;
+		}
+		return -1;
+	}
+
+	void addPhiReg(Register *reg) {
+		if (reg->type != RVirtual || phiRegIndex.count(reg->value->id)) {
 			return;
 		}
-		int nodeId = node->id;
-		for (int id : inEdge[nodeId]) {
-			MBasicBlock *jump = curFunc->allocBasicBlock();
-			jump->label = new Register(curFunc->name.substr(1) + "_jump_" + to_string(id) + "_" + to_string(nodeId));
-			MBasicBlock *from = id2block[id];
-			jump->loopDepth = from->loopDepth;
-			auto it = from->insts.rbegin();
-			while (it != from->insts.rend()) {
+		phiRegIndex[reg->value->id] = phiRegs.size();
+		phiRegs.emplace_back(reg);
+	}
+
+	int getValue(int index) {
+		if (valueOf[index] >= 0) {
+			return valueOf[index];
+		}
+		valueOf[index] = index;
+		MInst *inst = defInst[index];
+		// a copy of a single definition register holds the same value
+		if (defCount[index] == 1 && inst && inst->instType() == TAddInst
+			&& inst->operands[1] == ZERO && inst->operands[2]->type == RVirtual) {
+			int src = getPhiReg(inst->operands[2]);
+			if (src >= 0 && defCount[src] == 1) {
+				valueOf[index] = getValue(src);
+			}
+		}
+		return valueOf[index];
+	}
+
+	int getClass(int index) {
+		if (congruence[index] == index) {
+			return index;
+		}
+		congruence[index] = getClass(congruence[index]);
+		return congruence[index];
+	}
+
+	bool interfere(int x, int y) {
+		if (!liveAfter[x].get(y) && !liveAfter[y].get(x)) {
+			return false;
+		}
+		return getValue(x) != getValue(y);
+	}
+
+	bool classInterfere(int u, int v, map <int, vector <int>> &members) {
+		for (int x : members[u]) {
+			for (int y : members[v]) {
+				if (interfere(x, y)) {
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	void analysePhiRegs() {
+		phiRegIndex.clear();
+		phiRegs.clear();
+		for (MBasicBlock *block : curFunc->blocks) {
+			for (MInst *inst : block->insts) {
+				if (inst->instType() != TPhiInst) {
+					break;
+				}
+				addPhiReg(inst->operands[0]);
+				for (int i = 1; i < inst->operands.size(); i += 2) {
+					addPhiReg(inst->operands[i]);
+				}
+			}
+		}
+		int n = phiRegs.size();
+		defCount.assign(n, 0);
+		defInst.assign(n, nullptr);
+		valueOf.assign(n, -1);
+		liveAfter.assign(n, Bitmask(n));
+
+		// liveness restricted to phi registers, a phi uses its operands at the
+		// end of the predecessors and defines its result at the block entry
+		map <int, Bitmask> gen, kill, phiDefs, phiUses, liveIn, liveOut;
+		for (MBasicBlock *block : curFunc->blocks) {
+			int id = block->id;
+			gen[id].resize(n);
+			kill[id].resize(n);
+			phiDefs[id].resize(n);
+			phiUses[id].resize(n);
+			liveIn[id].resize(n);
+			liveOut[id].resize(n);
+		}
+		for (MBasicBlock *block : curFunc->blocks) {
+			int id = block->id;
+			for (MInst *inst : block->insts) {
+				if (inst->instType() == TPhiInst) {
+					int dest = getPhiReg(inst->operands[0]);
+					phiDefs[id].set(dest, 1);
+					defCount[dest]++;
+					defInst[dest] = inst;
+					for (int i = 1; i < inst->operands.size(); i += 2) {
+						int src = getPhiReg(inst->operands[i]);
+						if (src >= 0) {
+							phiUses[label2block[inst->operands[i + 1]->label]->id].set(src, 1);
+						}
+					}
+					continue;
+				}
+				int index = inst->noDef ? 0 : 1;
+				for (int i = index; i < inst->operands.size(); i++) {
+					Register *reg = inst->operands[i];
+					if (reg->type != RVirtual) {
+						continue;
+					}
+					int use = getPhiReg(reg);
+					if (use >= 0 && !kill[id].get(use)) {
+						gen[id].set(use, 1);
+					}
+				}
+				if (!inst->noDef && inst->operands[0]->type == RVirtual) {
+					int def = getPhiReg(inst->operands[0]);
+					if (def >= 0) {
+						kill[id].set(def, 1);
+						defCount[def]++;
+						defInst[def] = inst;
+					}
+				}
+			}
+		}
+		bool changed = true;
+		while (changed) {
+			changed = false;
+			for (auto it = curFunc->blocks.rbegin(); it != curFunc->blocks.rend(); --it) {
+				int id = (*it)->id;
+				Bitmask out = phiUses[id];
+				for (int to : outEdge[id]) {
+					out.bitwiseOr(liveIn[to]);
+				}
+				Bitmask in = out;
+				in.bitwiseDiff(kill[id]);
+				in.bitwiseOr(gen[id]);
+				in.bitwiseDiff(phiDefs[id]);
+				liveOut[id] = out;
+				if (in.bits != liveIn[id].bits) {
+					liveIn[id] = in;
+					changed = true;
+				}
+			}
+		}
+
+		for (MBasicBlock *block : curFunc->blocks) {
+			int id = block->id;
+			Bitmask live = liveOut[id];
+			for (auto it = block->insts.rbegin(); it != block->insts.rend(); --it) {
 				MInst *inst = *it;
-				if (!inst->terminate || inst->instType() == TJrInst) {
+				if (inst->instType() == TPhiInst) {
 					break;
 				}
-				if (inst->instType() == TJInst) {
-					if (inst->operands[0] == node->label) {
-						inst->operands[0] = jump->label;
+				if (!inst->noDef && inst->operands[0]->type == RVirtual) {
+					int def = getPhiReg(inst->operands[0]);
+					if (def >= 0) {
+						liveAfter[def].bitwiseOr(live);
+						live.set(def, 0);
 					}
-				} else {
-					if (inst->operands[2] == node->label) {
-						inst->operands[2] = jump->label;
+				}
+				int index = inst->noDef ? 0 : 1;
+				for (int i = index; i < inst->operands.size(); i++) {
+					Register *reg = inst->operands[i];
+					if (reg->type != RVirtual) {
+						continue;
+					}
+					int use = getPhiReg(reg);
+					if (use >= 0) {
+						live.set(use, 1);
 					}
 				}
-				--it;
 			}
+			// results of the phis are defined together at the block entry
+			for (MInst *inst : block->insts) {
+				if (inst->instType() != TPhiInst) {
+					break;
+				}
+				int dest = getPhiReg(inst->operands[0]);
+				liveAfter[dest].bitwiseOr(live);
+				liveAfter[dest].bitwiseOr(phiDefs[id]);
+				liveAfter[dest].set(dest, 0);
+			}
+		}
+	}
+
+	void coalescePhi() {
+		analysePhiRegs();
+		int n = phiRegs.size();
+		congruence.resize(n);
+		map <int, vector <int>> members;
+		for (int i = 0; i < n; i++) {
+			congruence[i] = i;
+			members[i].emplace_back(i);
+		}
+		// the phis in hotter blocks are coalesced first
+		vector <MBasicBlock *> blocks;
+		for (MBasicBlock *block : curFunc->blocks) {
+			if (block->insts.first()->instType() == TPhiInst) {
+				blocks.emplace_back(block);
+			}
+		}
+		stable_sort(blocks.begin(), blocks.end(), [](MBasicBlock *u, MBasicBlock *v) {
+			return u->freq > v->freq;
+		});
+		for (MBasicBlock *block : blocks) {
+			for (MInst *inst : block->insts) {
+				if (inst->instType() != TPhiInst) {
+					break;
+				}
+				int dest = getPhiReg(inst->operands[0]);
+				for (int i = 1; i < inst->operands.size(); i += 2) {
+					int src = getPhiReg(inst->operands[i]);
+					if (src < 0 || defCount[src] != 1 || defCount[dest] != 1) {
+						continue;
+					}
+					int u = getClass(dest), v = getClass(src);
+					if (u == v || classInterfere(u, v, members)) {
+						continue;
+					}
+					congruence[v] = u;
+					members[u].insert(members[u].end(), members[v].begin(), members[v].end());
+					members.erase(v);
+				}
+			}
+		}
+		for (MBasicBlock *block : curFunc->blocks) {
+			for (MInst *inst : block->insts) {
+				for (int i = 0; i < inst->operands.size(); i++) {
+					Register *reg = inst->operands[i];
+					if (reg->type != RVirtual) {
+						continue;
+					}
+					int index = getPhiReg(reg);
+					if (index >= 0) {
+						inst->operands[i] = phiRegs[getClass(index)];
+					}
+				}
+			}
+		}
+	}
+
+	// the block ends with a single j and nothing else jumps out of it
+	bool endsWithSingleJump(MBasicBlock *block) {
+		MInst *last = block->insts.last();
+		if (last->instType() != TJInst) {
+			return false;
+		}
+		return block->insts.first() == last || !((MInst *)last->__ll_prev)->terminate;
+	}
+
+	void retarget(MBasicBlock *from, Register *oldLabel, Register *newLabel) {
+		auto it = from->insts.rbegin();
+		while (it != from->insts.rend()) {
+			MInst *inst = *it;
+			if (!inst->terminate || inst->instType() == TJrInst) {
+				break;
+			}
+			if (inst->operands.back()->label == oldLabel->label) {
+				inst->operands.back() = newLabel;
+			}
+			--it;
+		}
+	}
+
+	// copies are placed at the end of a single successor predecessor, or at
+	// the start of a single predecessor successor, only a critical edge gets
+	// a new block, it ends with a single j and is weighted by the frequency
+	// of the edge, so that block rearrangement lays it out right before the
+	// phi block and the jump falls through
+	void lowerPhi(MBasicBlock *node) {
+		if (node->insts.first()->instType() != TPhiInst) {
+			return;
+		}
+		int nodeId = node->id;
+		MInst *firstInst = nullptr;
+		for (MInst *inst : node->insts) {
+			if (inst->instType() != TPhiInst) {
+				firstInst = inst;
+				break;
+			}
+		}
+		for (int id : inEdge[nodeId]) {
+			MBasicBlock *from = id2block[id];
+			vector <MInst *> pcopies;
 			for (MInst *inst : node->insts) {
 				if (inst->instType() != TPhiInst) {
 					break;
 				}
 				for (int i = 1; i < inst->operands.size(); i += 2) {
-					if (inst->operands[i + 1] == from->label) {
-						inst->operands[i + 1] = jump->label;
-						MInst *pcopy = new PCopyInst(inst->operands[0], inst->operands[i]);
-						pcopy->block = jump;
-						jump->append(pcopy);
+					if (inst->operands[i + 1]->label == from->label->label) {
+						pcopies.emplace_back(new PCopyInst(inst->operands[0], inst->operands[i]));
 					}
 				}
 			}
+			if (endsWithSingleJump(from)) {
+				for (MInst *pcopy : pcopies) {
+					from->insts.last()->insertBefore(pcopy);
+				}
+				continue;
+			}
+			if (inEdge[nodeId].size() == 1) {
+				for (MInst *pcopy : pcopies) {
+					firstInst->insertBefore(pcopy);
+				}
+				continue;
+			}
+			MBasicBlock *jump = curFunc->allocBasicBlock();
+			jump->label = new Register(curFunc->name.substr(1) + "_jump_" + to_string(id) + "_" + to_string(nodeId));
+			jump->loopDepth = min(from->loopDepth, node->loopDepth);
+			jump->freq = min(from->freq, node->freq);
+			for (MInst *pcopy : pcopies) {
+				pcopy->block = jump;
+				jump->append(pcopy);
+			}
 			MInst *jumpInst = new JInst(node->label);
 			jumpInst->block = jump;
 			jump->append(jumpInst);
+			retarget(from, node->label, jump->label);
 		}
 		for (MInst *inst : node->insts) {
 			if (inst->instType() != TPhiInst) {
@@ -80,50 +391,61 @@ public:
 		}
 	}
 
-	void sequentialize(MBasicBlock *node) {
-		if (node->insts.first()->instType() != TPCopyInst) {
-			return;
-		}
-		MInst *jumpInst = node->insts.last();
+	// replace a run of parallel copies by moves placed before pos
+	void sequentialize(vector <MInst *> pcopies, MInst *pos) {
 		while (true) {
 			map <int, int> useCount;
 			int removalCount = 0;
-			int pcopyCount = 0;
 			MInst *pcopy = nullptr;
-			for (MInst *inst : node->insts) {
-				if (inst->instType() == TPCopyInst) {
-					if (inst->operands[1]->type == RVirtual) {
-						useCount[inst->operands[1]->value->id]++;
-					}
-					if (inst->operands[0] != inst->operands[1]) {
-						pcopyCount++;
-						pcopy = inst;
-					}
+			for (MInst *inst : pcopies) {
+				if (inst->operands[1]->type == RVirtual) {
+					useCount[inst->operands[1]->value->id]++;
+				}
+				if (inst->operands[0] != inst->operands[1]) {
+					pcopy = inst;
 				}
 			}
-			if (pcopyCount == 0) {
+			if (pcopy == nullptr) {
 				break;
 			}
-			for (MInst *inst : node->insts) {
-				if (inst->instType() == TPCopyInst) {
-					if (useCount[inst->operands[0]->value->id] == 0) {
-						jumpInst->insertBefore(new AddInst(inst->operands[0], ZERO, inst->operands[1]));
-						inst->remove();
-						removalCount++;
-					}
+			vector <MInst *> remain;
+			for (MInst *inst : pcopies) {
+				if (useCount[inst->operands[0]->value->id] == 0) {
+					pos->insertBefore(new AddInst(inst->operands[0], ZERO, inst->operands[1]));
+					inst->remove();
+					removalCount++;
+				} else {
+					remain.emplace_back(inst);
 				}
 			}
+			pcopies = remain;
 			if (removalCount > 0) {
 				continue;
 			}
 			Register *reg = new Register();
-			jumpInst->insertBefore(new AddInst(reg, ZERO, pcopy->operands[1]));
+			pos->insertBefore(new AddInst(reg, ZERO, pcopy->operands[1]));
 			pcopy->operands[1] = reg;
 		}
+		for (MInst *inst : pcopies) {
+			inst->remove();
+		}
+	}
+
+	void sequentialize(MBasicBlock *node) {
+		vector <MInst *> pcopies;
+		vector <pair <vector <MInst *>, MInst *>> runs;
 		for (MInst *inst : node->insts) {
 			if (inst->instType() == TPCopyInst) {
-				inst->remove();
+				pcopies.emplace_back(inst);
+				continue;
 			}
+			if (!pcopies.empty()) {
+				runs.emplace_back(make_pair(pcopies, inst));
+				pcopies.clear();
+			}
+		}
+		for (auto &run : runs) {
+			sequentialize(run.first, run.second);
 		}
 	}
 
@@ -157,8 +479,9 @@ public:
 				--it;
 			}
 		}
+		coalescePhi();
 		for (MBasicBlock *block : node->blocks) {
-			splitCriticalEdge(block);
+			lowerPhi(block);
 		}
 		for (MBasicBlock *block : node->blocks) {
 			sequentialize(block);
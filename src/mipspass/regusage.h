@@ -0,0 +1,123 @@
+/*
+# register usage summary
+========================
+
+functions are allocated in bottom-up call graph order, so that when a
+function is allocated the caller-saved registers clobbered by each of its
+callees are already known
+a callee not summarized yet (a recursive call) clobbers all of them while
+allocating, but a self call adds nothing to the summary of the function,
+as everything it writes is already written by the function itself
+*/
+
+#ifndef __CPL_REG_USAGE_H__
+#define __CPL_REG_USAGE_H__
+
+#include <vector>
+#include <map>
+#include <set>
+
+#include "../mips.h"
+
+
+namespace MIPS {
+
+namespace Passes {
+
+using namespace std;
+using namespace MIPS;
+
+
+class RegUsage {
+public:
+	vector <Register *> callerSavedRegs;
+
+	map <string, MFunction *> entry2func;
+	set <MFunction *> visited;
+	vector <MFunction *> order;
+
+	RegUsage() {
+		callerSavedRegs = {T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, A0, A1, A2, A3, V0, V1};
+	}
+
+	MFunction *getCallee(MInst *inst) {
+		auto it = entry2func.find(inst->operands[0]->label);
+		if (it == entry2func.end()) {
+			return nullptr;
+		}
+		return it->second;
+	}
+
+	void dfs(MFunction *func) {
+		visited.insert(func);
+		for (MBasicBlock *block : func->blocks) {
+			for (MInst *inst : block->insts) {
+				if (inst->instType() != TJalInst) {
+					continue;
+				}
+				MFunction *callee = getCallee(inst);
+				if (callee && !visited.count(callee)) {
+					dfs(callee);
+				}
+			}
+		}
+		order.emplace_back(func);
+	}
+
+	// callees come before their callers
+	vector <MFunction *> &bottomUp(MModule *module) {
+		entry2func.clear();
+		visited.clear();
+		order.clear();
+		for (MFunction *func : module->funcs) {
+			func->summarized = false;
+			func->clobberRegs.clear();
+			entry2func[func->blocks.first()->label->label] = func;
+		}
+		for (MFunction *func : module->funcs) {
+			if (!visited.count(func)) {
+				dfs(func);
+			}
+		}
+		return order;
+	}
+
+	set <Register *> clobberedBy(MInst *inst) {
+		MFunction *callee = getCallee(inst);
+		if (callee && callee->summarized) {
+			return callee->clobberRegs;
+		}
+		return set <Register *>(callerSavedRegs.begin(), callerSavedRegs.end());
+	}
+
+	void summarize(MFunction *func) {
+		set <Register *> written;
+		for (MBasicBlock *block : func->blocks) {
+			for (MInst *inst : block->insts) {
+				if (inst->instType() == TJalInst) {
+					if (getCallee(inst) == func) {
+						continue;
+					}
+					for (Register *reg : clobberedBy(inst)) {
+						written.insert(reg);
+					}
+				} else if (!inst->noDef) {
+					written.insert(inst->operands[0]);
+				}
+			}
+		}
+		func->clobberRegs.clear();
+		for (Register *reg : callerSavedRegs) {
+			if (written.count(reg)) {
+				func->clobberRegs.insert(reg);
+			}
+		}
+		func->summarized = true;
+	}
+};
+
+}
+
+}
+
+#endif
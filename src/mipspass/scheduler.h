@@ -0,0 +1,329 @@
+/*
+# list scheduler
+================
+
+this pass reorders the instructions inside each basic block after register
+allocation, so that independent work fills the latency of loads and of
+mult / div before their results are used
+
+a block is cut into regions at calls, syscalls and the terminating jumps,
+which stay in place; each region is scheduled on a dependency graph with
+the latency table below, choosing among the ready instructions the one on
+the longest path to the end of the region and keeping the original order
+on ties
+
+as all the values already live in physical registers, reordering does not
+change the register pressure, only the anti and output dependencies limit
+the freedom of the scheduler
+
+stack slots addressed from the same version of a base register and
+global labels are disambiguated, other memory accesses keep their order
+*/
+
+#ifndef __CPL_SCHEDULER_H__
+#define __CPL_SCHEDULER_H__
+
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "../mips.h"
+
+
+namespace MIPS {
+
+namespace Passes {
+
+using namespace std;
+using namespace MIPS;
+
+
+class Scheduler : public Pass {
+public:
+	MModule *module;
+
+	const int latLoad = 2;
+	const int latMult = 4;
+	const int latDiv = 20;
+
+	// hi and lo are written together, so they share one resource
+	const int hiLo = -1;
+
+	struct Node {
+		MInst *inst;
+		vector <int> defs, uses;
+		// memory access, 0 for none, 1 for load, 2 for store
+		int mem = 0;
+		Register *base = nullptr;
+		int baseVersion = 0;
+		int offset = 0;
+		vector <pair <int, int>> succs;
+		int preds = 0;
+		int earliest = 0;
+		int height = 0;
+	};
+
+	vector <Node> nodes;
+
+
+	int latency(MInst *inst) {
+		Type type = inst->instType();
+		if (type == TLwInst) {
+			return latLoad;
+		}
+		if (type == TMulInst || type == TMultInst) {
+			return latMult;
+		}
+		if (type == TDivInst || type == TRemInst || type == TExDivInst) {
+			return latDiv;
+		}
+		return 1;
+	}
+
+	bool isBarrier(MInst *inst) {
+		Type type = inst->instType();
+		return inst->terminate || type == TJalInst || type == TSysCallInst;
+	}
+
+	bool isReg(Register *reg) {
+		return reg->type != RImmediate && reg->type != RLabel;
+	}
+
+	void addUse(Node &node, Register *reg) {
+		if (isReg(reg) && reg != ZERO) {
+			node.uses.emplace_back(reg->type.id);
+		}
+	}
+
+	Node makeNode(MInst *inst) {
+		Node node;
+		node.inst = inst;
+		Type type = inst->instType();
+		if (type == TMultInst || type == TExDivInst) {
+			addUse(node, (*inst)[0]);
+			addUse(node, (*inst)[1]);
+			node.defs.emplace_back(hiLo);
+			return node;
+		}
+		if (type == TMfhiInst || type == TMfloInst) {
+			node.defs.emplace_back((*inst)[0]->type.id);
+			node.uses.emplace_back(hiLo);
+			return node;
+		}
+		if (type == TLwInst || type == TSwInst || type == TLaInst) {
+			if (type == TSwInst) {
+				addUse(node, (*inst)[0]);
+			} else {
+				node.defs.emplace_back((*inst)[0]->type.id);
+			}
+			addUse(node, (*inst)[2]);
+			if (type != TLaInst) {
+				node.mem = type == TLwInst ? 1 : 2;
+				node.base = (*inst)[2];
+				node.offset = (*inst)[1]->immediate;
+			}
+			return node;
+		}
+		for (int i = inst->noDef ? 0 : 1; i < inst->operands.size(); i++) {
+			addUse(node, (*inst)[i]);
+		}
+		if (!inst->noDef) {
+			node.defs.emplace_back((*inst)[0]->type.id);
+		}
+		// mul sets hi and lo in MARS, div and rem expand to a div
+		if (type == TMulInst || type == TDivInst || type == TRemInst) {
+			node.defs.emplace_back(hiLo);
+		}
+		return node;
+	}
+
+	bool mayAlias(const Node &a, const Node &b) {
+		bool labelA = a.base->type == RLabel, labelB = b.base->type == RLabel;
+		if (labelA && labelB) {
+			return a.base->label == b.base->label;
+		}
+		// globals and the stack never overlap
+		if ((labelA && b.base == SP) || (labelB && a.base == SP)) {
+			return false;
+		}
+		if (!labelA && !labelB && a.base == b.base && a.baseVersion == b.baseVersion) {
+			return a.offset == b.offset;
+		}
+		return true;
+	}
+
+	void addEdge(int from, int to, int lat) {
+		nodes[from].succs.emplace_back(to, lat);
+		nodes[to].preds++;
+	}
+
+	// returns the instructions of the region in the scheduled order
+	vector <MInst *> schedule(const vector <MInst *> &region) {
+		nodes.clear();
+		map <int, int> version;
+		map <int, int> lastDef;
+		map <int, vector <int>> lastUses;
+		vector <int> memOps;
+		for (MInst *inst : region) {
+			int cur = nodes.size();
+			nodes.emplace_back(makeNode(inst));
+			Node &node = nodes.back();
+			if (node.mem && node.base->type != RLabel) {
+				node.baseVersion = version[node.base->type.id];
+			}
+			// read after write
+			for (int reg : node.uses) {
+				if (lastDef.count(reg)) {
+					addEdge(lastDef[reg], cur, latency(nodes[lastDef[reg]].inst));
+				}
+			}
+			for (int reg : node.defs) {
+				// write after read
+				for (int use : lastUses[reg]) {
+					if (use != cur) {
+						addEdge(use, cur, 0);
+					}
+				}
+				// write after write
+				if (lastDef.count(reg)) {
+					addEdge(lastDef[reg], cur, 1);
+				}
+			}
+			if (nodes[cur].mem) {
+				for (int prev : memOps) {
+					if (nodes[prev].mem == 1 && nodes[cur].mem == 1) {
+						continue;
+					}
+					if (mayAlias(nodes[prev], nodes[cur])) {
+						addEdge(prev, cur, nodes[prev].mem == 2 ? 1 : 0);
+					}
+				}
+				memOps.emplace_back(cur);
+			}
+			for (int reg : nodes[cur].uses) {
+				lastUses[reg].emplace_back(cur);
+			}
+			for (int reg : nodes[cur].defs) {
+				lastDef[reg] = cur;
+				lastUses[reg].clear();
+				version[reg]++;
+			}
+		}
+
+		int n = nodes.size();
+		for (int i = n - 1; i >= 0; i--) {
+			nodes[i].height = latency(nodes[i].inst);
+			for (auto &succ : nodes[i].succs) {
+				nodes[i].height = max(nodes[i].height, succ.second + nodes[succ.first].height);
+			}
+		}
+
+		vector <MInst *> order;
+		vector <int> ready;
+		for (int i = 0; i < n; i++) {
+			if (nodes[i].preds == 0) {
+				ready.emplace_back(i);
+			}
+		}
+		int cycle = 0;
+		while (!ready.empty()) {
+			// prefer the instructions that can issue now, then the critical path
+			int best = -1;
+			for (int i : ready) {
+				if (best < 0) {
+					best = i;
+					continue;
+				}
+				bool issueI = nodes[i].earliest <= cycle, issueBest = nodes[best].earliest <= cycle;
+				if (issueI != issueBest) {
+					if (issueI) {
+						best = i;
+					}
+					continue;
+				}
+				if (!issueI && nodes[i].earliest != nodes[best].earliest) {
+					if (nodes[i].earliest < nodes[best].earliest) {
+						best = i;
+					}
+					continue;
+				}
+				if (nodes[i].height != nodes[best].height) {
+					if (nodes[i].height > nodes[best].height) {
+						best = i;
+					}
+					continue;
+				}
+				if (i < best) {
+					best = i;
+				}
+			}
+			ready.erase(find(ready.begin(), ready.end(), best));
+			cycle = max(cycle, nodes[best].earliest) + 1;
+			order.emplace_back(nodes[best].inst);
+			for (auto &succ : nodes[best].succs) {
+				Node &next = nodes[succ.first];
+				next.earliest = max(next.earliest, cycle - 1 + succ.second);
+				if (--next.preds == 0) {
+					ready.emplace_back(succ.first);
+				}
+			}
+		}
+		return order;
+	}
+
+	void visitMBasicBlock(MBasicBlock *node) {
+		vector <MInst *> insts;
+		for (MInst *inst : node->insts) {
+			for (Register *reg : inst->operands) {
+				if (reg->type == RVirtual) {
+					return;
+				}
+			}
+			insts.emplace_back(inst);
+		}
+		vector <MInst *> result;
+		vector <MInst *> region;
+		for (MInst *inst : insts) {
+			if (!isBarrier(inst)) {
+				region.emplace_back(inst);
+				continue;
+			}
+			for (MInst *scheduled : schedule(region)) {
+				result.emplace_back(scheduled);
+			}
+			region.clear();
+			result.emplace_back(inst);
+		}
+		for (MInst *scheduled : schedule(region)) {
+			result.emplace_back(scheduled);
+		}
+		if (result == insts) {
+			return;
+		}
+		for (MInst *inst : insts) {
+			node->remove(inst);
+		}
+		for (MInst *inst : result) {
+			node->append(inst);
+		}
+	}
+
+	void visitMFunction(MFunction *node) {
+		for (MBasicBlock *block : node->blocks) {
+			block->accept(*this);
+		}
+	}
+
+	void visitMModule(MModule *node) {
+		module = node;
+		for (MFunction *func : node->funcs) {
+			func->accept(*this);
+		}
+	}
+};
+
+}
+
+}
+
+#endif
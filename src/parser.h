@@ -11,6 +11,7 @@
 #include "ast.h"
 #include "symtypes.h"
 #include "astvisitor.h"
+#include "arena.h"
 
 
 namespace Parse {
@@ -21,32 +22,28 @@ using namespace Lex;
 using namespace AST;
 using namespace SymTypes;
 using namespace IO;
+using namespace Mem;
 
 
 static Token TokDefault = Token(DEFAULT);
-static Token TokEndf = Token(ENDF);
 
 
 class Parser {
 public:
-	vector <Token> tokens;
+	Lexer *lexer;
 	Location lastLoc, loc;
 	int cur, pos;
 	bool skip = false;
 	bool isError = false;
 
+	// all the nodes of the tree live in the arena, they are freed together
+	// once the tree is no longer needed
+	Arena arena;
 	Node *root;
 	Err::Log *errors;
 
 	Parser(Lexer &lexer, Err::Log *errors = new Err::Log()) {
-		this->tokens = lexer.tokens;
-		cur = pos = 0;
-		lastLoc = loc = Location();
-		this->errors = errors;
-		run();
-	}
-	Parser(vector <Token> tokens, Err::Log *errors = new Err::Log()) {
-		this->tokens = tokens;
+		this->lexer = &lexer;
 		cur = pos = 0;
 		lastLoc = loc = Location();
 		this->errors = errors;
@@ -60,18 +57,33 @@ public:
 		skip = true;
 	}
 
+	bool hasToken(int index) {
+		return lexer->peek(index) != ENDF;
+	}
+
+	// tokens before cur - 1 are released, so the token returned by match
+	// must be copied before the next token is requested
+	Token &token(int index) {
+		return lexer->peek(index);
+	}
+
+	void advance() {
+		pos = cur++;
+		lexer->release(cur - 1);
+		lastLoc = loc;
+	}
+
 	Token &match(const Type &tokenType = DEFAULT) {
-		if (cur < tokens.size() && (tokens[cur] == tokenType || tokenType == DEFAULT)) {
+		if (hasToken(cur) && (token(cur) == tokenType || tokenType == DEFAULT)) {
 			if (CPL_Parser_PrintTokens) {
-				out << tokens[cur] << endl;
+				out << token(cur) << endl;
 			}
 			skip = false;
-			pos = cur++;
-			lastLoc = loc;
-			if (cur < tokens.size()) {
-				loc = tokens[cur].loc;
+			advance();
+			if (hasToken(cur)) {
+				loc = token(cur).loc();
 			}
-			return tokens[cur - 1];
+			return token(cur - 1);
 		}
 
 		if (CPL_Parser_InsMissingToken) {
@@ -92,9 +104,8 @@ public:
 		if (CPL_Parser_RaiseUnexpToken) {
 			raise(loc, Err::UnexpToken);
 			while (!lookaheadIn({SEMICN, RBRACE, ENDF, LBRACE})) {
-				pos = cur++;
-				lastLoc = loc;
-				loc = tokens[cur].loc;
+				advance();
+				loc = token(cur).loc();
 			}
 		}
 
@@ -103,7 +114,7 @@ public:
 	}
 
 	bool tryMatch(const Type &tokenType = DEFAULT) {
-		if (pos < tokens.size() && (tokens[pos] == tokenType || tokenType == DEFAULT)) {
+		if (hasToken(pos) && (token(pos) == tokenType || tokenType == DEFAULT)) {
 			pos++;
 			return true;
 		}
@@ -120,10 +131,7 @@ public:
 	}
 
 	Token &lookahead(int cnt = 0) {
-		if (cur + cnt < tokens.size()) {
-			return tokens[cur + cnt];
-		}
-		return TokEndf;
+		return token(cur + cnt);
 	}
 
 	bool lookaheadIn(const vector <Type> &tokenTypes) {
@@ -145,6 +153,11 @@ public:
 		}
 	}
 
+	void release() {
+		root = nullptr;
+		arena.release();
+	}
+
 	void startParse(Node *node) {
 		node->firstLoc = loc;
 	}
@@ -160,7 +173,7 @@ public:
 	}
 
 	Node *getCompUnit() {
-		CompUnit *compUnit = new CompUnit();
+		CompUnit *compUnit = arena.make <CompUnit>();
 		startParse(compUnit);
 		Node *node = getDeclOrFuncDef();
 		while (node && (node->type() == TConstDecl || node->type() == TVarDecl)) {
@@ -214,7 +227,7 @@ public:
 	}
 
 	Node *getConstDecl() {
-		ConstDecl *constDecl = new ConstDecl();
+		ConstDecl *constDecl = arena.make <ConstDecl>();
 		startParse(constDecl);
 		match(CONSTTK);
 		SymType bType = getBType();
@@ -230,7 +243,7 @@ public:
 	}
 
 	Node *getConstDef(SymType symType) {
-		ConstDef *constDef = new ConstDef();
+		ConstDef *constDef = arena.make <ConstDef>();
 		startParse(constDef);
 		constDef->ident = match(IDENFR);
 		constDef->symType = symType;
@@ -246,7 +259,7 @@ public:
 	}
 
 	Node *getConstInitVal() {
-		ConstInitVal *constInitVal = new ConstInitVal();
+		ConstInitVal *constInitVal = arena.make <ConstInitVal>();
 		startParse(constInitVal);
 		if (lookahead() == LBRACE) {
 			match(LBRACE);
@@ -265,7 +278,7 @@ public:
 	}
 
 	Node *getVarDecl() {
-		VarDecl *varDecl = new VarDecl();
+		VarDecl *varDecl = arena.make <VarDecl>();
 		startParse(varDecl);
 		SymType bType = getBType();
 		varDecl->varDef.emplace_back(getVarDef(bType));
@@ -279,7 +292,7 @@ public:
 	}
 
 	Node *getVarDef(SymType symType) {
-		VarDef *varDef = new VarDef();
+		VarDef *varDef = arena.make <VarDef>();
 		startParse(varDef);
 		varDef->ident = match(IDENFR);
 		varDef->symType = symType;
@@ -297,7 +310,7 @@ public:
 	}
 
 	Node *getInitVal() {
-		InitVal *initVal = new InitVal();
+		InitVal *initVal = arena.make <InitVal>();
 		startParse(initVal);
 		if (lookahead() == LBRACE) {
 			match(LBRACE);
@@ -316,7 +329,7 @@ public:
 	}
 
 	Node *getFuncDef() {
-		FuncDef *funcDef = new FuncDef();
+		FuncDef *funcDef = arena.make <FuncDef>();
 		startParse(funcDef);
 		funcDef->funcType = getFuncType();
 		funcDef->ident = match(IDENFR);
@@ -331,7 +344,7 @@ public:
 	}
 
 	Node *getMainFuncDef() {
-		MainFuncDef *mainFuncDef = new MainFuncDef();
+		MainFuncDef *mainFuncDef = arena.make <MainFuncDef>();
 		startParse(mainFuncDef);
 		match(INTTK);
 		mainFuncDef->ident = match(MAINTK);
@@ -343,7 +356,7 @@ public:
 	}
 
 	Node *getFuncType() {
-		FuncType *funcType = new FuncType();
+		FuncType *funcType = arena.make <FuncType>();
 		startParse(funcType);
 		if (lookaheadIn({VOIDTK, INTTK})) {
 			funcType->symType = SymType(match());
@@ -353,7 +366,7 @@ public:
 	}
 
 	Node *getFuncFParams() {
-		FuncFParams *funcFParams = new FuncFParams();
+		FuncFParams *funcFParams = arena.make <FuncFParams>();
 		startParse(funcFParams);
 		funcFParams->params.emplace_back(getFuncFParam());
 		while (lookahead() == COMMA) {
@@ -365,7 +378,7 @@ public:
 	}
 
 	Node *getFuncFParam() {
-		FuncFParam *funcFParam = new FuncFParam();
+		FuncFParam *funcFParam = arena.make <FuncFParam>();
 		startParse(funcFParam);
 		funcFParam->symType = getBType();
 		funcFParam->ident = match(IDENFR);
@@ -384,7 +397,7 @@ public:
 	}
 
 	Node *getBlock() {
-		Block *block = new Block();
+		Block *block = arena.make <Block>();
 		startParse(block);
 		block->start = match(LBRACE);
 		while (lookahead() != RBRACE && lookahead() != ENDF) {
@@ -436,7 +449,7 @@ public:
 	}
 
 	Node *getStmtAssign() {
-		StmtAssign *stmt = new StmtAssign();
+		StmtAssign *stmt = arena.make <StmtAssign>();
 		startParse(stmt);
 		stmt->lVal = getLVal();
 		match(ASSIGN);
@@ -447,7 +460,7 @@ public:
 	}
 
 	Node *getStmtExp() {
-		StmtExp *stmt = new StmtExp();
+		StmtExp *stmt = arena.make <StmtExp>();
 		startParse(stmt);
 		if (!lookaheadIn({SEMICN, RBRACE})) {
 			stmt->expr = getExp();
@@ -458,7 +471,7 @@ public:
 	}
 
 	Node *getStmtBlock() {
-		StmtBlock *stmt = new StmtBlock();
+		StmtBlock *stmt = arena.make <StmtBlock>();
 		startParse(stmt);
 		stmt->block = getBlock();
 		finishParse(stmt);
@@ -466,7 +479,7 @@ public:
 	}
 
 	Node *getStmtIf() {
-		StmtIf *stmt = new StmtIf();
+		StmtIf *stmt = arena.make <StmtIf>();
 		startParse(stmt);
 		match(IFTK);
 		match(LPARENT);
@@ -482,7 +495,7 @@ public:
 	}
 
 	Node *getStmtFor() {
-		StmtFor *stmt = new StmtFor();
+		StmtFor *stmt = arena.make <StmtFor>();
 		startParse(stmt);
 		match(FORTK);
 		match(LPARENT);
@@ -504,7 +517,7 @@ public:
 	}
 
 	Node *getStmtBreak() {
-		StmtBreak *stmt = new StmtBreak();
+		StmtBreak *stmt = arena.make <StmtBreak>();
 		startParse(stmt);
 		match(BREAKTK);
 		match(SEMICN);
@@ -513,7 +526,7 @@ public:
 	}
 
 	Node *getStmtContinue() {
-		StmtContinue *stmt = new StmtContinue();
+		StmtContinue *stmt = arena.make <StmtContinue>();
 		startParse(stmt);
 		match(CONTINUETK);
 		match(SEMICN);
@@ -522,7 +535,7 @@ public:
 	}
 
 	Node *getStmtReturn() {
-		StmtReturn *stmt = new StmtReturn();
+		StmtReturn *stmt = arena.make <StmtReturn>();
 		startParse(stmt);
 		match(RETURNTK);
 		if (lookahead() != SEMICN) {
@@ -534,7 +547,7 @@ public:
 	}
 
 	Node *getStmtGetInt() {
-		StmtGetInt *stmt = new StmtGetInt();
+		StmtGetInt *stmt = arena.make <StmtGetInt>();
 		startParse(stmt);
 		stmt->lVal = getLVal();
 		match(ASSIGN);
@@ -547,7 +560,7 @@ public:
 	}
 
 	Node *getStmtPrintf() {
-		StmtPrintf *stmt = new StmtPrintf();
+		StmtPrintf *stmt = arena.make <StmtPrintf>();
 		startParse(stmt);
 		match(PRINTFTK);
 		match(LPARENT);
@@ -563,7 +576,7 @@ public:
 	}
 
 	Node *getForStmt() {
-		ForStmt *forStmt = new ForStmt();
+		ForStmt *forStmt = arena.make <ForStmt>();
 		startParse(forStmt);
 		forStmt->lVal = getLVal();
 		match(ASSIGN);
@@ -573,7 +586,7 @@ public:
 	}
 
 	Node *getExp() {
-		Exp *expr = new Exp();
+		Exp *expr = arena.make <Exp>();
 		startParse(expr);
 		expr->expr = getAddExp();
 		finishParse(expr);
@@ -581,7 +594,7 @@ public:
 	}
 
 	Node *getCond() {
-		Cond *cond = new Cond();
+		Cond *cond = arena.make <Cond>();
 		startParse(cond);
 		cond->expr = getLOrExp();
 		finishParse(cond);
@@ -589,7 +602,7 @@ public:
 	}
 
 	Node *getLVal() {
-		LVal *lVal = new LVal();
+		LVal *lVal = arena.make <LVal>();
 		startParse(lVal);
 		lVal->ident = match(IDENFR);
 		while (lookahead() == LBRACK) {
@@ -602,7 +615,7 @@ public:
 	}
 
 	Node *getPrimaryExp() {
-		PrimaryExp *primaryExp = new PrimaryExp();
+		PrimaryExp *primaryExp = arena.make <PrimaryExp>();
 		startParse(primaryExp);
 		if (lookahead() == LPARENT) {
 			match(LPARENT);
@@ -618,7 +631,7 @@ public:
 	}
 
 	Node *getNumber() {
-		Number *number = new Number();
+		Number *number = arena.make <Number>();
 		startParse(number);
 		number->number = match(INTCON);
 		finishParse(number);
@@ -626,7 +639,7 @@ public:
 	}
 
 	Node *getUnaryExp() {
-		UnaryExp *unaryExp = new UnaryExp();
+		UnaryExp *unaryExp = arena.make <UnaryExp>();
 		startParse(unaryExp);
 		unaryExp->op = getUnaryOp();
 		if (unaryExp->op) {
@@ -647,7 +660,7 @@ public:
 	}
 
 	Node *getUnaryOp() {
-		UnaryOp *unaryOp = new UnaryOp();
+		UnaryOp *unaryOp = arena.make <UnaryOp>();
 		startParse(unaryOp);
 		if (!lookaheadIn({PLUS, MINU, NOT})) {
 			return nullptr;
@@ -658,7 +671,7 @@ public:
 	}
 
 	Node *getFuncRParams() {
-		FuncRParams *funcRParams = new FuncRParams();
+		FuncRParams *funcRParams = arena.make <FuncRParams>();
 		startParse(funcRParams);
 		funcRParams->params.emplace_back(getExp());
 		while (lookahead() == COMMA) {
@@ -670,13 +683,13 @@ public:
 	}
 
 	Node *getMulExp() {
-		MulExp *mulExp = new MulExp();
+		MulExp *mulExp = arena.make <MulExp>();
 		startParse(mulExp);
 		mulExp->exprL = getUnaryExp();
 		while (lookaheadIn({MULT, DIV, MOD})) {
 			finishParse(mulExp);
 			MulExp *expr = mulExp;
-			mulExp = new MulExp();
+			mulExp = arena.make <MulExp>();
 			mulExp->exprL = expr;
 			mulExp->op = match();
 			mulExp->exprR = getUnaryExp();
@@ -686,13 +699,13 @@ public:
 	}
 
 	Node *getAddExp() {
-		AddExp *addExp = new AddExp();
+		AddExp *addExp = arena.make <AddExp>();
 		startParse(addExp);
 		addExp->exprL = getMulExp();
 		while (lookaheadIn({PLUS, MINU})) {
 			finishParse(addExp);
 			AddExp *expr = addExp;
-			addExp = new AddExp();
+			addExp = arena.make <AddExp>();
 			addExp->exprL = expr;
 			addExp->op = match();
 			addExp->exprR = getMulExp();
@@ -702,13 +715,13 @@ public:
 	}
 
 	Node *getRelExp() {
-		RelExp *relExp = new RelExp();
+		RelExp *relExp = arena.make <RelExp>();
 		startParse(relExp);
 		relExp->exprL = getAddExp();
 		while (lookaheadIn({LSS, GRE, LEQ, GEQ})) {
 			finishParse(relExp);
 			RelExp *expr = relExp;
-			relExp = new RelExp();
+			relExp = arena.make <RelExp>();
 			relExp->exprL = expr;
 			relExp->op = match();
 			relExp->exprR = getAddExp();
@@ -718,13 +731,13 @@ public:
 	}
 
 	Node *getEqExp() {
-		EqExp *eqExp = new EqExp();
+		EqExp *eqExp = arena.make <EqExp>();
 		startParse(eqExp);
 		eqExp->exprL = getRelExp();
 		while (lookaheadIn({EQL, NEQ})) {
 			finishParse(eqExp);
 			EqExp *expr = eqExp;
-			eqExp = new EqExp();
+			eqExp = arena.make <EqExp>();
 			eqExp->exprL = expr;
 			eqExp->op = match();
 			eqExp->exprR = getRelExp();
@@ -734,13 +747,13 @@ public:
 	}
 
 	Node *getLAndExp() {
-		LAndExp *lAndExp = new LAndExp();
+		LAndExp *lAndExp = arena.make <LAndExp>();
 		startParse(lAndExp);
 		lAndExp->exprL = getEqExp();
 		while (lookahead() == AND) {
 			finishParse(lAndExp);
 			LAndExp *expr = lAndExp;
-			lAndExp = new LAndExp();
+			lAndExp = arena.make <LAndExp>();
 			lAndExp->exprL = expr;
 			lAndExp->op = match();
 			lAndExp->exprR = getEqExp();
@@ -750,13 +763,13 @@ public:
 	}
 
 	Node *getLOrExp() {
-		LOrExp *lOrExp = new LOrExp();
+		LOrExp *lOrExp = arena.make <LOrExp>();
 		startParse(lOrExp);
 		lOrExp->exprL = getLAndExp();
 		while (lookahead() == OR) {
 			finishParse(lOrExp);
 			LOrExp *expr = lOrExp;
-			lOrExp = new LOrExp();
+			lOrExp = arena.make <LOrExp>();
 			lOrExp->exprL = expr;
 			lOrExp->op = match();
 			lOrExp->exprR = getLAndExp();
@@ -766,7 +779,7 @@ public:
 	}
 
 	Node *getConstExp() {
-		ConstExp *constExp = new ConstExp();
+		ConstExp *constExp = arena.make <ConstExp>();
 		startParse(constExp);
 		constExp->expr = getAddExp();
 		finishParse(constExp);
@@ -2,12 +2,13 @@
 #define __CPL_SCOPE_H__
 
 #include <iostream>
-#include <map>
+#include <unordered_map>
 #include <vector>
 
 #include "config.h"
 #include "lexer.h"
 #include "symtypes.h"
+#include "arena.h"
 
 
 namespace IR {
@@ -28,6 +29,11 @@ using namespace SymTypes;
 struct Scope;
 
 
+// scopes and variables are only needed until the ir is generated, they
+// all live in this arena and are freed together
+static Mem::Arena arena;
+
+
 struct Variable {
 	Token ident;
 	SymType symType;
@@ -57,7 +63,7 @@ struct Variable {
 			return initArray[dim];
 		} else {
 			if (!zeroInit) {
-				zeroInit = new Variable(ident, symType);
+				zeroInit = arena.make <Variable>(ident, symType);
 				zeroInit->symType.pop();
 				zeroInit->isZeroInit = true;
 			}
@@ -91,8 +97,9 @@ static int scopeId = 0;
 struct Scope {
 	int id;
 	Scope *parent = nullptr;
-	map <string, Variable> vars;
-	map <string, Function> funcs;
+	// keyed by the interned names
+	unordered_map <int, Variable> vars;
+	unordered_map <int, Function> funcs;
 
 	Scope() { id = scopeId++; }
 	Scope(Scope *parent) {
@@ -101,56 +108,108 @@ struct Scope {
 	}
 
 	Scope *allocate() {
-		Scope *scope = new Scope(this);
+		Scope *scope = arena.make <Scope>(this);
 		return scope;
 	}
 
-	bool defineVar(const string &ident, const Variable &var) {
-		if (vars.count(ident) || funcs.count(ident)) {
-			return false;
+	// returns the stored definition, or nullptr if the name is taken
+	Variable *defineVar(int ident, const Variable &var) {
+		if (funcs.count(ident)) {
+			return nullptr;
 		}
-		vars[ident] = var;
-		return true;
+		auto res = vars.try_emplace(ident, var);
+		return res.second ? &res.first->second : nullptr;
 	}
-	bool defineVar(const Variable &var) {
-		return defineVar(var.ident.token, var);
+	Variable *defineVar(const Variable &var) {
+		return defineVar(var.ident.symbol, var);
 	}
 
-	bool defineFunc(const string &ident, const Function &func) {
-		if (vars.count(ident) || funcs.count(ident)) {
-			return false;
+	Function *defineFunc(int ident, const Function &func) {
+		if (vars.count(ident)) {
+			return nullptr;
 		}
-		funcs[ident] = func;
-		return true;
+		auto res = funcs.try_emplace(ident, func);
+		return res.second ? &res.first->second : nullptr;
 	}
-	bool defineFunc(const Function &func) {
-		return defineFunc(func.ident.token, func);
+	Function *defineFunc(const Function &func) {
+		return defineFunc(func.ident.symbol, func);
 	}
 
-	Variable *getVar(const string &ident) {
-		if (vars.count(ident)) {
-			return &vars[ident];
-		}
-		if (parent) {
-			return parent->getVar(ident);
+	Variable *getVar(int ident) {
+		for (Scope *scope = this; scope; scope = scope->parent) {
+			auto it = scope->vars.find(ident);
+			if (it != scope->vars.end()) {
+				return &it->second;
+			}
 		}
 		return nullptr;
 	}
 	Variable *getVar(const Token &token) {
-		return getVar(token.token);
+		return getVar(token.symbol);
 	}
 
-	Function *getFunc(const string &ident) {
-		if (funcs.count(ident)) {
-			return &funcs[ident];
-		}
-		if (parent) {
-			return parent->getFunc(ident);
+	Function *getFunc(int ident) {
+		for (Scope *scope = this; scope; scope = scope->parent) {
+			auto it = scope->funcs.find(ident);
+			if (it != scope->funcs.end()) {
+				return &it->second;
+			}
 		}
 		return nullptr;
 	}
 	Function *getFunc(const Token &token) {
-		return getFunc(token.token);
+		return getFunc(token.symbol);
+	}
+};
+
+
+// the definitions visible at the current point of a walk over the scopes,
+// every symbol has a stack of its definitions in the enclosing scopes with
+// the innermost one on top, so a lookup does not depend on the nesting
+struct SymbolTable {
+	vector <vector <Variable *>> vars;
+	vector <vector <Function *>> funcs;
+
+	template <typename T>
+	static T *top(vector <vector <T *>> &stacks, int ident) {
+		if (ident >= stacks.size() || stacks[ident].empty()) {
+			return nullptr;
+		}
+		return stacks[ident].back();
+	}
+
+	template <typename T>
+	static void push(vector <vector <T *>> &stacks, int ident, T *def) {
+		if (ident >= stacks.size()) {
+			stacks.resize(ident + 1);
+		}
+		stacks[ident].emplace_back(def);
+	}
+
+	void define(Variable *var) {
+		push(vars, var->ident.symbol, var);
+	}
+
+	void define(Function *func) {
+		push(funcs, func->ident.symbol, func);
+	}
+
+	// the definitions of a scope that is left go out of sight
+	void leave(Scope *scope) {
+		for (auto &it : scope->vars) {
+			vars[it.first].pop_back();
+		}
+		for (auto &it : scope->funcs) {
+			funcs[it.first].pop_back();
+		}
+	}
+
+	Variable *getVar(const Token &token) {
+		return top(vars, token.symbol);
+	}
+
+	Function *getFunc(const Token &token) {
+		return top(funcs, token.symbol);
 	}
 };
 
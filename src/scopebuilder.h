@@ -24,6 +24,7 @@ using namespace Lex;
 class ScopeBuilder : public Visitor {
 public:
 	Scope *scope;
+	SymbolTable table;
 	vector <Node *> stack;
 
 	Err::Log *errors;
@@ -32,10 +33,10 @@ public:
 	Function *curFunc = nullptr;
 
 	ScopeBuilder(Err::Log *errors = new Err::Log()) {
-		this->scope = new Scope();
+		this->scope = arena.make <Scope>();
 		this->errors = errors;
 	}
-	ScopeBuilder(Scope *scope = new Scope(), Err::Log *errors = new Err::Log()) {
+	ScopeBuilder(Scope *scope = arena.make <Scope>(), Err::Log *errors = new Err::Log()) {
 		this->scope = scope;
 		this->errors = errors;
 	}
@@ -53,6 +54,39 @@ public:
 		stack.emplace_back(node);
 	}
 
+	Variable *defineVar(const Variable &var) {
+		Variable *def = scope->defineVar(var);
+		if (def) {
+			table.define(def);
+		}
+		return def;
+	}
+
+	Function *defineFunc(const Function &func) {
+		Function *def = scope->defineFunc(func);
+		if (def) {
+			table.define(def);
+		}
+		return def;
+	}
+
+	void enterScope() {
+		scope = scope->allocate();
+	}
+
+	void leaveScope() {
+		table.leave(scope);
+		scope = scope->parent;
+	}
+
+	// frees all the scopes and variables, the ir keeps its own copy of
+	// what it still needs
+	void release() {
+		table = SymbolTable();
+		scope = nullptr;
+		arena.release();
+	}
+
 	void leave(Node *node) {
 		stack.pop_back();
 		if (CPL_Debug) {
@@ -116,12 +150,12 @@ public:
 			node->dummy |= node->initVal->dummy;
 			if (!node->dummy) {
 				if (var.init) {
-					if (!scope->defineVar(var)) {
-						errors->raise(node->ident.loc, Err::DupIdent);
+					if (!defineVar(var)) {
+						errors->raise(node->ident.loc(), Err::DupIdent);
 						node->dummy = true;
 					}
 				} else {
-					errors->raise(node->ident.loc, Err::IndetInitVal);
+					errors->raise(node->ident.loc(), Err::IndetInitVal);
 					node->dummy = true;
 				}
 			}
@@ -135,7 +169,7 @@ public:
 		if (node->isArray) {
 			for (Node *initVal : node->initVal) {
 				Variable *parent = curVar;
-				Variable *var = new Variable(parent->ident, parent->symType);
+				Variable *var = arena.make <Variable>(parent->ident, parent->symType);
 				var->symType.pop();
 				curVar = var;
 				initVal->accept(*this);
@@ -198,8 +232,8 @@ public:
 				node->initVal->accept(*this);
 				curVar = nullptr;
 			}
-			if (!scope->defineVar(var)) {
-				errors->raise(node->ident.loc, Err::DupIdent);
+			if (!defineVar(var)) {
+				errors->raise(node->ident.loc(), Err::DupIdent);
 				node->dummy = true;
 			}
 		}
@@ -212,7 +246,7 @@ public:
 		if (node->isArray) {
 			for (Node *initVal : node->initVal) {
 				Variable *parent = curVar;
-				Variable *var = new Variable(parent->ident, parent->symType);
+				Variable *var = arena.make <Variable>(parent->ident, parent->symType);
 				var->symType.pop();
 				curVar = var;
 				initVal->accept(*this);
@@ -251,17 +285,17 @@ public:
 			node->dummy |= node->params->dummy;
 		}
 		if (!node->dummy) {
-			if (!scope->defineFunc(func)) {
-				errors->raise(node->ident.loc, Err::DupIdent);
+			if (!defineFunc(func)) {
+				errors->raise(node->ident.loc(), Err::DupIdent);
 				node->dummy = true;
 			}
-			scope = scope->allocate();
+			enterScope();
 			if (!node->dummy) {
-				scope->getFunc(node->ident)->scope = scope;
+				table.getFunc(node->ident)->scope = scope;
 			}
 			for (Variable *param : func.params) {
-				if (!scope->defineVar(*param)) {
-					errors->raise(param->ident.loc, Err::DupIdent);
+				if (!defineVar(*param)) {
+					errors->raise(param->ident.loc(), Err::DupIdent);
 					node->dummy = true;
 				}
 			}
@@ -273,7 +307,7 @@ public:
 					node->dummy = true;
 				}
 			}
-			scope = scope->parent;
+			leaveScope();
 		}
 		leave(node);
 	}
@@ -281,13 +315,13 @@ public:
 	void visitMainFuncDef(MainFuncDef *node) {
 		visit(node);
 		Function func = Function(node->ident, SymType(TInt));
-		if (!scope->defineFunc(func)) {
-			errors->raise(node->ident.loc, Err::DupIdent);
+		if (!defineFunc(func)) {
+			errors->raise(node->ident.loc(), Err::DupIdent);
 			node->dummy = true;
 		}
-		scope = scope->allocate();
+		enterScope();
 		if (!node->dummy) {
-			scope->getFunc(node->ident)->scope = scope;
+			table.getFunc(node->ident)->scope = scope;
 		}
 		node->block->accept(*this);
 		Block *block = (Block *)node->block;
@@ -295,7 +329,7 @@ public:
 			errors->raise(node->lastLoc, Err::NoReturn);
 			node->dummy = true;
 		}
-		scope = scope->parent;
+		leaveScope();
 		leave(node);
 	}
 
@@ -330,7 +364,7 @@ public:
 			}
 		}
 		if (!node->dummy) {
-			Variable *param = new Variable(node->ident, node->symType);
+			Variable *param = arena.make <Variable>(node->ident, node->symType);
 			curFunc->params.emplace_back(param);
 		}
 		leave(node);
@@ -339,14 +373,14 @@ public:
 	void visitBlock(Block *node) {
 		visit(node);
 		if (node->parent->type() != TFuncDef && node->parent->type() != TMainFuncDef) {
-			scope = scope->allocate();
+			enterScope();
 		}
 		for (Node *item : node->items) {
 			item->accept(*this);
 			node->dummy |= item->dummy;
 		}
 		if (node->parent->type() != TFuncDef && node->parent->type() != TMainFuncDef) {
-			scope = scope->parent;
+			leaveScope();
 		}
 		leave(node);
 	}
@@ -509,18 +543,19 @@ public:
 		bool dummy = false;
 		int paramCnt = 0;
 		string constString;
-		for (int i = 0; i < node->format.strVal.length(); i++) {
-			char cur = node->format.strVal[i];
+		string_view format = node->format.strVal();
+		for (int i = 0; i < format.length(); i++) {
+			char cur = format[i];
 			if (cur < 32 || (33 < cur && cur < 40 && cur != 37) || cur > 126) {
 				dummy = true;
 				break;
 			}
-			if (node->format.strVal[i] == '\\') {
-				if (i + 1 >= node->format.strVal.length()) {
+			if (format[i] == '\\') {
+				if (i + 1 >= format.length()) {
 					dummy = true;
 					break;
 				}
-				if (node->format.strVal[i + 1] != 'n') {
+				if (format[i + 1] != 'n') {
 					dummy = true;
 					break;
 				}
@@ -528,12 +563,12 @@ public:
 				i++;
 				continue;
 			}
-			if (node->format.strVal[i] == '%') {
-				if (i + 1 >= node->format.strVal.length()) {
+			if (format[i] == '%') {
+				if (i + 1 >= format.length()) {
 					dummy = true;
 					break;
 				}
-				if (node->format.strVal[i + 1] != 'd') {
+				if (format[i + 1] != 'd') {
 					dummy = true;
 					break;
 				}
@@ -543,7 +578,7 @@ public:
 				i++;
 				continue;
 			}
-			constString += node->format.strVal[i];
+			constString += format[i];
 		}
 		node->constString.emplace_back(constString);
 		if (dummy) {
@@ -607,10 +642,10 @@ public:
 			dimExp->accept(*this);
 			node->dummy |= dimExp->dummy;
 		}
-		Variable *var = scope->getVar(node->ident);
+		Variable *var = table.getVar(node->ident);
 		node->var = var;
 		if (!var) {
-			errors->raise(node->ident.loc, Err::UndefIdent);
+			errors->raise(node->ident.loc(), Err::UndefIdent);
 			node->dummy = true;
 			leave(node);
 			return;
@@ -640,7 +675,7 @@ public:
 					}
 					node->computedValue = var->get();
 				} else {
-					errors->raise(node->ident.loc, Err::ArrayDim);
+					errors->raise(node->ident.loc(), Err::ArrayDim);
 					node->computed = false;
 					node->dummy = true;
 				}
@@ -689,9 +724,10 @@ public:
 				node->dummy |= params->dummy;
 				paramCnt = params->params.size();
 			}
-			Function *func = scope->getFunc(node->ident);
+			Function *func = table.getFunc(node->ident);
+			node->func = func;
 			if (!func) {
-				errors->raise(node->ident.loc, Err::UndefIdent);
+				errors->raise(node->ident.loc(), Err::UndefIdent);
 				node->dummy = true;
 				leave(node);
 				return;
@@ -718,7 +754,7 @@ public:
 			if (node->op) {
 				UnaryOp *op = (UnaryOp *)node->op;
 				if (node->valType != SymType(TInt)) {
-					errors->raise(op->op.loc, Err::InvalOpTypes);
+					errors->raise(op->op.loc(), Err::InvalOpTypes);
 					node->dummy = true;
 				} else if (node->computed) {
 					if (op->op == MINU) {
@@ -753,7 +789,7 @@ public:
 			node->computed &= node->exprR->computed;
 			node->dummy |= node->exprR->dummy;
 			if (node->valType != SymType(TInt) || node->exprR->valType != SymType(TInt)) {
-				errors->raise(node->op.loc, Err::InvalOpTypes);
+				errors->raise(node->op.loc(), Err::InvalOpTypes);
 				node->dummy = true;
 			} else if (node->computed) {
 				if (node->op == MULT) {
@@ -762,7 +798,7 @@ public:
 					if (node->exprR->computedValue != 0) {
 						node->computedValue /= node->exprR->computedValue;
 					} else {
-						errors->raise(node->op.loc, Err::DivByZero);
+						errors->raise(node->op.loc(), Err::DivByZero);
 						node->computed = false;
 						node->computedValue = 0;
 						node->dummy = true;
@@ -771,7 +807,7 @@ public:
 					if (node->exprR->computedValue != 0) {
 						node->computedValue %= node->exprR->computedValue;
 					} else {
-						errors->raise(node->op.loc, Err::DivByZero);
+						errors->raise(node->op.loc(), Err::DivByZero);
 						node->computed = false;
 						node->computedValue = 0;
 						node->dummy = true;
@@ -794,7 +830,7 @@ public:
 			node->computed &= node->exprR->computed;
 			node->dummy |= node->exprR->dummy;
 			if (node->valType != SymType(TInt) || node->exprR->valType != SymType(TInt)) {
-				errors->raise(node->op.loc, Err::InvalOpTypes);
+				errors->raise(node->op.loc(), Err::InvalOpTypes);
 				node->dummy = true;
 			} if (node->computed) {
 				if (node->op == PLUS) {
@@ -819,7 +855,7 @@ public:
 			node->computed &= node->exprR->computed;
 			node->dummy |= node->exprR->dummy;
 			if (node->valType != SymType(TInt) || node->exprR->valType != SymType(TInt)) {
-				errors->raise(node->op.loc, Err::InvalOpTypes);
+				errors->raise(node->op.loc(), Err::InvalOpTypes);
 				node->dummy = true;
 			} if (node->computed) {
 				if (node->op == LSS) {
@@ -848,7 +884,7 @@ public:
 			node->computed &= node->exprR->computed;
 			node->dummy |= node->exprR->dummy;
 			if (node->valType != SymType(TInt) || node->exprR->valType != SymType(TInt)) {
-				errors->raise(node->op.loc, Err::InvalOpTypes);
+				errors->raise(node->op.loc(), Err::InvalOpTypes);
 				node->dummy = true;
 			} if (node->computed) {
 				if (node->op == EQL) {
@@ -873,7 +909,7 @@ public:
 			node->computed &= node->exprR->computed;
 			node->dummy |= node->exprR->dummy;
 			if (node->valType != SymType(TInt) || node->exprR->valType != SymType(TInt)) {
-				errors->raise(node->op.loc, Err::InvalOpTypes);
+				errors->raise(node->op.loc(), Err::InvalOpTypes);
 				node->dummy = true;
 			} if (node->computed) {
 				node->computedValue = node->computedValue && node->exprR->computedValue;
@@ -894,7 +930,7 @@ public:
 			node->computed &= node->exprR->computed;
 			node->dummy |= node->exprR->dummy;
 			if (node->valType != SymType(TInt) || node->exprR->valType != SymType(TInt)) {
-				errors->raise(node->op.loc, Err::InvalOpTypes);
+				errors->raise(node->op.loc(), Err::InvalOpTypes);
 				node->dummy = true;
 			} if (node->computed) {
 				node->computedValue = node->computedValue || node->exprR->computedValue;
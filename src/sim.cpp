@@ -0,0 +1,55 @@
+#include <fstream>
+
+#include "simulator.h"
+
+using namespace std;
+using namespace Sim;
+
+
+// usage: sim <assembly> [input] [class=weight ...]
+// the output of the program goes to stdout and the report to stderr
+int main(int argc, char *argv[])
+{
+	if (argc < 2) {
+		cerr << "usage: " << argv[0] << " <assembly> [input] [class=weight ...]" << endl;
+		return 1;
+	}
+
+	CostModel cost;
+	string inputName;
+	for (int i = 2; i < argc; i++) {
+		string arg = argv[i];
+		if (arg.find('=') != string::npos) {
+			if (!cost.set(arg)) {
+				cerr << "invalid cost setting " << arg << endl;
+				return 1;
+			}
+		} else {
+			inputName = arg;
+		}
+	}
+
+	ifstream code(argv[1], ios::in);
+	if (!code) {
+		cerr << "cannot open " << argv[1] << endl;
+		return 1;
+	}
+	ifstream input;
+	if (!inputName.empty()) {
+		input.open(inputName, ios::in);
+	}
+
+	Simulator simulator;
+	try {
+		simulator.load(code);
+		simulator.run(inputName.empty() ? cin : input, cout);
+	} catch (SimError &error) {
+		cout.flush();
+		cerr << "error: " << error.message << endl;
+		simulator.report(cerr, cost);
+		return 1;
+	}
+	cout.flush();
+	simulator.report(cerr, cost);
+	return 0;
+}
@@ -0,0 +1,658 @@
+/*
+# simulator
+===========
+
+a simulator for the mips assembly emitted by the compiler, covering only
+the instructions in mips.h and the syscalls used for getint, putint, putch,
+putstr and halting
+
+the data segment starts at 0x10010000 and the stack at 0x7fffeffc as in
+mars, execution starts at libmain
+
+executed instructions are counted per class, and the cycles are estimated
+by weighting each class with the cost model
+
+the stalls are counted separately on an in-order pipeline issuing one
+instruction per cycle, where an instruction waits until the results it
+reads are ready after the latency of their class
+*/
+
+#ifndef __CPL_SIMULATOR_H__
+#define __CPL_SIMULATOR_H__
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <climits>
+
+
+namespace Sim {
+
+using namespace std;
+
+
+enum InstClass {
+	CAlu,
+	CMult,
+	CDiv,
+	CMemory,
+	CBranch,
+	CJump,
+	CSysCall,
+	ClassCnt
+};
+
+const string className[ClassCnt] = {"alu", "mult", "div", "memory", "branch", "jump", "syscall"};
+
+
+struct CostModel {
+	double weight[ClassCnt] = {1, 3, 50, 2, 1.2, 1.2, 1};
+
+	// parses "class=weight", returns false if it is not a valid setting
+	bool set(const string &setting) {
+		int pos = setting.find('=');
+		if (pos == string::npos) {
+			return false;
+		}
+		string name = setting.substr(0, pos);
+		for (int i = 0; i < ClassCnt; i++) {
+			if (className[i] == name) {
+				weight[i] = stod(setting.substr(pos + 1));
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+
+enum OpCode {
+	OAdd, OAddu, OAddiu, OSub, OSubu, OMul, OMult, ODiv, OExDiv, ORem,
+	OSll, OSrl, OSra, OMfhi, OMflo,
+	OSeq, OSne, OSgt, OSge, OSlt, OSlti, OSle, OXori,
+	OJal, OJr, OJ, OLa, OLi, OLw, OSw,
+	OBeq, OBne, OBgez, OBgtz, OBlez, OBltz, OSysCall
+};
+
+
+struct Inst {
+	OpCode op;
+	InstClass instClass;
+	// rd, rs and rt are register indices, rt < 0 means imm is used instead
+	int rd = 0, rs = 0, rt = -1;
+	int imm = 0;
+	// memory address is base + imm, base < 0 means imm is absolute
+	int base = -1;
+	int target = 0;
+	// the labels are resolved after all the lines are read
+	string label;
+	int line = 0;
+};
+
+
+class SimError {
+public:
+	string message;
+
+	SimError(const string &message) {
+		this->message = message;
+	}
+};
+
+
+class Simulator {
+public:
+	static const int dataBase = 0x10010000;
+	static const int stackBase = 0x7fffeffc;
+	static const int pageBits = 12;
+
+	const long long maxSteps = 1ll << 34;
+
+	vector <Inst> text;
+	map <string, int> textLabels;
+	map <string, int> dataLabels;
+	int entry = 0;
+
+	unordered_map <unsigned, vector <unsigned char>> pages;
+	unsigned lastPageId = UINT_MAX;
+	vector <unsigned char> *lastPage = nullptr;
+
+	int regs[32] = {0};
+	int hi = 0, lo = 0;
+
+	long long count[ClassCnt] = {0};
+	long long steps = 0;
+
+	// hi and lo are tracked as one more register
+	static const int hiLo = 32;
+	long long readyAt[33] = {0};
+	long long clock = 0;
+	long long stalls = 0;
+	const int latency[ClassCnt] = {1, 4, 20, 2, 1, 1, 1};
+
+
+	unsigned char &byteAt(unsigned addr) {
+		unsigned pageId = addr >> pageBits;
+		if (pageId != lastPageId) {
+			vector <unsigned char> &page = pages[pageId];
+			if (page.empty()) {
+				page.assign(1 << pageBits, 0);
+			}
+			lastPageId = pageId;
+			lastPage = &page;
+		}
+		return (*lastPage)[addr & ((1 << pageBits) - 1)];
+	}
+
+	int loadWord(unsigned addr) {
+		if (addr & 3) {
+			throw SimError("unaligned load");
+		}
+		unsigned value = 0;
+		for (int i = 3; i >= 0; i--) {
+			value = value << 8 | byteAt(addr + i);
+		}
+		return value;
+	}
+
+	void storeWord(unsigned addr, int value) {
+		if (addr & 3) {
+			throw SimError("unaligned store");
+		}
+		for (int i = 0; i < 4; i++) {
+			byteAt(addr + i) = (unsigned)value >> (8 * i) & 255;
+		}
+	}
+
+
+	// parsing
+
+	static string trim(const string &str) {
+		int l = 0, r = str.length();
+		while (l < r && isspace(str[l])) {
+			l++;
+		}
+		while (r > l && isspace(str[r - 1])) {
+			r--;
+		}
+		return str.substr(l, r - l);
+	}
+
+	static vector <string> splitOperands(const string &str) {
+		vector <string> operands;
+		string cur;
+		for (char c : str) {
+			if (c == ',') {
+				operands.emplace_back(trim(cur));
+				cur.clear();
+			} else {
+				cur += c;
+			}
+		}
+		if (!trim(cur).empty()) {
+			operands.emplace_back(trim(cur));
+		}
+		return operands;
+	}
+
+	static int getReg(const string &name) {
+		static const string regNames[32] = {
+			"$zero", "$at", "$v0", "$v1", "$a0", "$a1", "$a2", "$a3",
+			"$t0", "$t1", "$t2", "$t3", "$t4", "$t5", "$t6", "$t7",
+			"$s0", "$s1", "$s2", "$s3", "$s4", "$s5", "$s6", "$s7",
+			"$t8", "$t9", "$k0", "$k1", "$gp", "$sp", "$fp", "$ra"
+		};
+		for (int i = 0; i < 32; i++) {
+			if (regNames[i] == name) {
+				return i;
+			}
+		}
+		throw SimError("unknown register " + name);
+	}
+
+	static bool isReg(const string &operand) {
+		return !operand.empty() && operand[0] == '$';
+	}
+
+	// reads a register or an immediate into rt or imm
+	static void parseSource(Inst &inst, const string &operand) {
+		if (isReg(operand)) {
+			inst.rt = getReg(operand);
+		} else {
+			inst.rt = -1;
+			inst.imm = stoi(operand);
+		}
+	}
+
+	// reads imm($reg), label or label + imm
+	static void parseAddress(Inst &inst, const string &operand) {
+		int paren = operand.find('(');
+		if (paren != string::npos) {
+			inst.imm = stoi(operand.substr(0, paren));
+			inst.base = getReg(operand.substr(paren + 1, operand.find(')') - paren - 1));
+			return;
+		}
+		int plus = operand.find('+');
+		inst.base = -1;
+		inst.imm = 0;
+		if (plus != string::npos) {
+			inst.label = trim(operand.substr(0, plus));
+			inst.imm = stoi(operand.substr(plus + 1));
+		} else {
+			inst.label = operand;
+		}
+	}
+
+	static Inst parseInst(const string &op, const vector <string> &operands) {
+		static const map <string, pair <OpCode, InstClass>> opcodes = {
+			{"add", {OAdd, CAlu}}, {"addu", {OAddu, CAlu}}, {"addiu", {OAddiu, CAlu}},
+			{"sub", {OSub, CAlu}}, {"subu", {OSubu, CAlu}},
+			{"mul", {OMul, CMult}}, {"mult", {OMult, CMult}},
+			{"div", {ODiv, CDiv}}, {"rem", {ORem, CDiv}},
+			{"sll", {OSll, CAlu}}, {"srl", {OSrl, CAlu}}, {"sra", {OSra, CAlu}},
+			{"mfhi", {OMfhi, CAlu}}, {"mflo", {OMflo, CAlu}},
+			{"seq", {OSeq, CAlu}}, {"sne", {OSne, CAlu}}, {"sgt", {OSgt, CAlu}}, {"sge", {OSge, CAlu}},
+			{"slt", {OSlt, CAlu}}, {"slti", {OSlti, CAlu}}, {"sle", {OSle, CAlu}}, {"xori", {OXori, CAlu}},
+			{"jal", {OJal, CJump}}, {"jr", {OJr, CJump}}, {"j", {OJ, CJump}},
+			{"la", {OLa, CAlu}}, {"li", {OLi, CAlu}}, {"lw", {OLw, CMemory}}, {"sw", {OSw, CMemory}},
+			{"beq", {OBeq, CBranch}}, {"bne", {OBne, CBranch}},
+			{"bgez", {OBgez, CBranch}}, {"bgtz", {OBgtz, CBranch}},
+			{"blez", {OBlez, CBranch}}, {"bltz", {OBltz, CBranch}},
+			{"syscall", {OSysCall, CSysCall}}
+		};
+		auto it = opcodes.find(op);
+		if (it == opcodes.end()) {
+			throw SimError("unknown instruction " + op);
+		}
+		Inst inst;
+		inst.op = it->second.first;
+		inst.instClass = it->second.second;
+		switch (inst.op) {
+			case OSysCall:
+				break;
+			case OMult:
+				inst.rs = getReg(operands.at(0));
+				inst.rt = getReg(operands.at(1));
+				break;
+			case ODiv:
+				if (operands.size() == 2) {
+					inst.op = OExDiv;
+					inst.rs = getReg(operands.at(0));
+					inst.rt = getReg(operands.at(1));
+					break;
+				}
+				inst.rd = getReg(operands.at(0));
+				inst.rs = getReg(operands.at(1));
+				parseSource(inst, operands.at(2));
+				break;
+			case OMfhi:
+			case OMflo:
+				inst.rd = getReg(operands.at(0));
+				break;
+			case OJal:
+			case OJ:
+				inst.label = operands.at(0);
+				break;
+			case OJr:
+				inst.rs = getReg(operands.at(0));
+				break;
+			case OLi:
+				inst.rd = getReg(operands.at(0));
+				inst.imm = stoi(operands.at(1));
+				break;
+			case OLa:
+			case OLw:
+			case OSw:
+				inst.rd = getReg(operands.at(0));
+				parseAddress(inst, operands.at(1));
+				break;
+			case OBeq:
+			case OBne:
+				inst.rs = getReg(operands.at(0));
+				parseSource(inst, operands.at(1));
+				inst.label = operands.at(2);
+				break;
+			case OBgez:
+			case OBgtz:
+			case OBlez:
+			case OBltz:
+				inst.rs = getReg(operands.at(0));
+				inst.label = operands.at(1);
+				break;
+			default:
+				inst.rd = getReg(operands.at(0));
+				inst.rs = getReg(operands.at(1));
+				parseSource(inst, operands.at(2));
+		}
+		return inst;
+	}
+
+	// unescapes the content between the quotes of .ascii
+	static string parseAscii(const string &str) {
+		string res;
+		int l = str.find('"'), r = str.rfind('"');
+		for (int i = l + 1; i < r; i++) {
+			if (str[i] != '\\') {
+				res += str[i];
+				continue;
+			}
+			i++;
+			if (str[i] == 'n') {
+				res += '\n';
+			} else if (str[i] == '0') {
+				res += '\0';
+			} else {
+				res += str[i];
+			}
+		}
+		return res;
+	}
+
+	void load(istream &in) {
+		bool inText = false;
+		unsigned dataPtr = dataBase;
+		string line;
+		int lineCnt = 0;
+		while (getline(in, line)) {
+			lineCnt++;
+			line = trim(line);
+			if (line.empty() || line[0] == '#') {
+				continue;
+			}
+			if (line == ".data" || line == ".text") {
+				inText = line == ".text";
+				continue;
+			}
+			// a label is a single word before the colon, a colon after a
+			// directive is the repeat count of .word value:count
+			int colon = line.find(':');
+			bool quoted = line.find('"') != string::npos && line.find('"') < colon;
+			bool spaced = line.find_first_of(" \t") < colon;
+			if (colon != string::npos && !quoted && !spaced) {
+				string label = trim(line.substr(0, colon));
+				if (inText) {
+					textLabels[label] = text.size();
+				} else {
+					dataLabels[label] = dataPtr;
+				}
+				line = trim(line.substr(colon + 1));
+				if (line.empty()) {
+					continue;
+				}
+			}
+			int space = line.find_first_of(" \t");
+			string op = line.substr(0, space);
+			string rest = space == string::npos ? "" : line.substr(space + 1);
+			if (!inText) {
+				if (op == ".word") {
+					for (const string &value : splitOperands(rest)) {
+						int colon = value.find(':');
+						int cnt = colon == string::npos ? 1 : stoi(value.substr(colon + 1));
+						for (int i = 0; i < cnt; i++) {
+							storeWord(dataPtr, stoi(value.substr(0, colon)));
+							dataPtr += 4;
+						}
+					}
+				} else if (op == ".space") {
+					dataPtr += stoi(rest);
+				} else if (op == ".ascii" || op == ".asciiz") {
+					string str = parseAscii(rest);
+					if (op == ".asciiz") {
+						str += '\0';
+					}
+					for (char c : str) {
+						byteAt(dataPtr++) = c;
+					}
+				} else {
+					throw SimError("unknown directive " + op);
+				}
+				dataPtr = (dataPtr + 3) & ~3u;
+				continue;
+			}
+			Inst inst = parseInst(op, splitOperands(rest));
+			inst.line = lineCnt;
+			text.emplace_back(inst);
+		}
+		for (Inst &inst : text) {
+			if (inst.label.empty()) {
+				continue;
+			}
+			if (inst.op == OLa || inst.op == OLw || inst.op == OSw) {
+				if (dataLabels.count(inst.label) == 0) {
+					throw SimError("unknown data label " + inst.label);
+				}
+				inst.imm += dataLabels[inst.label];
+				continue;
+			}
+			if (textLabels.count(inst.label) == 0) {
+				throw SimError("unknown label " + inst.label);
+			}
+			inst.target = textLabels[inst.label];
+		}
+		if (textLabels.count("libmain")) {
+			entry = textLabels["libmain"];
+		}
+	}
+
+
+	// execution
+
+	int source(const Inst &inst) {
+		return inst.rt < 0 ? inst.imm : regs[inst.rt];
+	}
+
+	unsigned address(const Inst &inst) {
+		return inst.base < 0 ? inst.imm : regs[inst.base] + inst.imm;
+	}
+
+	static int divide(int a, int b) {
+		if (b == 0) {
+			throw SimError("division by zero");
+		}
+		if (a == INT_MIN && b == -1) {
+			return a;
+		}
+		return a / b;
+	}
+
+	static int remainder(int a, int b) {
+		if (b == 0) {
+			throw SimError("division by zero");
+		}
+		if (b == -1) {
+			return 0;
+		}
+		return a % b;
+	}
+
+	void issue(const Inst &inst) {
+		long long start = max(clock, readyAt[inst.rs]);
+		if (inst.rt >= 0) {
+			start = max(start, readyAt[inst.rt]);
+		}
+		if (inst.base >= 0) {
+			start = max(start, readyAt[inst.base]);
+		}
+		if (inst.op == OSw) {
+			start = max(start, readyAt[inst.rd]);
+		}
+		if (inst.op == OMfhi || inst.op == OMflo) {
+			start = max(start, readyAt[hiLo]);
+		}
+		stalls += start - clock;
+		clock = start + 1;
+		long long ready = start + latency[inst.instClass];
+		// mul, div and rem write hi and lo besides rd, as in MARS
+		if (inst.op == OMul || inst.op == ODiv || inst.op == ORem) {
+			readyAt[hiLo] = ready;
+		}
+		if (inst.op == OMult || inst.op == OExDiv) {
+			readyAt[hiLo] = ready;
+		} else if (inst.op == OJal) {
+			readyAt[31] = ready;
+		} else if (inst.op == OSysCall) {
+			readyAt[2] = ready;
+		} else if (inst.op != OSw && inst.rd != 0) {
+			readyAt[inst.rd] = ready;
+		}
+	}
+
+	void run(istream &in, ostream &out) {
+		regs[29] = stackBase;
+		regs[28] = 0x10008000;
+		int pc = entry;
+		while (true) {
+			if (pc < 0 || pc >= text.size()) {
+				throw SimError("jump out of the text segment");
+			}
+			if (++steps > maxSteps) {
+				throw SimError("too many steps");
+			}
+			const Inst &inst = text[pc++];
+			count[inst.instClass]++;
+			issue(inst);
+			unsigned a = regs[inst.rs], b = source(inst);
+			int res = 0;
+			switch (inst.op) {
+				case OAdd: case OAddu: case OAddiu: res = a + b; break;
+				case OSub: case OSubu: res = a - b; break;
+				case OMul: {
+					long long prod = 1ll * (int)a * (int)b;
+					lo = prod;
+					hi = prod >> 32;
+					res = lo;
+					break;
+				}
+				case OMult: {
+					long long prod = 1ll * (int)a * (int)b;
+					lo = prod;
+					hi = prod >> 32;
+					continue;
+				}
+				// div and rem expand to div and mflo or mfhi
+				case ODiv: case ORem:
+					lo = divide(a, b);
+					hi = remainder(a, b);
+					res = inst.op == ODiv ? lo : hi;
+					break;
+				case OExDiv:
+					lo = divide(a, b);
+					hi = remainder(a, b);
+					continue;
+				case OSll: res = a << (b & 31); break;
+				case OSrl: res = a >> (b & 31); break;
+				case OSra: res = (int)a >> (b & 31); break;
+				case OMfhi: res = hi; break;
+				case OMflo: res = lo; break;
+				case OSeq: res = a == b; break;
+				case OSne: res = a != b; break;
+				case OSgt: res = (int)a > (int)b; break;
+				case OSge: res = (int)a >= (int)b; break;
+				case OSlt: case OSlti: res = (int)a < (int)b; break;
+				case OSle: res = (int)a <= (int)b; break;
+				case OXori: res = a ^ b; break;
+				case OLi: res = inst.imm; break;
+				case OLa: res = address(inst); break;
+				case OLw: res = loadWord(address(inst)); break;
+				case OSw:
+					storeWord(address(inst), regs[inst.rd]);
+					continue;
+				case OJal:
+					regs[31] = pc;
+					pc = inst.target;
+					continue;
+				case OJr:
+					pc = a;
+					continue;
+				case OJ:
+					pc = inst.target;
+					continue;
+				case OBeq:
+					if (a == b) {
+						pc = inst.target;
+					}
+					continue;
+				case OBne:
+					if (a != b) {
+						pc = inst.target;
+					}
+					continue;
+				case OBgez:
+					if ((int)a >= 0) {
+						pc = inst.target;
+					}
+					continue;
+				case OBgtz:
+					if ((int)a > 0) {
+						pc = inst.target;
+					}
+					continue;
+				case OBlez:
+					if ((int)a <= 0) {
+						pc = inst.target;
+					}
+					continue;
+				case OBltz:
+					if ((int)a < 0) {
+						pc = inst.target;
+					}
+					continue;
+				case OSysCall:
+					if (syscall(in, out)) {
+						return;
+					}
+					continue;
+			}
+			if (inst.rd != 0) {
+				regs[inst.rd] = res;
+			}
+		}
+	}
+
+	// returns true when the program halts
+	bool syscall(istream &in, ostream &out) {
+		int v0 = regs[2], a0 = regs[4];
+		if (v0 == 1) {
+			out << a0;
+		} else if (v0 == 11) {
+			out << (char)a0;
+		} else if (v0 == 4) {
+			for (unsigned addr = a0; byteAt(addr); addr++) {
+				out << byteAt(addr);
+			}
+		} else if (v0 == 5) {
+			int value = 0;
+			in >> value;
+			regs[2] = value;
+		} else if (v0 == 10) {
+			return true;
+		} else {
+			throw SimError("unknown syscall " + to_string(v0));
+		}
+		return false;
+	}
+
+
+	double cycles(const CostModel &cost) const {
+		double res = 0;
+		for (int i = 0; i < ClassCnt; i++) {
+			res += count[i] * cost.weight[i];
+		}
+		return res;
+	}
+
+	void report(ostream &out, const CostModel &cost) const {
+		out << "instructions " << steps << endl;
+		for (int i = 0; i < ClassCnt; i++) {
+			out << className[i] << " " << count[i] << endl;
+		}
+		out << "cycles " << (long long)(cycles(cost) + 0.5) << endl;
+		out << "stalls " << stalls << endl;
+	}
+};
+
+}
+
+#endif